@@ -0,0 +1,346 @@
+/*
+    FreeRTOS V7.5.2 - Copyright (C) 2013 Real Time Engineers Ltd.
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "buffer_pool.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* Rounds a size up to a whole number of portBYTE_ALIGNMENT units. */
+#define bpALIGN( x )	( ( ( size_t ) ( x ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/*-----------------------------------------------------------*/
+
+/* Structure that holds state information on the pool. */
+typedef struct xBUFFER_POOL /*lint !e9058 Style convention uses tag. */
+{
+	xQueueHandle xFreeBlocks;				/*< Holds the address of every block that is not in use. */
+	unsigned char *pucBlocks;				/*< Points to the first block.  The blocks follow each other. */
+	size_t xBlockSize;						/*< The size of each block, rounded up to a multiple of portBYTE_ALIGNMENT. */
+	unsigned portBASE_TYPE uxBlockCount;	/*< The number of blocks in the pool. */
+	unsigned char *pucInUse;				/*< One flag per block, set while the block is acquired.  Follows the last block. */
+} xBUFFER_POOL;
+
+/*
+ * Asserts that pvBlock is the address of one of the blocks of pxPool, as
+ * releasing any other address would hand out memory the pool does not own.
+ */
+static void prvCheckBlock( const xBUFFER_POOL * const pxPool, const void * const pvBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the position of pvBlock within the blocks of pxPool, which is also
+ * the index of its in-use flag.
+ */
+static unsigned portBASE_TYPE prvBlockIndex( const xBUFFER_POOL * const pxPool, const void * const pvBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Marks pvBlock as in use once it has been taken from the free queue.
+ */
+static void prvMarkAcquired( xBUFFER_POOL * const pxPool, void * const pvBlock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+xBufferPoolHandle xBufferPoolCreate( unsigned portBASE_TYPE uxBlockCount, size_t xBlockSize )
+{
+xBUFFER_POOL *pxPool;
+unsigned char *pucBlock;
+unsigned portBASE_TYPE ux;
+
+	configASSERT( uxBlockCount > ( unsigned portBASE_TYPE ) 0 );
+	configASSERT( xBlockSize > ( size_t ) 0 );
+
+	/* The structure, the blocks and the in-use flags are allocated in a single
+	call.  The blocks start on the first aligned address after the structure,
+	which is aligned as pvPortMalloc() returns aligned memory.  The flags need
+	no alignment so they go after the last block. */
+	xBlockSize = bpALIGN( xBlockSize );
+	pxPool = ( xBUFFER_POOL * ) pvPortMalloc( bpALIGN( sizeof( xBUFFER_POOL ) ) + ( ( xBlockSize + ( size_t ) 1 ) * ( size_t ) uxBlockCount ) );
+
+	if( pxPool != NULL )
+	{
+		pxPool->xFreeBlocks = xQueueCreate( uxBlockCount, ( unsigned portBASE_TYPE ) sizeof( void * ) );
+
+		if( pxPool->xFreeBlocks != NULL )
+		{
+			pxPool->pucBlocks = ( ( unsigned char * ) pxPool ) + bpALIGN( sizeof( xBUFFER_POOL ) ); /*lint !e9016 Indexing past structure valid for uint8_t pointer. */
+			pxPool->xBlockSize = xBlockSize;
+			pxPool->uxBlockCount = uxBlockCount;
+			pxPool->pucInUse = pxPool->pucBlocks + ( xBlockSize * ( size_t ) uxBlockCount );
+			memset( ( void * ) pxPool->pucInUse, ( int ) pdFALSE, ( size_t ) uxBlockCount );
+
+			/* Every block starts out free.  The queue is as long as the pool,
+			so none of these sends can fail. */
+			pucBlock = pxPool->pucBlocks;
+			for( ux = ( unsigned portBASE_TYPE ) 0; ux < uxBlockCount; ux++ )
+			{
+				( void ) xQueueSend( pxPool->xFreeBlocks, &pucBlock, ( portTickType ) 0 );
+				pucBlock += xBlockSize;
+			}
+		}
+		else
+		{
+			vPortFree( ( void * ) pxPool );
+			pxPool = NULL;
+		}
+	}
+
+	return ( xBufferPoolHandle ) pxPool;
+}
+/*-----------------------------------------------------------*/
+
+void vBufferPoolDelete( xBufferPoolHandle xPool )
+{
+xBUFFER_POOL * const pxPool = ( xBUFFER_POOL * ) xPool;
+
+	configASSERT( pxPool );
+
+	/* Deleting a pool while one of its blocks is still in use would leave the
+	user of that block writing to freed memory. */
+	configASSERT( uxQueueMessagesWaiting( pxPool->xFreeBlocks ) == pxPool->uxBlockCount );
+
+	vQueueDelete( pxPool->xFreeBlocks );
+
+	/* Both the structure and the blocks were allocated using a single call
+	to pvPortMalloc(), hence only one call to vPortFree() is required. */
+	vPortFree( ( void * ) pxPool );
+}
+/*-----------------------------------------------------------*/
+
+void *pvBufferPoolAcquire( xBufferPoolHandle xPool, portTickType xTicksToWait )
+{
+xBUFFER_POOL * const pxPool = ( xBUFFER_POOL * ) xPool;
+void *pvBlock = NULL;
+
+	configASSERT( pxPool );
+
+	if( xQueueReceive( pxPool->xFreeBlocks, &pvBlock, xTicksToWait ) == pdPASS )
+	{
+		prvMarkAcquired( pxPool, pvBlock );
+	}
+	else
+	{
+		pvBlock = NULL;
+	}
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+void *pvBufferPoolAcquireFromISR( xBufferPoolHandle xPool, portBASE_TYPE *pxHigherPriorityTaskWoken )
+{
+xBUFFER_POOL * const pxPool = ( xBUFFER_POOL * ) xPool;
+void *pvBlock = NULL;
+
+	configASSERT( pxPool );
+
+	if( xQueueReceiveFromISR( pxPool->xFreeBlocks, &pvBlock, pxHigherPriorityTaskWoken ) == pdPASS )
+	{
+		prvMarkAcquired( pxPool, pvBlock );
+	}
+	else
+	{
+		pvBlock = NULL;
+	}
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+void vBufferPoolRelease( xBufferPoolHandle xPool, void *pvBlock )
+{
+xBUFFER_POOL * const pxPool = ( xBUFFER_POOL * ) xPool;
+unsigned portBASE_TYPE uxIndex;
+portBASE_TYPE xReturn;
+
+	configASSERT( pxPool );
+	prvCheckBlock( pxPool, pvBlock );
+	uxIndex = prvBlockIndex( pxPool, pvBlock );
+
+	/* A block released twice would sit in the free queue twice and later be
+	handed to two owners.  The flag is tested and cleared as one operation so
+	two concurrent releases of the same block cannot both pass. */
+	taskENTER_CRITICAL();
+	{
+		configASSERT( pxPool->pucInUse[ uxIndex ] != ( unsigned char ) pdFALSE );
+		pxPool->pucInUse[ uxIndex ] = ( unsigned char ) pdFALSE;
+	}
+	taskEXIT_CRITICAL();
+
+	/* The queue has room for every block of the pool, and the block was not
+	in it, so the send cannot fail. */
+	xReturn = xQueueSend( pxPool->xFreeBlocks, &pvBlock, ( portTickType ) 0 );
+	configASSERT( xReturn == pdPASS );
+	( void ) xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vBufferPoolReleaseFromISR( xBufferPoolHandle xPool, void *pvBlock, portBASE_TYPE *pxHigherPriorityTaskWoken )
+{
+xBUFFER_POOL * const pxPool = ( xBUFFER_POOL * ) xPool;
+unsigned portBASE_TYPE uxIndex, uxSavedInterruptStatus;
+portBASE_TYPE xReturn;
+
+	configASSERT( pxPool );
+	prvCheckBlock( pxPool, pvBlock );
+	uxIndex = prvBlockIndex( pxPool, pvBlock );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		configASSERT( pxPool->pucInUse[ uxIndex ] != ( unsigned char ) pdFALSE );
+		pxPool->pucInUse[ uxIndex ] = ( unsigned char ) pdFALSE;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	xReturn = xQueueSendFromISR( pxPool->xFreeBlocks, &pvBlock, pxHigherPriorityTaskWoken );
+	configASSERT( xReturn == pdPASS );
+	( void ) xReturn;
+}
+/*-----------------------------------------------------------*/
+
+unsigned portBASE_TYPE uxBufferPoolBlocksAvailable( xBufferPoolHandle xPool )
+{
+xBUFFER_POOL * const pxPool = ( xBUFFER_POOL * ) xPool;
+
+	configASSERT( pxPool );
+
+	return uxQueueMessagesWaiting( pxPool->xFreeBlocks );
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xBufferChannelSend( xQueueHandle xChannel, void *pvBlock, portTickType xTicksToWait )
+{
+	configASSERT( pvBlock );
+
+	/* Only the address of the block goes through the queue. */
+	return xQueueSend( xChannel, &pvBlock, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xBufferChannelSendFromISR( xQueueHandle xChannel, void *pvBlock, portBASE_TYPE *pxHigherPriorityTaskWoken )
+{
+	configASSERT( pvBlock );
+
+	return xQueueSendFromISR( xChannel, &pvBlock, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+void *pvBufferChannelReceive( xQueueHandle xChannel, portTickType xTicksToWait )
+{
+void *pvBlock = NULL;
+
+	if( xQueueReceive( xChannel, &pvBlock, xTicksToWait ) != pdPASS )
+	{
+		pvBlock = NULL;
+	}
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckBlock( const xBUFFER_POOL * const pxPool, const void * const pvBlock )
+{
+	/* Only used by configASSERT(). */
+	( void ) pxPool;
+	( void ) pvBlock;
+
+	configASSERT( ( const unsigned char * ) pvBlock >= pxPool->pucBlocks ); /*lint !e946 Comparison of pointers into the same block of memory. */
+	configASSERT( ( const unsigned char * ) pvBlock < ( pxPool->pucBlocks + ( pxPool->xBlockSize * ( size_t ) pxPool->uxBlockCount ) ) ); /*lint !e946 Comparison of pointers into the same block of memory. */
+	configASSERT( ( ( size_t ) ( ( const unsigned char * ) pvBlock - pxPool->pucBlocks ) % pxPool->xBlockSize ) == ( size_t ) 0 );
+}
+/*-----------------------------------------------------------*/
+
+static unsigned portBASE_TYPE prvBlockIndex( const xBUFFER_POOL * const pxPool, const void * const pvBlock )
+{
+	return ( unsigned portBASE_TYPE ) ( ( size_t ) ( ( const unsigned char * ) pvBlock - pxPool->pucBlocks ) / pxPool->xBlockSize );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMarkAcquired( xBUFFER_POOL * const pxPool, void * const pvBlock )
+{
+unsigned portBASE_TYPE uxIndex;
+
+	uxIndex = prvBlockIndex( pxPool, pvBlock );
+
+	/* The block has just left the free queue, so nothing else can be
+	releasing it and the flag can be set without a critical section. */
+	configASSERT( pxPool->pucInUse[ uxIndex ] == ( unsigned char ) pdFALSE );
+	pxPool->pucInUse[ uxIndex ] = ( unsigned char ) pdTRUE;
+}
+/*-----------------------------------------------------------*/
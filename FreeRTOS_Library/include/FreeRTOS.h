@@ -153,6 +153,10 @@ typedef portBASE_TYPE (*pdTASK_HOOK_CODE)( void * );
 	#define INCLUDE_xTimerGetTimerDaemonTaskHandle 0
 #endif
 
+#ifndef INCLUDE_xTimerPendFunctionCall
+	#define INCLUDE_xTimerPendFunctionCall 0
+#endif
+
 #ifndef INCLUDE_xQueueGetMutexHolder
 	#define INCLUDE_xQueueGetMutexHolder 0
 #endif
@@ -185,6 +189,22 @@ typedef portBASE_TYPE (*pdTASK_HOOK_CODE)( void * );
 	#define configUSE_MUTEXES 0
 #endif
 
+#ifndef configUSE_PRIORITY_CEILING_MUTEXES
+	#define configUSE_PRIORITY_CEILING_MUTEXES 0
+#endif
+
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 )
+	#error configUSE_PRIORITY_CEILING_MUTEXES is an option of the mutexes so configUSE_MUTEXES must also be 1.
+#endif
+
+#ifndef configUSE_READ_WRITE_LOCKS
+	#define configUSE_READ_WRITE_LOCKS 0
+#endif
+
+#if ( configUSE_READ_WRITE_LOCKS == 1 ) && ( configUSE_MUTEXES != 1 )
+	#error Read write locks are built on the mutexes so configUSE_MUTEXES must also be 1.
+#endif
+
 #ifndef configUSE_TIMERS
 	#define configUSE_TIMERS 0
 #endif
@@ -241,6 +261,10 @@ typedef portBASE_TYPE (*pdTASK_HOOK_CODE)( void * );
 
 #endif /* configUSE_TIMERS */
 
+#if ( ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS != 1 ) )
+	#error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCallFromISR() function available.
+#endif
+
 #ifndef INCLUDE_xTaskGetSchedulerState
 	#define INCLUDE_xTaskGetSchedulerState 0
 #endif
@@ -471,6 +495,12 @@ typedef portBASE_TYPE (*pdTASK_HOOK_CODE)( void * );
 	#define traceTASK_DELAY()
 #endif
 
+#ifndef traceTASK_DEADLINE_MISSED
+	/* Called by vTaskDelayUntil() when a task with a deadline finishes a job
+	after the deadline has passed. */
+	#define traceTASK_DEADLINE_MISSED( pxTCB )
+#endif
+
 #ifndef traceTASK_PRIORITY_SET
 	#define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )
 #endif
@@ -511,6 +541,130 @@ typedef portBASE_TYPE (*pdTASK_HOOK_CODE)( void * );
 	#define traceTIMER_COMMAND_RECEIVED( pxTimer, xMessageID, xMessageValue )
 #endif
 
+#ifndef tracePEND_FUNC_CALL_FROM_ISR
+	#define tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, ret )
+#endif
+
+#ifndef traceEVENT_GROUP_CREATE
+	#define traceEVENT_GROUP_CREATE( xEventGroup )
+#endif
+
+#ifndef traceEVENT_GROUP_CREATE_FAILED
+	#define traceEVENT_GROUP_CREATE_FAILED()
+#endif
+
+#ifndef traceEVENT_GROUP_SYNC_BLOCK
+	#define traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor )
+#endif
+
+#ifndef traceEVENT_GROUP_SYNC_END
+	#define traceEVENT_GROUP_SYNC_END( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTimeoutOccurred ) ( void ) xTimeoutOccurred
+#endif
+
+#ifndef traceEVENT_GROUP_WAIT_BITS_BLOCK
+	#define traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor )
+#endif
+
+#ifndef traceEVENT_GROUP_WAIT_BITS_END
+	#define traceEVENT_GROUP_WAIT_BITS_END( xEventGroup, uxBitsToWaitFor, xTimeoutOccurred ) ( void ) xTimeoutOccurred
+#endif
+
+#ifndef traceEVENT_GROUP_CLEAR_BITS
+	#define traceEVENT_GROUP_CLEAR_BITS( xEventGroup, uxBitsToClear )
+#endif
+
+#ifndef traceEVENT_GROUP_CLEAR_BITS_FROM_ISR
+	#define traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear )
+#endif
+
+#ifndef traceEVENT_GROUP_SET_BITS
+	#define traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet )
+#endif
+
+#ifndef traceEVENT_GROUP_SET_BITS_FROM_ISR
+	#define traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet )
+#endif
+
+#ifndef traceEVENT_GROUP_DELETE
+	#define traceEVENT_GROUP_DELETE( xEventGroup )
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE
+	#define traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE_FAILED
+	#define traceSTREAM_BUFFER_CREATE_FAILED( xIsMessageBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_DELETE
+	#define traceSTREAM_BUFFER_DELETE( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RESET
+	#define traceSTREAM_BUFFER_RESET( xStreamBuffer )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_SEND
+	#define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND
+	#define traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesSent )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND_FAILED
+	#define traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND_FROM_ISR
+	#define traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesSent )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_RECEIVE
+	#define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE
+	#define traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE_FAILED
+	#define traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE_FROM_ISR
+	#define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
+#endif
+
+#ifndef traceTASK_NOTIFY_TAKE_BLOCK
+	#define traceTASK_NOTIFY_TAKE_BLOCK()
+#endif
+
+#ifndef traceTASK_NOTIFY_TAKE
+	#define traceTASK_NOTIFY_TAKE()
+#endif
+
+#ifndef traceTASK_NOTIFY_WAIT_BLOCK
+	#define traceTASK_NOTIFY_WAIT_BLOCK()
+#endif
+
+#ifndef traceTASK_NOTIFY_WAIT
+	#define traceTASK_NOTIFY_WAIT()
+#endif
+
+#ifndef traceTASK_NOTIFY
+	#define traceTASK_NOTIFY()
+#endif
+
+#ifndef traceTASK_NOTIFY_FROM_ISR
+	#define traceTASK_NOTIFY_FROM_ISR()
+#endif
+
+#ifndef traceTASK_NOTIFY_GIVE_FROM_ISR
+	#define traceTASK_NOTIFY_GIVE_FROM_ISR()
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
 	#define configGENERATE_RUN_TIME_STATS 0
 #endif
@@ -533,6 +687,42 @@ typedef portBASE_TYPE (*pdTASK_HOOK_CODE)( void * );
 	#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
 #endif
 
+#ifndef configRECORD_SECTION_LATENCY
+	#define configRECORD_SECTION_LATENCY 0
+#endif
+
+#ifndef configSECTION_LATENCY_TOP_N
+	#define configSECTION_LATENCY_TOP_N 8
+#endif
+
+#if ( configRECORD_SECTION_LATENCY == 1 )
+
+	#if ( configGENERATE_RUN_TIME_STATS != 1 )
+		#error configRECORD_SECTION_LATENCY times sections with the run time stats clock so configGENERATE_RUN_TIME_STATS must also be 1.
+	#endif
+
+	#ifndef portRETURN_ADDRESS
+		#error configRECORD_SECTION_LATENCY is 1 but the port does not define portRETURN_ADDRESS().
+	#endif
+
+#endif /* configRECORD_SECTION_LATENCY */
+
+#ifndef configTASK_POOL_SIZE
+	#define configTASK_POOL_SIZE 0
+#endif
+
+#if ( configTASK_POOL_SIZE > 0 ) && ( INCLUDE_vTaskDelete != 1 )
+	#error configTASK_POOL_SIZE keeps the memory of deleted tasks so INCLUDE_vTaskDelete must be 1.
+#endif
+
+#ifndef configRECORD_WAKE_LATENCY
+	#define configRECORD_WAKE_LATENCY 0
+#endif
+
+#if ( configRECORD_WAKE_LATENCY == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 )
+	#error configRECORD_WAKE_LATENCY attributes wakes to the interrupts registered for run time stats so configGENERATE_RUN_TIME_STATS must also be 1.
+#endif
+
 #ifndef configUSE_MALLOC_FAILED_HOOK
 	#define configUSE_MALLOC_FAILED_HOOK 0
 #endif
@@ -545,6 +735,10 @@ typedef portBASE_TYPE (*pdTASK_HOOK_CODE)( void * );
 	#define portYIELD_WITHIN_API portYIELD
 #endif
 
+#ifndef portMEMORY_BARRIER
+	#define portMEMORY_BARRIER()
+#endif
+
 #ifndef pvPortMallocAligned
 	#define pvPortMallocAligned( x, puxStackBuffer ) ( ( ( puxStackBuffer ) == NULL ) ? ( pvPortMalloc( ( x ) ) ) : ( puxStackBuffer ) )
 #endif
@@ -589,6 +783,38 @@ typedef portBASE_TYPE (*pdTASK_HOOK_CODE)( void * );
 	#define configUSE_TIME_SLICING 1
 #endif
 
+#ifndef configUSE_TASK_TIME_SLICES
+	#define configUSE_TASK_TIME_SLICES 0
+#endif
+
+#ifndef configDEFAULT_TIME_SLICE_TICKS
+	#define configDEFAULT_TIME_SLICE_TICKS 1
+#endif
+
+#if ( ( configUSE_TASK_TIME_SLICES == 1 ) && ( configUSE_TIME_SLICING != 1 ) )
+	#error configUSE_TASK_TIME_SLICES sets the length of the time slices so configUSE_TIME_SLICING must also be 1.
+#endif
+
+#ifndef configUSE_HIGH_RES_DELAYS
+	#define configUSE_HIGH_RES_DELAYS 0
+#endif
+
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+
+	#ifndef portGET_HIGH_RES_TIME
+		#error configUSE_HIGH_RES_DELAYS is 1 but the port does not define portGET_HIGH_RES_TIME().
+	#endif
+
+	#ifndef portSET_HIGH_RES_ALARM
+		#error configUSE_HIGH_RES_DELAYS is 1 but the port does not define portSET_HIGH_RES_ALARM().
+	#endif
+
+	#ifndef portHIGH_RES_COUNTS_PER_US
+		#error configUSE_HIGH_RES_DELAYS is 1 but the port does not define portHIGH_RES_COUNTS_PER_US.
+	#endif
+
+#endif /* configUSE_HIGH_RES_DELAYS */
+
 #ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
 	#define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS 0
 #endif
@@ -601,10 +827,309 @@ typedef portBASE_TYPE (*pdTASK_HOOK_CODE)( void * );
 	#define configUSE_STATS_FORMATTING_FUNCTIONS 0
 #endif
 
+#ifndef configUSE_TASK_NOTIFICATIONS
+	#define configUSE_TASK_NOTIFICATIONS 1
+#endif
+
+#ifndef configUSE_TIMING_WHEEL
+	#define configUSE_TIMING_WHEEL 0
+#endif
+
+#if ( configUSE_TIMING_WHEEL == 1 )
+
+	#ifndef configTIMING_WHEEL_SLOT_BITS
+		#define configTIMING_WHEEL_SLOT_BITS 6
+	#endif
+
+	#ifndef configTIMING_WHEEL_LEVELS
+		#if ( configUSE_16_BIT_TICKS == 1 )
+			#define configTIMING_WHEEL_LEVELS 2
+		#else
+			#define configTIMING_WHEEL_LEVELS 4
+		#endif
+	#endif
+
+	#if ( configUSE_16_BIT_TICKS == 1 )
+		#if ( ( configTIMING_WHEEL_SLOT_BITS * configTIMING_WHEEL_LEVELS ) > 16 )
+			#error configTIMING_WHEEL_SLOT_BITS * configTIMING_WHEEL_LEVELS must not exceed the number of bits in portTickType.
+		#endif
+	#else
+		#if ( ( configTIMING_WHEEL_SLOT_BITS * configTIMING_WHEEL_LEVELS ) > 32 )
+			#error configTIMING_WHEEL_SLOT_BITS * configTIMING_WHEEL_LEVELS must not exceed the number of bits in portTickType.
+		#endif
+	#endif
+
+#endif /* configUSE_TIMING_WHEEL */
+
+/* The tick count the scheduler starts from.  Starting close to the overflow
+lets code that handles the tick count wrapping be tested without waiting for
+it. */
+#ifndef configINITIAL_TICK_COUNT
+	#define configINITIAL_TICK_COUNT 0
+#endif
+
+#ifndef configUSE_64_BIT_TICKS
+	#define configUSE_64_BIT_TICKS 0
+#endif
+
+#if ( configUSE_64_BIT_TICKS == 1 )
+
+	#if ( configUSE_16_BIT_TICKS == 1 )
+		#error configUSE_64_BIT_TICKS and configUSE_16_BIT_TICKS cannot both be set to 1.
+	#endif
+
+	#if ( configUSE_TIMING_WHEEL == 1 )
+		#error configUSE_64_BIT_TICKS replaces the overflow list of the sorted delayed list, so configUSE_TIMING_WHEEL must be 0.
+	#endif
+
+	/* The kernel counts ticks in 64 bits, which will not overflow in the life
+	of any system.  portTickType keeps the width the port gives it, so block
+	times and the tick count returned by xTaskGetTickCount() are unchanged. */
+	typedef unsigned long long portTick64Type;
+
+#endif /* configUSE_64_BIT_TICKS */
+
 #ifndef portASSERT_IF_INTERRUPT_PRIORITY_INVALID
 	#define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()
 #endif
 
+#ifndef configSUPPORT_STATIC_ALLOCATION
+	/* Defaults to 0 for backward compatibility. */
+	#define configSUPPORT_STATIC_ALLOCATION 0
+#endif
+
+#ifndef configUSE_EDF_SCHEDULING
+	#define configUSE_EDF_SCHEDULING 0
+#endif
+
+#ifndef configNUM_CORES
+	#define configNUM_CORES 1
+#endif
+
+#if ( configNUM_CORES > 1 )
+
+	/* A port that can run tasks on more than one core must say which core the
+	caller is running on, be able to interrupt another core so it reschedules,
+	and provide an interrupt mask and a kernel lock that can be taken apart. */
+	#ifndef portGET_CORE_ID
+		#error configNUM_CORES is greater than 1 but the port does not define portGET_CORE_ID().  The port does not support multiple cores.
+	#endif
+
+	#ifndef portYIELD_CORE
+		#error configNUM_CORES is greater than 1 but the port does not define portYIELD_CORE().
+	#endif
+
+	#ifndef portSET_INTERRUPT_MASK
+		#error configNUM_CORES is greater than 1 but the port does not define portSET_INTERRUPT_MASK() and portCLEAR_INTERRUPT_MASK().
+	#endif
+
+	#ifndef portGET_KERNEL_LOCK
+		#error configNUM_CORES is greater than 1 but the port does not define portGET_KERNEL_LOCK() and portRELEASE_KERNEL_LOCK().
+	#endif
+
+	#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION != 0 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION must be 0 when configNUM_CORES is greater than 1.
+	#endif
+
+	#if ( configUSE_TICKLESS_IDLE != 0 )
+		#error configUSE_TICKLESS_IDLE must be 0 when configNUM_CORES is greater than 1.
+	#endif
+
+	#if ( configGENERATE_RUN_TIME_STATS != 0 )
+		#error configGENERATE_RUN_TIME_STATS must be 0 when configNUM_CORES is greater than 1.
+	#endif
+
+	#if ( configUSE_EDF_SCHEDULING != 0 )
+		#error configUSE_EDF_SCHEDULING must be 0 when configNUM_CORES is greater than 1.
+	#endif
+
+#else
+
+	#ifndef portGET_CORE_ID
+		#define portGET_CORE_ID() ( ( portBASE_TYPE ) 0 )
+	#endif
+
+#endif /* configNUM_CORES */
+
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real structures used by FreeRTOS to maintain the
+ * state of tasks, queues, semaphores and software timers are not accessible to
+ * the application code.  However, if the application writer wants to statically
+ * allocate such an object then the size of the object needs to be known.  Dummy
+ * structures that are guaranteed to have the same size and alignment
+ * requirements of the real objects are used for this purpose.  The dummy list
+ * and list item structures below are used for inclusion in such a dummy
+ * structure.
+ *
+ * The dummy structures mirror the members of the real structures one for one,
+ * including the members that depend on configuration options, so any member
+ * added to a kernel object must also be added to its dummy here.  The *Static()
+ * create functions check the two sizes match.
+ */
+struct xSTATIC_LIST_ITEM
+{
+	#if ( configUSE_64_BIT_TICKS == 1 )
+		portTick64Type xDummy1;
+	#else
+		portTickType xDummy1;
+	#endif
+	void *pvDummy2[ 4 ];
+};
+typedef struct xSTATIC_LIST_ITEM xStaticListItem;
+
+struct xSTATIC_MINI_LIST_ITEM
+{
+	#if ( configUSE_64_BIT_TICKS == 1 )
+		portTick64Type xDummy1;
+	#else
+		portTickType xDummy1;
+	#endif
+	void *pvDummy2[ 2 ];
+};
+typedef struct xSTATIC_MINI_LIST_ITEM xStaticMiniListItem;
+
+typedef struct xSTATIC_LIST
+{
+	unsigned portBASE_TYPE uxDummy1;
+	void *pvDummy2;
+	xStaticMiniListItem xDummy3;
+} xStaticList;
+
+/*
+ * See the comments above the xSTATIC_LIST_ITEM definition.  xStaticTask has
+ * the same size and alignment as the TCB used by tasks.c, and is the type of
+ * the buffer passed to xTaskCreateStatic().
+ */
+typedef struct xSTATIC_TCB
+{
+	void				*pxDummy1;
+	#if ( portUSING_MPU_WRAPPERS == 1 )
+		xMPU_SETTINGS	xDummy2;
+	#endif
+	xStaticListItem		xDummy3[ 2 ];
+	unsigned portBASE_TYPE uxDummy5;
+	void				*pxDummy6;
+	signed char			ucDummy7[ configMAX_TASK_NAME_LEN ];
+	#if ( portSTACK_GROWTH > 0 )
+		void			*pxDummy8;
+	#endif
+	#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+		unsigned portBASE_TYPE uxDummy9;
+	#endif
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		unsigned portBASE_TYPE uxDummy10[ 2 ];
+	#endif
+	#if ( configUSE_MUTEXES == 1 )
+		unsigned portBASE_TYPE uxDummy12;
+		xStaticList		xDummy27;
+		void			*pvDummy28;
+	#endif
+	#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+		unsigned portBASE_TYPE uxDummy26;
+	#endif
+	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+		void			*pxDummy14;
+	#endif
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		unsigned long long	ullDummy16;
+	#endif
+	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+		unsigned long	ulDummy18;
+		enum { eDummy19a, eDummy19b, eDummy19c } eDummy19;
+	#endif
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+		unsigned char	ucDummy20;
+	#endif
+	#if ( configNUM_CORES > 1 )
+		portBASE_TYPE	xDummy21;
+	#endif
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		portTickType	xDummy22[ 2 ];
+	#endif
+	#if ( configUSE_TASK_TIME_SLICES == 1 )
+		portTickType	xDummy29[ 2 ];
+	#endif
+	#if ( configUSE_HIGH_RES_DELAYS == 1 )
+		unsigned long	ulDummy30;
+	#endif
+	#if ( configTASK_POOL_SIZE > 0 )
+		unsigned short	usDummy25;
+	#endif
+	#if ( configRECORD_WAKE_LATENCY == 1 )
+		void			*pvDummy23;
+		unsigned long	ulDummy24;
+	#endif
+	#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		struct _reent	xDummy17;
+	#endif
+} xStaticTask;
+
+/*
+ * See the comments above the xSTATIC_LIST_ITEM definition.  xStaticQueue has
+ * the same size and alignment as the queue structure used by queue.c, and is
+ * the type of the buffer passed to xQueueCreateStatic().  Semaphores are
+ * queues, so xStaticSemaphore is the same type.
+ */
+typedef struct xSTATIC_QUEUE
+{
+	void *pvDummy1[ 3 ];
+
+	union
+	{
+		void *pvDummy2;
+		unsigned portBASE_TYPE uxDummy2;
+	} u;
+
+	xStaticList xDummy3[ 2 ];
+	unsigned portBASE_TYPE uxDummy4[ 3 ];
+	signed portBASE_TYPE xDummy5[ 2 ];
+
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+		unsigned char ucDummy6;
+	#endif
+
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		unsigned char ucDummy7[ 2 ];
+	#endif
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+		void *pvDummy8;
+	#endif
+
+	#if ( configUSE_MUTEXES == 1 )
+		xStaticListItem xDummy10;
+	#endif
+
+	#if ( configUSE_READ_WRITE_LOCKS == 1 )
+		xStaticListItem xDummy11;
+	#endif
+
+	#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+		unsigned portBASE_TYPE uxDummy9[ 2 ];
+	#endif
+
+} xStaticQueue;
+typedef xStaticQueue xStaticSemaphore;
+
+/*
+ * See the comments above the xSTATIC_LIST_ITEM definition.  xStaticTimer has
+ * the same size and alignment as the timer structure used by timers.c, and is
+ * the type of the buffer passed to xTimerCreateStatic().
+ */
+typedef struct xSTATIC_TIMER
+{
+	void				*pvDummy1;
+	xStaticListItem		xDummy2;
+	portTickType		xDummy3;
+	unsigned portBASE_TYPE uxDummy4;
+	void				*pvDummy5;
+	pdTASK_CODE			pvDummy6;
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+		unsigned char	ucDummy7;
+	#endif
+} xStaticTimer;
+
 /* For backward compatability. */
 #define eTaskStateGet eTaskGetState
 
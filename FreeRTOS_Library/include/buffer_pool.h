@@ -0,0 +1,393 @@
+/*
+    FreeRTOS V7.5.2 - Copyright (C) 2013 Real Time Engineers Ltd.
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * A buffer pool is a fixed number of blocks of one fixed size, allocated once
+ * when the pool is created.  A task or interrupt acquires a free block, fills
+ * it, and passes the block's address to the consumer, which releases the block
+ * back to the pool once it has finished with it.  Acquiring and releasing a
+ * block takes the same time whatever the block size, and the heap is not used
+ * after the pool has been created.
+ *
+ * A buffer channel is a queue whose items are the addresses of blocks.  Sending
+ * a block through a channel copies one pointer, however large the block is, so
+ * the data written into the block by the producer is read in place by the
+ * consumer.  Ownership of a block passes with its address: after a block has
+ * been sent the sender must not access it again, and the task that receives it
+ * is the one that must release it.  A channel is an ordinary queue, so it can
+ * have any number of writers and readers and can be added to a queue set.
+ *
+ * The free blocks of a pool are themselves held in a queue, so a task that
+ * calls pvBufferPoolAcquire() when no block is free can block until another
+ * task releases one.
+ *
+ * Passing a block therefore takes four queue operations - acquire, send,
+ * receive and release - where sending the data itself through a queue takes
+ * two plus two copies of it.  A channel only pays off for data large enough
+ * that the two copies cost more than the two extra queue operations.  On the
+ * POSIX host that is above 16K bytes; below it a plain queue is faster.  The
+ * "record by copy" and "record by pointer" lines of SimpleDemo/Benchmark.c
+ * show where the two cross on the target.
+ */
+
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include buffer_pool.h"
+#endif
+
+#include "queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Type by which buffer pools are referenced.  For example, a call to
+ * xBufferPoolCreate() returns an xBufferPoolHandle variable that can then be
+ * used as a parameter to pvBufferPoolAcquire(), vBufferPoolRelease(), etc.
+ */
+typedef void * xBufferPoolHandle;
+
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+xBufferPoolHandle xBufferPoolCreate( unsigned portBASE_TYPE uxBlockCount, size_t xBlockSize );
+</pre>
+ *
+ * Creates a new buffer pool using dynamically allocated memory.  The pool
+ * structure and all of its blocks are allocated as a single block of heap, and
+ * the queue that holds the free blocks is allocated as a second one.
+ *
+ * @param uxBlockCount The number of blocks in the pool.
+ *
+ * @param xBlockSize The number of bytes in each block.  Every block starts on
+ * a portBYTE_ALIGNMENT boundary, so a block can hold any structure.
+ *
+ * @return If NULL is returned, then the pool cannot be created because there
+ * is insufficient heap memory available.  A non-NULL value being returned
+ * indicates that the pool has been created successfully - the returned value
+ * should be stored as the handle to the created pool.
+ *
+ * Example use:
+<pre>
+
+struct AMessage
+{
+	char ucMessageID;
+	char ucData[ 100 ];
+};
+
+xBufferPoolHandle xPool;
+xQueueHandle xChannel;
+
+void vATask( void *pvParameters )
+{
+struct AMessage *pxMessage;
+
+	// Create a pool of 4 messages, and a channel that can hold all of them.
+	xPool = xBufferPoolCreate( 4, sizeof( struct AMessage ) );
+	xChannel = xBufferChannelCreate( 4 );
+
+	// Take a free message, fill it in and pass it on.  The 100 bytes of data
+	// are not copied again.
+	pxMessage = ( struct AMessage * ) pvBufferPoolAcquire( xPool, portMAX_DELAY );
+	pxMessage->ucMessageID = 1;
+	xBufferChannelSend( xChannel, pxMessage, portMAX_DELAY );
+}
+
+void vAnotherTask( void *pvParameters )
+{
+struct AMessage *pxMessage;
+
+	for( ;; )
+	{
+		// Use the message where the sender wrote it, then give it back.
+		pxMessage = ( struct AMessage * ) pvBufferChannelReceive( xChannel, portMAX_DELAY );
+		vProcessMessage( pxMessage );
+		vBufferPoolRelease( xPool, pxMessage );
+	}
+}
+</pre>
+ * \defgroup xBufferPoolCreate xBufferPoolCreate
+ * \ingroup BufferPoolManagement
+ */
+xBufferPoolHandle xBufferPoolCreate( unsigned portBASE_TYPE uxBlockCount, size_t xBlockSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+void vBufferPoolDelete( xBufferPoolHandle xPool );
+</pre>
+ *
+ * Deletes a pool that was created by xBufferPoolCreate(), freeing its memory.
+ * No block may still be in use, and no task may be blocked on the pool.
+ *
+ * @param xPool The handle of the pool to delete.
+ *
+ * \defgroup vBufferPoolDelete vBufferPoolDelete
+ * \ingroup BufferPoolManagement
+ */
+void vBufferPoolDelete( xBufferPoolHandle xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+void *pvBufferPoolAcquire( xBufferPoolHandle xPool, portTickType xTicksToWait );
+</pre>
+ *
+ * Takes a free block from a pool.  The block belongs to the caller until it is
+ * released or sent through a buffer channel.  Its contents are whatever its
+ * last user left in it.
+ *
+ * Use pvBufferPoolAcquire() from a task.  Use pvBufferPoolAcquireFromISR() from
+ * an interrupt service routine.
+ *
+ * @param xPool The handle of the pool to take a block from.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for a block to be released if none is free.
+ *
+ * @return The address of the block, or NULL if no block became free before
+ * xTicksToWait expired.
+ *
+ * \defgroup pvBufferPoolAcquire pvBufferPoolAcquire
+ * \ingroup BufferPoolManagement
+ */
+void *pvBufferPoolAcquire( xBufferPoolHandle xPool, portTickType xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+void *pvBufferPoolAcquireFromISR( xBufferPoolHandle xPool, portBASE_TYPE *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * A version of pvBufferPoolAcquire() that can be called from an interrupt
+ * service routine.  It never blocks.
+ *
+ * @param xPool The handle of the pool to take a block from.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if taking the block unblocked
+ * a task of higher priority than the interrupted task, in which case a context
+ * switch should be requested before the interrupt is exited.
+ *
+ * @return The address of the block, or NULL if no block was free.
+ *
+ * \defgroup pvBufferPoolAcquireFromISR pvBufferPoolAcquireFromISR
+ * \ingroup BufferPoolManagement
+ */
+void *pvBufferPoolAcquireFromISR( xBufferPoolHandle xPool, portBASE_TYPE *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+void vBufferPoolRelease( xBufferPoolHandle xPool, void *pvBlock );
+</pre>
+ *
+ * Returns a block to the pool it was taken from.  The caller must not access
+ * the block again.  If a task is blocked in pvBufferPoolAcquire() the block is
+ * handed to it.  Releasing never blocks, as the pool always has room for all
+ * of its own blocks.  configASSERT() is called if pvBlock is not a block of the
+ * pool or is not currently acquired, for example because it has already been
+ * released.
+ *
+ * @param xPool The handle of the pool the block was taken from.
+ *
+ * @param pvBlock The address returned by pvBufferPoolAcquire() or
+ * pvBufferPoolAcquireFromISR().
+ *
+ * \defgroup vBufferPoolRelease vBufferPoolRelease
+ * \ingroup BufferPoolManagement
+ */
+void vBufferPoolRelease( xBufferPoolHandle xPool, void *pvBlock ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+void vBufferPoolReleaseFromISR( xBufferPoolHandle xPool, void *pvBlock, portBASE_TYPE *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * A version of vBufferPoolRelease() that can be called from an interrupt
+ * service routine.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if releasing the block
+ * unblocked a task of higher priority than the interrupted task, in which case
+ * a context switch should be requested before the interrupt is exited.
+ *
+ * \defgroup vBufferPoolReleaseFromISR vBufferPoolReleaseFromISR
+ * \ingroup BufferPoolManagement
+ */
+void vBufferPoolReleaseFromISR( xBufferPoolHandle xPool, void *pvBlock, portBASE_TYPE *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+unsigned portBASE_TYPE uxBufferPoolBlocksAvailable( xBufferPoolHandle xPool );
+</pre>
+ *
+ * @return The number of blocks in the pool that are free.
+ *
+ * \defgroup uxBufferPoolBlocksAvailable uxBufferPoolBlocksAvailable
+ * \ingroup BufferPoolManagement
+ */
+unsigned portBASE_TYPE uxBufferPoolBlocksAvailable( xBufferPoolHandle xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+xQueueHandle xBufferChannelCreate( unsigned portBASE_TYPE uxLength );
+</pre>
+ *
+ * Creates a buffer channel, a queue that can hold the addresses of up to
+ * uxLength blocks.  A channel that is as long as the pool whose blocks it
+ * carries can never be full while its senders hold a block, so sending to it
+ * never has to block.
+ *
+ * A channel is deleted with vQueueDelete().
+ *
+ * \defgroup xBufferChannelCreate xBufferChannelCreate
+ * \ingroup BufferPoolManagement
+ */
+#define xBufferChannelCreate( uxLength ) xQueueCreate( ( uxLength ), ( unsigned portBASE_TYPE ) sizeof( void * ) )
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+portBASE_TYPE xBufferChannelSend( xQueueHandle xChannel, void *pvBlock, portTickType xTicksToWait );
+</pre>
+ *
+ * Passes a block to the task that receives from the channel.  Only the
+ * address of the block is copied.  Once the block has been sent the sender
+ * must not access it again.
+ *
+ * @param xChannel The handle of the channel, as returned by
+ * xBufferChannelCreate().
+ *
+ * @param pvBlock The block to pass on.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for space in the channel if it is full.
+ *
+ * @return pdPASS if the block was sent, otherwise errQUEUE_FULL, in which case
+ * the caller still owns the block.
+ *
+ * \defgroup xBufferChannelSend xBufferChannelSend
+ * \ingroup BufferPoolManagement
+ */
+portBASE_TYPE xBufferChannelSend( xQueueHandle xChannel, void *pvBlock, portTickType xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+portBASE_TYPE xBufferChannelSendFromISR( xQueueHandle xChannel, void *pvBlock, portBASE_TYPE *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * A version of xBufferChannelSend() that can be called from an interrupt
+ * service routine.  It never blocks.
+ *
+ * \defgroup xBufferChannelSendFromISR xBufferChannelSendFromISR
+ * \ingroup BufferPoolManagement
+ */
+portBASE_TYPE xBufferChannelSendFromISR( xQueueHandle xChannel, void *pvBlock, portBASE_TYPE *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *
+<pre>
+void *pvBufferChannelReceive( xQueueHandle xChannel, portTickType xTicksToWait );
+</pre>
+ *
+ * Receives the next block sent through a channel.  The block then belongs to
+ * the caller, which must release it to its pool once it has finished with it.
+ *
+ * @param xChannel The handle of the channel.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for a block if the channel is empty.
+ *
+ * @return The address of the block, or NULL if no block was sent before
+ * xTicksToWait expired.
+ *
+ * \defgroup pvBufferChannelReceive pvBufferChannelReceive
+ * \ingroup BufferPoolManagement
+ */
+void *pvBufferChannelReceive( xQueueHandle xChannel, portTickType xTicksToWait ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* !defined( BUFFER_POOL_H ) */
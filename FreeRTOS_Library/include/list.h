@@ -126,6 +126,20 @@
 	#define configLIST_VOLATILE
 #endif /* configSUPPORT_CROSS_MODULE_OPTIMISATION */
 
+/*
+ * The type of the value a list item holds, and the value of the marker at the
+ * end of every list.  When configUSE_64_BIT_TICKS is 1 the delayed task and
+ * active timer lists are sorted on 64 bit wake times, so item values are 64
+ * bits wide.
+ */
+#if ( configUSE_64_BIT_TICKS == 1 )
+	#define listITEM_VALUE_TYPE		portTick64Type
+	#define listMAX_ITEM_VALUE		( ( portTick64Type ) 0xffffffffffffffffULL )
+#else
+	#define listITEM_VALUE_TYPE		portTickType
+	#define listMAX_ITEM_VALUE		portMAX_DELAY
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -134,7 +148,7 @@ extern "C" {
  */
 struct xLIST_ITEM
 {
-	configLIST_VOLATILE portTickType xItemValue;	/*< The value being listed.  In most cases this is used to sort the list in descending order. */
+	configLIST_VOLATILE listITEM_VALUE_TYPE xItemValue;	/*< The value being listed.  In most cases this is used to sort the list in descending order. */
 	struct xLIST_ITEM * configLIST_VOLATILE pxNext;	/*< Pointer to the next xListItem in the list. */
 	struct xLIST_ITEM * configLIST_VOLATILE pxPrevious;/*< Pointer to the previous xListItem in the list. */
 	void * pvOwner;									/*< Pointer to the object (normally a TCB) that contains the list item.  There is therefore a two way link between the object containing the list item and the list item itself. */
@@ -144,7 +158,7 @@ typedef struct xLIST_ITEM xListItem;				/* For some reason lint wants this as tw
 
 struct xMINI_LIST_ITEM
 {
-	configLIST_VOLATILE portTickType xItemValue;
+	configLIST_VOLATILE listITEM_VALUE_TYPE xItemValue;
 	struct xLIST_ITEM * configLIST_VOLATILE pxNext;
 	struct xLIST_ITEM * configLIST_VOLATILE pxPrevious;
 };
@@ -293,10 +307,10 @@ xList * const pxConstList = ( pxList );														\
 
 /*
  * This provides a crude means of knowing if a list has been initialised, as
- * pxList->xListEnd.xItemValue is set to portMAX_DELAY by the vListInitialise()
- * function.
+ * pxList->xListEnd.xItemValue is set to listMAX_ITEM_VALUE by the
+ * vListInitialise() function.
  */
-#define listLIST_IS_INITIALISED( pxList ) ( ( pxList )->xListEnd.xItemValue == portMAX_DELAY )
+#define listLIST_IS_INITIALISED( pxList ) ( ( pxList )->xListEnd.xItemValue == listMAX_ITEM_VALUE )
 
 /*
  * Must be called before a list is used!  This initialises all the members
@@ -0,0 +1,344 @@
+/*
+    FreeRTOS V7.5.2 - Copyright (C) 2013 Real Time Engineers Ltd.
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Message buffers build functionality on top of FreeRTOS stream buffers.
+ * Whereas stream buffers are used to send a continuous stream of data from one
+ * task or interrupt to another, message buffers are used to send variable
+ * length discrete messages from one task or interrupt to another.  Their
+ * implementation is light weight, making them particularly suited for interrupt
+ * to task and core to core communication scenarios.
+ *
+ * Each message is copied into the buffer once, preceded by its length (which
+ * occupies sizeof( size_t ) bytes of the buffer), and copied out once by the
+ * reader.  No heap is used per message, and the sender's copy of the data can
+ * be reused as soon as the send function returns.
+ *
+ * ***NOTE***:  As with stream buffers, the message buffer implementation
+ * assumes there is only one task or interrupt that will write to the buffer
+ * (the writer), and only one task or interrupt that will read from the buffer
+ * (the reader).  If there are to be multiple different writers then the
+ * application writer must place each call to a writing API function (such as
+ * xMessageBufferSend()) inside a critical section and set the send block time
+ * to 0.  Likewise, if there are to be multiple different readers then the
+ * application writer must place each call to a reading API function (such as
+ * xMessageBufferReceive()) inside a critical section and set the receive block
+ * time to 0.
+ */
+
+#ifndef MESSAGE_BUFFER_H
+#define MESSAGE_BUFFER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include message_buffer.h"
+#endif
+
+/* Message buffers are built on top of stream buffers. */
+#include "stream_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Type by which message buffers are referenced.  For example, a call to
+ * xMessageBufferCreate() returns an xMessageBufferHandle variable that can
+ * then be used as a parameter to xMessageBufferSend(), xMessageBufferReceive(),
+ * etc.
+ */
+typedef void * xMessageBufferHandle;
+
+/**
+ * message_buffer.h
+ *
+<pre>
+xMessageBufferHandle xMessageBufferCreate( size_t xBufferSizeBytes );
+</pre>
+ *
+ * Creates a new message buffer using dynamically allocated memory.
+ *
+ * @param xBufferSizeBytes The total number of bytes (not messages) the message
+ * buffer will be able to hold at any one time.  When a message is written to
+ * the message buffer an additional sizeof( size_t ) bytes are also written to
+ * store the message's length.  sizeof( size_t ) is typically 4 bytes on a
+ * 32-bit architecture, so on most 32-bit architectures a 10 byte message will
+ * take up 14 bytes of message buffer space.
+ *
+ * @return If NULL is returned, then the message buffer cannot be created
+ * because there is insufficient heap memory available for FreeRTOS to allocate
+ * the message buffer data structures and storage area.  A non-NULL value being
+ * returned indicates that the message buffer has been created successfully -
+ * the returned value should be stored as the handle to the created message
+ * buffer.
+ *
+ * \defgroup xMessageBufferCreate xMessageBufferCreate
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferCreate( xBufferSizeBytes ) ( xMessageBufferHandle ) xStreamBufferGenericCreate( xBufferSizeBytes, ( size_t ) 0, pdTRUE )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferSend( xMessageBufferHandle xMessageBuffer,
+						   const void *pvTxData,
+						   size_t xDataLengthBytes,
+						   portTickType xTicksToWait );
+</pre>
+ *
+ * Sends a discrete message to the message buffer.  The message can be any
+ * length that fits within the buffer's free space, and is copied into the
+ * buffer.  Use xMessageBufferSendFromISR() to write to a message buffer from an
+ * interrupt service routine (ISR).
+ *
+ * @param xMessageBuffer The handle of the message buffer to which a message is
+ * being sent.
+ *
+ * @param pvTxData A pointer to the message that is to be copied into the
+ * message buffer.
+ *
+ * @param xDataLengthBytes The length of the message.  That is, the number of
+ * bytes to copy from pvTxData into the message buffer.  The message buffer
+ * also stores the length, so xDataLengthBytes + sizeof( size_t ) bytes of
+ * free space are needed.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should remain
+ * in the Blocked state to wait for enough space to become available in the
+ * message buffer.  A message that can never fit in the buffer fails without
+ * blocking.
+ *
+ * @return The number of bytes written to the message buffer.  This is either
+ * xDataLengthBytes if the whole message was written, or 0 if the call timed
+ * out - a message is never written in part.
+ *
+ * \defgroup xMessageBufferSend xMessageBufferSend
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSend( xMessageBuffer, pvTxData, xDataLengthBytes, xTicksToWait ) xStreamBufferSend( ( xStreamBufferHandle ) xMessageBuffer, pvTxData, xDataLengthBytes, xTicksToWait )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferSendFromISR( xMessageBufferHandle xMessageBuffer,
+								  const void *pvTxData,
+								  size_t xDataLengthBytes,
+								  portBASE_TYPE *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of xMessageBufferSend().  Writes the whole message,
+ * or nothing if there is not enough free space.  *pxHigherPriorityTaskWoken is
+ * set to pdTRUE if writing the message unblocked a task with a priority above
+ * that of the interrupted task, in which case a context switch should be
+ * requested before the interrupt exits.
+ *
+ * @return The number of bytes written, either xDataLengthBytes or 0.
+ *
+ * \defgroup xMessageBufferSendFromISR xMessageBufferSendFromISR
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendFromISR( xMessageBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferSendFromISR( ( xStreamBufferHandle ) xMessageBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferReceive( xMessageBufferHandle xMessageBuffer,
+							  void *pvRxData,
+							  size_t xBufferLengthBytes,
+							  portTickType xTicksToWait );
+</pre>
+ *
+ * Receives a discrete message from a message buffer.  Use
+ * xMessageBufferReceiveFromISR() to read from a message buffer from an
+ * interrupt service routine (ISR).
+ *
+ * @param xMessageBuffer The handle of the message buffer from which a message
+ * is being received.
+ *
+ * @param pvRxData A pointer to the buffer into which the received message is
+ * to be copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by pvRxData.
+ * If the next message is longer than this it is left in the message buffer and
+ * 0 is returned.  xMessageBufferNextLengthBytes() returns the length of the
+ * next message.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for a message, should the message buffer be empty.
+ *
+ * @return The length, in bytes, of the message read from the message buffer,
+ * if any.  0 if the call timed out or the next message did not fit.
+ *
+ * \defgroup xMessageBufferReceive xMessageBufferReceive
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceive( xMessageBuffer, pvRxData, xBufferLengthBytes, xTicksToWait ) xStreamBufferReceive( ( xStreamBufferHandle ) xMessageBuffer, pvRxData, xBufferLengthBytes, xTicksToWait )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferReceiveFromISR( xMessageBufferHandle xMessageBuffer,
+									 void *pvRxData,
+									 size_t xBufferLengthBytes,
+									 portBASE_TYPE *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of xMessageBufferReceive().
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if freeing the space unblocked a
+ * writer with a priority above that of the interrupted task.
+ *
+ * @return The length, in bytes, of the message read, or 0.
+ *
+ * \defgroup xMessageBufferReceiveFromISR xMessageBufferReceiveFromISR
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferReceiveFromISR( ( xStreamBufferHandle ) xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+void vMessageBufferDelete( xMessageBufferHandle xMessageBuffer );
+</pre>
+ *
+ * Deletes a message buffer that was previously created using a call to
+ * xMessageBufferCreate(), freeing its memory.  A message buffer handle must
+ * not be used after the message buffer has been deleted.
+ *
+ * \defgroup vMessageBufferDelete vMessageBufferDelete
+ * \ingroup MessageBufferManagement
+ */
+#define vMessageBufferDelete( xMessageBuffer ) vStreamBufferDelete( ( xStreamBufferHandle ) xMessageBuffer )
+
+/**
+ * message_buffer.h
+<pre>
+portBASE_TYPE xMessageBufferIsFull( xMessageBufferHandle xMessageBuffer );
+portBASE_TYPE xMessageBufferIsEmpty( xMessageBufferHandle xMessageBuffer );
+</pre>
+ *
+ * Query whether a message buffer is full or empty.  A message buffer is
+ * reported as full only if there is no free space at all - a buffer that is
+ * not full can still be too full to accept a particular message.
+ *
+ * \defgroup xMessageBufferIsFull xMessageBufferIsFull
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferIsFull( xMessageBuffer ) xStreamBufferIsFull( ( xStreamBufferHandle ) xMessageBuffer )
+#define xMessageBufferIsEmpty( xMessageBuffer ) xStreamBufferIsEmpty( ( xStreamBufferHandle ) xMessageBuffer )
+
+/**
+ * message_buffer.h
+<pre>
+portBASE_TYPE xMessageBufferReset( xMessageBufferHandle xMessageBuffer );
+</pre>
+ *
+ * Resets a message buffer to its initial empty state, discarding any messages
+ * it contained.  A message buffer can only be reset if there are no tasks
+ * blocked on it.
+ *
+ * @return pdPASS if the message buffer was reset, otherwise pdFAIL.
+ *
+ * \defgroup xMessageBufferReset xMessageBufferReset
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReset( xMessageBuffer ) xStreamBufferReset( ( xStreamBufferHandle ) xMessageBuffer )
+
+/**
+ * message_buffer.h
+<pre>
+size_t xMessageBufferSpaceAvailable( xMessageBufferHandle xMessageBuffer );
+</pre>
+ *
+ * Returns the number of bytes of free space in the message buffer.  The
+ * largest message that can currently be sent is sizeof( size_t ) bytes
+ * shorter than the value returned.
+ *
+ * \defgroup xMessageBufferSpaceAvailable xMessageBufferSpaceAvailable
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSpaceAvailable( xMessageBuffer ) xStreamBufferSpacesAvailable( ( xStreamBufferHandle ) xMessageBuffer )
+
+/**
+ * message_buffer.h
+<pre>
+size_t xMessageBufferNextLengthBytes( xMessageBufferHandle xMessageBuffer );
+</pre>
+ *
+ * Returns the length, in bytes, of the next message in the message buffer
+ * without removing it, or 0 if the message buffer is empty.  Must only be
+ * called by the reader.
+ *
+ * \defgroup xMessageBufferNextLengthBytes xMessageBufferNextLengthBytes
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferNextLengthBytes( xMessageBuffer ) xStreamBufferNextMessageLengthBytes( ( xStreamBufferHandle ) xMessageBuffer )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* !defined( MESSAGE_BUFFER_H ) */
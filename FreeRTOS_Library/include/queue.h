@@ -108,6 +108,7 @@ typedef void * xQueueSetMemberHandle;
 #define queueQUEUE_TYPE_COUNTING_SEMAPHORE	( ( unsigned char ) 2U )
 #define queueQUEUE_TYPE_BINARY_SEMAPHORE	( ( unsigned char ) 3U )
 #define queueQUEUE_TYPE_RECURSIVE_MUTEX		( ( unsigned char ) 4U )
+#define queueQUEUE_TYPE_READ_WRITE_LOCK		( ( unsigned char ) 5U )
 
 /**
  * queue. h
@@ -167,6 +168,59 @@ typedef void * xQueueSetMemberHandle;
  */
 #define xQueueCreate( uxQueueLength, uxItemSize ) xQueueGenericCreate( uxQueueLength, uxItemSize, queueQUEUE_TYPE_BASE )
 
+/**
+ * queue. h
+ * <pre>
+ xQueueHandle xQueueCreateStatic(
+							  unsigned portBASE_TYPE uxQueueLength,
+							  unsigned portBASE_TYPE uxItemSize,
+							  unsigned char *pucQueueStorage,
+							  xStaticQueue *pxQueueBuffer
+						  );
+ * </pre>
+ *
+ * Creates a new queue instance using memory supplied by the caller rather
+ * than memory obtained from pvPortMalloc().  Only available when
+ * configSUPPORT_STATIC_ALLOCATION is set to 1 in FreeRTOSConfig.h.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ *
+ * @param pucQueueStorage Must point to an array of at least
+ * ( uxQueueLength * uxItemSize ) bytes.  This is where posted items are
+ * copied.  Can be NULL if uxItemSize is zero.
+ *
+ * @param pxQueueBuffer Must point to a variable of type xStaticQueue, which
+ * will be used to hold the queue's data structure.
+ *
+ * @return If neither pucQueueStorage nor pxQueueBuffer are NULL then a handle
+ * to the created queue is returned, otherwise NULL is returned.
+ *
+ * Example usage:
+   <pre>
+ #define QUEUE_LENGTH	10
+ #define ITEM_SIZE		sizeof( unsigned long )
+
+ static xStaticQueue xQueueBuffer;
+ static unsigned char ucQueueStorage[ QUEUE_LENGTH * ITEM_SIZE ];
+
+ void vATask( void *pvParameters )
+ {
+ xQueueHandle xQueue1;
+
+	xQueue1 = xQueueCreateStatic( QUEUE_LENGTH, ITEM_SIZE, ucQueueStorage, &xQueueBuffer );
+
+	// ... Rest of task code.
+ }
+ </pre>
+ * \defgroup xQueueCreateStatic xQueueCreateStatic
+ * \ingroup QueueManagement
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xQueueCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer ) xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), queueQUEUE_TYPE_BASE )
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
 /**
  * queue. h
  * <pre>
@@ -1405,6 +1459,160 @@ signed portBASE_TYPE xQueueGenericSendFromISR( xQueueHandle xQueue, const void *
  */
 signed portBASE_TYPE xQueueReceiveFromISR( xQueueHandle xQueue, const void * const pvBuffer, signed portBASE_TYPE *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ unsigned portBASE_TYPE xQueueSendMultiple(
+									   xQueueHandle xQueue,
+									   const void * pvItemsToQueue,
+									   unsigned portBASE_TYPE uxItemCount,
+									   portTickType xTicksToWait
+								   );
+ * </pre>
+ *
+ * Post up to uxItemCount items to the back of a queue.  Each pass through
+ * the queue takes as many of the items as there is room for in a single
+ * critical section, copies them with at most two memcpy() calls, and
+ * unblocks the tasks waiting for them together, so sending a batch costs
+ * much less than calling xQueueSend() for each item.  The task only blocks
+ * while the queue is full.
+ *
+ * This function must not be called from an interrupt service routine.
+ * See xQueueSendMultipleFromISR() for an alternative which may be used in an
+ * ISR.  It cannot be used with a mutex.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to an array of uxItemCount items, each of
+ * the size defined when the queue was created.
+ *
+ * @param uxItemCount The number of items to post.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it be full.
+ * Set to 0 to post only the items there is room for now.
+ *
+ * @return The number of items posted.  This is less than uxItemCount only if
+ * xTicksToWait expired before there was room for all of them.  The items
+ * posted are always the first ones in pvItemsToQueue.
+ *
+ * Example usage:
+   <pre>
+ #define LOG_BATCH 8
+
+ void vALoggingTask( void *pvParameters )
+ {
+ struct ALogRecord xRecords[ LOG_BATCH ], xToSend[ LOG_BATCH ];
+ unsigned portBASE_TYPE uxCount;
+
+	for( ;; )
+	{
+		// Take whatever has been logged, waiting for at least one record.
+		uxCount = xQueueReceiveMultiple( xLogQueue, xRecords, LOG_BATCH, portMAX_DELAY );
+
+		// ... format and filter the records into xToSend ...
+
+		// Pass the result on, blocking while the output queue is full.
+		xQueueSendMultiple( xOutputQueue, xToSend, uxCount, portMAX_DELAY );
+	}
+ }
+ </pre>
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+unsigned portBASE_TYPE xQueueSendMultiple( xQueueHandle xQueue, const void * const pvItemsToQueue, unsigned portBASE_TYPE uxItemCount, portTickType xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ unsigned portBASE_TYPE xQueueSendMultipleFromISR(
+									   xQueueHandle xQueue,
+									   const void * pvItemsToQueue,
+									   unsigned portBASE_TYPE uxItemCount,
+									   portBASE_TYPE *pxHigherPriorityTaskWoken
+								   );
+ * </pre>
+ *
+ * A version of xQueueSendMultiple() that can be called from an interrupt
+ * service routine.  It posts as many of the items as there is room for and
+ * never blocks.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if posting the items
+ * unblocked a task of higher priority than the interrupted task, in which
+ * case a context switch should be requested before the interrupt is exited.
+ *
+ * @return The number of items posted.
+ *
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+unsigned portBASE_TYPE xQueueSendMultipleFromISR( xQueueHandle xQueue, const void * const pvItemsToQueue, unsigned portBASE_TYPE uxItemCount, signed portBASE_TYPE *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ unsigned portBASE_TYPE xQueueReceiveMultiple(
+									   xQueueHandle xQueue,
+									   void *pvBuffer,
+									   unsigned portBASE_TYPE uxMaxItems,
+									   portTickType xTicksToWait
+								   );
+ * </pre>
+ *
+ * Receive up to uxMaxItems items from a queue.  The task blocks until the
+ * queue holds at least one item, then takes all of the items there are, up
+ * to uxMaxItems, in a single critical section with at most two memcpy()
+ * calls, and unblocks a task waiting to send for each of them.
+ *
+ * This function must not be called from an interrupt service routine.
+ * See xQueueReceiveMultipleFromISR() for an alternative which may be used in
+ * an ISR.  It cannot be used with a mutex, or with a member of a queue set.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to an array of uxMaxItems items into which the
+ * received items will be copied, oldest first.
+ *
+ * @param uxMaxItems The most items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item should the queue be empty.
+ *
+ * @return The number of items received, or 0 if xTicksToWait expired with
+ * the queue still empty.
+ *
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+unsigned portBASE_TYPE xQueueReceiveMultiple( xQueueHandle xQueue, void * const pvBuffer, unsigned portBASE_TYPE uxMaxItems, portTickType xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ unsigned portBASE_TYPE xQueueReceiveMultipleFromISR(
+									   xQueueHandle xQueue,
+									   void *pvBuffer,
+									   unsigned portBASE_TYPE uxMaxItems,
+									   portBASE_TYPE *pxHigherPriorityTaskWoken
+								   );
+ * </pre>
+ *
+ * A version of xQueueReceiveMultiple() that can be called from an interrupt
+ * service routine.  It takes the items that are in the queue, up to
+ * uxMaxItems, and never blocks.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if receiving the items
+ * unblocked a task of higher priority than the interrupted task, in which
+ * case a context switch should be requested before the interrupt is exited.
+ *
+ * @return The number of items received.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+unsigned portBASE_TYPE xQueueReceiveMultipleFromISR( xQueueHandle xQueue, void * const pvBuffer, unsigned portBASE_TYPE uxMaxItems, signed portBASE_TYPE *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from witin an ISR, or within a critical section.
@@ -1451,11 +1659,21 @@ signed portBASE_TYPE xQueueCRReceive( xQueueHandle xQueue, void *pvBuffer, portT
 
 /*
  * For internal use only.  Use xSemaphoreCreateMutex(),
- * xSemaphoreCreateCounting() or xSemaphoreGetMutexHolder() instead of calling
- * these functions directly.
+ * xSemaphoreCreateMutexWithCeiling(), xSemaphoreCreateCounting() or
+ * xSemaphoreGetMutexHolder() instead of calling these functions directly.
  */
 xQueueHandle xQueueCreateMutex( unsigned char ucQueueType ) PRIVILEGED_FUNCTION;
 xQueueHandle xQueueCreateCountingSemaphore( unsigned portBASE_TYPE uxCountValue, unsigned portBASE_TYPE uxInitialCount ) PRIVILEGED_FUNCTION;
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	xQueueHandle xQueueCreateMutexStatic( unsigned char ucQueueType, xStaticQueue *pxStaticQueue ) PRIVILEGED_FUNCTION;
+	xQueueHandle xQueueCreateCountingSemaphoreStatic( unsigned portBASE_TYPE uxCountValue, unsigned portBASE_TYPE uxInitialCount, xStaticQueue *pxStaticQueue ) PRIVILEGED_FUNCTION;
+#endif
+#if( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+	xQueueHandle xQueueCreateCeilingMutex( unsigned char ucQueueType, unsigned portBASE_TYPE uxCeilingPriority ) PRIVILEGED_FUNCTION;
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		xQueueHandle xQueueCreateCeilingMutexStatic( unsigned char ucQueueType, unsigned portBASE_TYPE uxCeilingPriority, xStaticQueue *pxStaticQueue ) PRIVILEGED_FUNCTION;
+	#endif
+#endif
 void* xQueueGetMutexHolder( xQueueHandle xSemaphore ) PRIVILEGED_FUNCTION;
 
 /*
@@ -1465,6 +1683,20 @@ void* xQueueGetMutexHolder( xQueueHandle xSemaphore ) PRIVILEGED_FUNCTION;
 portBASE_TYPE xQueueTakeMutexRecursive( xQueueHandle xMutex, portTickType xBlockTime ) PRIVILEGED_FUNCTION;
 portBASE_TYPE xQueueGiveMutexRecursive( xQueueHandle pxMutex ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Use xSemaphoreCreateReadWriteLock(),
+ * xSemaphoreTakeRead(), xSemaphoreTakeWrite() and the matching give macros
+ * instead of calling these functions directly.
+ */
+#if( configUSE_READ_WRITE_LOCKS == 1 )
+	xQueueHandle xQueueCreateReadWriteLock( void ) PRIVILEGED_FUNCTION;
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		xQueueHandle xQueueCreateReadWriteLockStatic( xStaticQueue *pxStaticQueue ) PRIVILEGED_FUNCTION;
+	#endif
+	portBASE_TYPE xQueueTakeReadWriteLock( xQueueHandle xLock, portTickType xTicksToWait, portBASE_TYPE xWrite ) PRIVILEGED_FUNCTION;
+	portBASE_TYPE xQueueGiveReadWriteLock( xQueueHandle xLock, portBASE_TYPE xWrite ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Reset a queue back to its original empty state.  pdPASS is returned if the
  * queue is successfully reset.  pdFAIL is returned if the queue could not be
@@ -1517,6 +1749,15 @@ portBASE_TYPE xQueueGiveMutexRecursive( xQueueHandle pxMutex ) PRIVILEGED_FUNCTI
  */
 xQueueHandle xQueueGenericCreate( unsigned portBASE_TYPE uxQueueLength, unsigned portBASE_TYPE uxItemSize, unsigned char ucQueueType ) PRIVILEGED_FUNCTION;
 
+/*
+ * Generic version of the static queue creation function, which is in turn
+ * called by any statically allocated queue, semaphore or mutex creation
+ * function or macro.
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	xQueueHandle xQueueGenericCreateStatic( unsigned portBASE_TYPE uxQueueLength, unsigned portBASE_TYPE uxItemSize, unsigned char *pucQueueStorage, xStaticQueue *pxStaticQueue, unsigned char ucQueueType ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Queue sets provide a mechanism to allow a task to block (pend) on a read
  * operation from multiple queues or semaphores simultaneously.
@@ -125,6 +125,47 @@ typedef xQueueHandle xSemaphoreHandle;
 		}																																		\
 	}
 
+/**
+ * semphr. h
+ * <pre>vSemaphoreCreateBinaryStatic( xSemaphoreHandle xSemaphore, xStaticSemaphore *pxSemaphoreBuffer )</pre>
+ *
+ * As vSemaphoreCreateBinary(), but the semaphore's data structure is held in
+ * the xStaticSemaphore variable pointed to by pxSemaphoreBuffer instead of
+ * being obtained from pvPortMalloc().  Only available when
+ * configSUPPORT_STATIC_ALLOCATION is set to 1 in FreeRTOSConfig.h.
+ *
+ * @param xSemaphore Handle to the created semaphore.  Should be of type xSemaphoreHandle.
+ *
+ * @param pxSemaphoreBuffer Must point to a variable of type xStaticSemaphore
+ * that remains in scope for as long as the semaphore is in use.
+ *
+ * Example usage:
+ <pre>
+ xSemaphoreHandle xSemaphore;
+ static xStaticSemaphore xSemaphoreBuffer;
+
+ void vATask( void * pvParameters )
+ {
+    vSemaphoreCreateBinaryStatic( xSemaphore, &xSemaphoreBuffer );
+
+    // pxSemaphoreBuffer was not NULL so the semaphore was created and can
+    // now be used.
+ }
+ </pre>
+ * \defgroup vSemaphoreCreateBinaryStatic vSemaphoreCreateBinaryStatic
+ * \ingroup Semaphores
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define vSemaphoreCreateBinaryStatic( xSemaphore, pxSemaphoreBuffer )																										\
+		{																																								\
+			( xSemaphore ) = xQueueGenericCreateStatic( ( unsigned portBASE_TYPE ) 1, semSEMAPHORE_QUEUE_ITEM_LENGTH, NULL, ( pxSemaphoreBuffer ), queueQUEUE_TYPE_BINARY_SEMAPHORE );	\
+			if( ( xSemaphore ) != NULL )																																\
+			{																																							\
+				( void ) xSemaphoreGive( ( xSemaphore ) );																												\
+			}																																							\
+		}
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
 /**
  * semphr. h
  * <pre>xSemaphoreTake( 
@@ -633,6 +674,21 @@ typedef xQueueHandle xSemaphoreHandle;
  */
 #define xSemaphoreCreateMutex() xQueueCreateMutex( queueQUEUE_TYPE_MUTEX )
 
+/**
+ * semphr. h
+ * <pre>xSemaphoreHandle xSemaphoreCreateMutexStatic( xStaticSemaphore *pxMutexBuffer )</pre>
+ *
+ * As xSemaphoreCreateMutex(), but the mutex's data structure is held in the
+ * xStaticSemaphore variable pointed to by pxMutexBuffer.  Only available when
+ * configSUPPORT_STATIC_ALLOCATION is set to 1 in FreeRTOSConfig.h.
+ *
+ * \defgroup xSemaphoreCreateMutexStatic xSemaphoreCreateMutexStatic
+ * \ingroup Semaphores
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateMutexStatic( pxMutexBuffer ) xQueueCreateMutexStatic( queueQUEUE_TYPE_MUTEX, ( pxMutexBuffer ) )
+#endif
+
 
 /**
  * semphr. h
@@ -688,6 +744,135 @@ typedef xQueueHandle xSemaphoreHandle;
  */
 #define xSemaphoreCreateRecursiveMutex() xQueueCreateMutex( queueQUEUE_TYPE_RECURSIVE_MUTEX )
 
+/**
+ * semphr. h
+ * <pre>xSemaphoreHandle xSemaphoreCreateRecursiveMutexStatic( xStaticSemaphore *pxMutexBuffer )</pre>
+ *
+ * As xSemaphoreCreateRecursiveMutex(), but the mutex's data structure is held
+ * in the xStaticSemaphore variable pointed to by pxMutexBuffer.  Only
+ * available when configSUPPORT_STATIC_ALLOCATION is set to 1.
+ *
+ * \defgroup xSemaphoreCreateRecursiveMutexStatic xSemaphoreCreateRecursiveMutexStatic
+ * \ingroup Semaphores
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateRecursiveMutexStatic( pxMutexBuffer ) xQueueCreateMutexStatic( queueQUEUE_TYPE_RECURSIVE_MUTEX, ( pxMutexBuffer ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>xSemaphoreHandle xSemaphoreCreateMutexWithCeiling( unsigned portBASE_TYPE uxCeilingPriority )</pre>
+ *
+ * <i>Macro</i> that creates a mutex that uses the immediate priority ceiling
+ * protocol instead of priority inheritance.  Only available when
+ * configUSE_PRIORITY_CEILING_MUTEXES is set to 1 in FreeRTOSConfig.h.
+ *
+ * A task that takes the mutex is raised to uxCeilingPriority straight away,
+ * and returns to its own priority when it gives the mutex back.  While the
+ * mutex is held no other task that uses it can run, so the take does not
+ * have to inherit anything and a task is only ever blocked by the one
+ * critical section that was entered at a lower priority.
+ *
+ * uxCeilingPriority must be at least the priority of every task that takes
+ * the mutex.  A ceiling of tskIDLE_PRIORITY creates an ordinary priority
+ * inheritance mutex.  Ceiling mutexes held at the same time must be given
+ * back in the reverse order to that in which they were taken.  They are
+ * taken and given using xSemaphoreTake() and xSemaphoreGive().
+ *
+ * xSemaphoreCreateRecursiveMutexWithCeiling() creates the recursive
+ * equivalent, which raises the holder on its first take and restores it on
+ * its last give.  The ...Static() variants hold the mutex in an
+ * xStaticSemaphore as xSemaphoreCreateMutexStatic() does.
+ *
+ * @param uxCeilingPriority The priority the holder of the mutex runs at.
+ *
+ * @return Handle to the created mutex, or NULL if it could not be created.
+ *
+ * \defgroup xSemaphoreCreateMutexWithCeiling xSemaphoreCreateMutexWithCeiling
+ * \ingroup Semaphores
+ */
+#if( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+	#define xSemaphoreCreateMutexWithCeiling( uxCeilingPriority ) xQueueCreateCeilingMutex( queueQUEUE_TYPE_MUTEX, ( uxCeilingPriority ) )
+	#define xSemaphoreCreateRecursiveMutexWithCeiling( uxCeilingPriority ) xQueueCreateCeilingMutex( queueQUEUE_TYPE_RECURSIVE_MUTEX, ( uxCeilingPriority ) )
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		#define xSemaphoreCreateMutexWithCeilingStatic( uxCeilingPriority, pxMutexBuffer ) xQueueCreateCeilingMutexStatic( queueQUEUE_TYPE_MUTEX, ( uxCeilingPriority ), ( pxMutexBuffer ) )
+		#define xSemaphoreCreateRecursiveMutexWithCeilingStatic( uxCeilingPriority, pxMutexBuffer ) xQueueCreateCeilingMutexStatic( queueQUEUE_TYPE_RECURSIVE_MUTEX, ( uxCeilingPriority ), ( pxMutexBuffer ) )
+	#endif
+#endif
+
+/**
+ * semphr. h
+ * <pre>xSemaphoreHandle xSemaphoreCreateReadWriteLock( void )</pre>
+ *
+ * <i>Macro</i> that creates a read write lock.  Only available when
+ * configUSE_READ_WRITE_LOCKS is set to 1 in FreeRTOSConfig.h.
+ *
+ * Any number of tasks can hold the lock for reading at the same time, or one
+ * task can hold it for writing.  Once a writer is waiting for the lock new
+ * readers wait too, and the last reader to give the lock back passes it
+ * straight to the writer, so readers cannot keep a writer out for ever.  When
+ * the writer gives the lock back the next waiting writer, if any, takes
+ * priority over the waiting readers.
+ *
+ * The writer holding the lock inherits the priority of the tasks waiting for
+ * it, as the holder of a mutex does.  The tasks holding the lock for reading
+ * are not recorded individually, so do not inherit.
+ *
+ * The lock is taken with xSemaphoreTakeRead() or xSemaphoreTakeWrite() and
+ * given back with the matching xSemaphoreGiveRead() or xSemaphoreGiveWrite().
+ * It is not recursive, and a task holding it for reading cannot take it for
+ * writing.  It cannot be used from an interrupt, or with xSemaphoreTake() and
+ * xSemaphoreGive().  The lock is deleted with vSemaphoreDelete().
+ * xSemaphoreCreateReadWriteLockStatic() holds the lock in an xStaticSemaphore
+ * as xSemaphoreCreateMutexStatic() does.
+ *
+ * @return Handle to the created lock, or NULL if it could not be created.
+ *
+ * Example usage:
+ <pre>
+ xSemaphoreHandle xTableLock;
+
+ void vATask( void * pvParameters )
+ {
+    xTableLock = xSemaphoreCreateReadWriteLock();
+
+    // Read the table.  Other readers are not held up.
+    if( xSemaphoreTakeRead( xTableLock, ( portTickType ) 10 ) == pdTRUE )
+    {
+        // ... read the table ...
+        xSemaphoreGiveRead( xTableLock );
+    }
+
+    // Update the table.  Readers and writers are kept out until it is done.
+    if( xSemaphoreTakeWrite( xTableLock, ( portTickType ) 10 ) == pdTRUE )
+    {
+        // ... write the table ...
+        xSemaphoreGiveWrite( xTableLock );
+    }
+ }
+ </pre>
+ * \defgroup xSemaphoreCreateReadWriteLock xSemaphoreCreateReadWriteLock
+ * \ingroup Semaphores
+ */
+#if( configUSE_READ_WRITE_LOCKS == 1 )
+	#define xSemaphoreCreateReadWriteLock() xQueueCreateReadWriteLock()
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		#define xSemaphoreCreateReadWriteLockStatic( pxLockBuffer ) xQueueCreateReadWriteLockStatic( ( pxLockBuffer ) )
+	#endif
+
+	/* Take or give back a read write lock created with
+	xSemaphoreCreateReadWriteLock().  The take macros return pdTRUE if the lock
+	was obtained within xBlockTime ticks.  The give macros return pdFALSE if
+	the calling task did not hold the lock for writing, or nobody held it for
+	reading. */
+	#define xSemaphoreTakeRead( xLock, xBlockTime )		xQueueTakeReadWriteLock( ( xQueueHandle ) ( xLock ), ( xBlockTime ), pdFALSE )
+	#define xSemaphoreTakeWrite( xLock, xBlockTime )	xQueueTakeReadWriteLock( ( xQueueHandle ) ( xLock ), ( xBlockTime ), pdTRUE )
+	#define xSemaphoreGiveRead( xLock )					xQueueGiveReadWriteLock( ( xQueueHandle ) ( xLock ), pdFALSE )
+	#define xSemaphoreGiveWrite( xLock )				xQueueGiveReadWriteLock( ( xQueueHandle ) ( xLock ), pdTRUE )
+#endif
+
 /**
  * semphr. h
  * <pre>xSemaphoreHandle xSemaphoreCreateCounting( unsigned portBASE_TYPE uxMaxCount, unsigned portBASE_TYPE uxInitialCount )</pre>
@@ -751,6 +936,21 @@ typedef xQueueHandle xSemaphoreHandle;
  */
 #define xSemaphoreCreateCounting( uxMaxCount, uxInitialCount ) xQueueCreateCountingSemaphore( ( uxMaxCount ), ( uxInitialCount ) )
 
+/**
+ * semphr. h
+ * <pre>xSemaphoreHandle xSemaphoreCreateCountingStatic( unsigned portBASE_TYPE uxMaxCount, unsigned portBASE_TYPE uxInitialCount, xStaticSemaphore *pxSemaphoreBuffer )</pre>
+ *
+ * As xSemaphoreCreateCounting(), but the semaphore's data structure is held
+ * in the xStaticSemaphore variable pointed to by pxSemaphoreBuffer.  Only
+ * available when configSUPPORT_STATIC_ALLOCATION is set to 1.
+ *
+ * \defgroup xSemaphoreCreateCountingStatic xSemaphoreCreateCountingStatic
+ * \ingroup Semaphores
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateCountingStatic( uxMaxCount, uxInitialCount, pxSemaphoreBuffer ) xQueueCreateCountingSemaphoreStatic( ( uxMaxCount ), ( uxInitialCount ), ( pxSemaphoreBuffer ) )
+#endif
+
 /**
  * semphr. h
  * <pre>void vSemaphoreDelete( xSemaphoreHandle xSemaphore );</pre>
@@ -109,8 +109,12 @@ typedef enum
  */
 typedef struct xTIME_OUT
 {
-	portBASE_TYPE xOverflowCount;
-	portTickType  xTimeOnEntering;
+	#if ( configUSE_64_BIT_TICKS == 1 )
+		portTick64Type xTimeOnEntering;
+	#else
+		portBASE_TYPE xOverflowCount;
+		portTickType  xTimeOnEntering;
+	#endif
 } xTimeOutType;
 
 /*
@@ -147,10 +151,81 @@ typedef struct xTASK_STATUS
 	eTaskState eCurrentState;					/* The state in which the task existed when the structure was populated. */
 	unsigned portBASE_TYPE uxCurrentPriority;	/* The priority at which the task was running (may be inherited) when the structure was populated. */
 	unsigned portBASE_TYPE uxBasePriority;		/* The priority to which the task will return if the task's current priority has been inherited to avoid unbounded priority inversion when obtaining a mutex.  Only valid if configUSE_MUTEXES is defined as 1 in FreeRTOSConfig.h. */
-	unsigned long ulRunTimeCounter;				/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
+	unsigned long long ullRunTimeCounter;		/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
 	unsigned short usStackHighWaterMark;		/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } xTaskStatusType;
 
+/* The wake up latencies measured for one interrupt when
+configRECORD_WAKE_LATENCY is 1, see uxTaskGetWakeLatencyStats(). */
+typedef struct xWAKE_LATENCY_STATS
+{
+	unsigned long ulCount;				/* The number of tasks woken by the interrupt that have since run. */
+	unsigned long ulMin;				/* The shortest latency, in counts of the run time stats clock.  Only valid if ulCount is not zero. */
+	unsigned long ulMax;				/* The longest latency, in counts of the run time stats clock. */
+	unsigned long long ullTotal;		/* The sum of all the latencies, from which the mean can be calculated. */
+	unsigned long ulHistogram[ 32 ];	/* ulHistogram[ n ] counts the latencies that were at least 2^n, and less than 2^(n+1), counts of the run time stats clock.  Latencies of zero are counted in ulHistogram[ 0 ]. */
+	xTaskHandle xMaxTask;				/* The task that was woken with the latency ulMax.  It may since have been deleted. */
+} xWakeLatencyStats;
+
+/* An interrupt whose execution time is accounted for separately from the task
+it interrupts.  The structure is allocated by the application, usually
+statically alongside the handler, and passed to vTaskRegisterISRRunTimeStats().
+Its members are owned by the kernel and should be read through
+uxTaskGetISRSystemState() and uxTaskGetWakeLatencyStats(). */
+typedef struct xISR_RUN_TIME_STATS
+{
+	const signed char *pcISRName;
+	unsigned long long ullRunTimeCounter;
+	unsigned long ulEntryCount;
+	struct xISR_RUN_TIME_STATS *pxNext;
+
+	#if ( configRECORD_WAKE_LATENCY == 1 )
+		unsigned long ulEntryTime;						/* The run time stats clock when the handler was last entered. */
+		struct xISR_RUN_TIME_STATS *pxInterruptedISR;	/* The registered interrupt this one nested within, if any. */
+		xWakeLatencyStats xWakeLatency;
+	#endif
+} xISRRunTimeStats;
+
+/* Used with the uxTaskGetISRSystemState() function to return the run time of
+each registered interrupt. */
+typedef struct xISR_STATUS
+{
+	const signed char *pcISRName;				/* The name the interrupt was registered with. */
+	unsigned long long ullRunTimeCounter;		/* The total time spent in the handler, as defined by the run time stats clock, excluding time spent in other registered interrupts that nested within it. */
+	unsigned long ulEntryCount;					/* The number of times the handler has run. */
+} xISRStatusType;
+
+/* Used with the uxTaskGetWakeLatencyStats() function to return the wake up
+latencies of each registered interrupt. */
+typedef struct xWAKE_LATENCY_STATUS
+{
+	const signed char *pcISRName;				/* The name the interrupt was registered with. */
+	xWakeLatencyStats xStats;					/* The latencies from the interrupt to the tasks it woke. */
+} xWakeLatencyStatus;
+
+/* The kinds of section measured when configRECORD_SECTION_LATENCY is 1. */
+typedef enum
+{
+	eLatencyCriticalSection = 0,	/* Interrupts masked between the outermost taskENTER_CRITICAL() and taskEXIT_CRITICAL(). */
+	eLatencySchedulerSuspended		/* The scheduler locked between the outermost vTaskSuspendAll() and xTaskResumeAll(). */
+} eLatencySection;
+
+/* One of the longest sections seen, see xSectionLatencyStats. */
+typedef struct xSECTION_LATENCY_RECORD
+{
+	unsigned long ulLength;			/* The length of the section, in counts of the run time stats clock. */
+	void *pvCaller;					/* The return address of the call that started the section, so an address within the function that called taskENTER_CRITICAL() or vTaskSuspendAll(). */
+} xSectionLatencyRecord;
+
+/* Used with vTaskGetSectionLatencyStats() to return the measurements made of
+one kind of section. */
+typedef struct xSECTION_LATENCY_STATS
+{
+	unsigned long ulCount;			/* The number of sections measured. */
+	unsigned long ulHistogram[ 32 ];	/* ulHistogram[ n ] counts the sections that lasted at least 2^n, and less than 2^(n+1), counts of the run time stats clock.  Sections of zero length are counted in ulHistogram[ 0 ]. */
+	xSectionLatencyRecord xLongest[ configSECTION_LATENCY_TOP_N ];	/* The longest section started from each of up to configSECTION_LATENCY_TOP_N call sites, longest first.  Unused entries have a NULL pvCaller. */
+} xSectionLatencyStats;
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -159,6 +234,16 @@ typedef enum
 	eNoTasksWaitingTimeout	/* No tasks are waiting for a timeout so it is safe to enter a sleep mode that can only be exited by an external interrupt. */
 } eSleepModeStatus;
 
+/* Actions that can be performed when xTaskGenericNotify() is called. */
+typedef enum
+{
+	eNoAction = 0,				/* Notify the task without updating its notification value. */
+	eSetBits,					/* Set bits in the task's notification value. */
+	eIncrement,					/* Increment the task's notification value. */
+	eSetValueWithOverwrite,		/* Set the task's notification value to a specific value even if the previous value has not yet been read by the task. */
+	eSetValueWithoutOverwrite	/* Set the task's notification value if the previous value has been read by the task. */
+} eNotifyAction;
+
 
 /*
  * Defines the priority used by the idle task.  This must not be modified.
@@ -312,6 +397,80 @@ typedef enum
  */
 #define xTaskCreate( pvTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask ) xTaskGenericCreate( ( pvTaskCode ), ( pcName ), ( usStackDepth ), ( pvParameters ), ( uxPriority ), ( pxCreatedTask ), ( NULL ), ( NULL ) )
 
+/**
+ * task. h
+ *<pre>
+ xTaskHandle xTaskCreateStatic(
+							  pdTASK_CODE pvTaskCode,
+							  const signed char * const pcName,
+							  unsigned short usStackDepth,
+							  void *pvParameters,
+							  unsigned portBASE_TYPE uxPriority,
+							  portSTACK_TYPE * const puxStackBuffer,
+							  xStaticTask * const pxTaskBuffer
+						  );</pre>
+ *
+ * Create a new task and add it to the list of tasks that are ready to run,
+ * using memory provided by the caller instead of memory allocated from the
+ * FreeRTOS heap.  configSUPPORT_STATIC_ALLOCATION must be set to 1 in
+ * FreeRTOSConfig.h for this function to be available.
+ *
+ * Nothing is allocated, so the call cannot fail for lack of heap and the RAM
+ * used by the task shows up in the linker map.  When the task is deleted the
+ * buffers are not freed - they can be reused once the deleted task has been
+ * cleaned up, which is within vTaskDelete() unless the task deleted itself.
+ *
+ * @param pvTaskCode Pointer to the task entry function.  Tasks
+ * must be implemented to never return (i.e. continuous loop).
+ *
+ * @param pcName A descriptive name for the task.  Max length defined by
+ * configMAX_TASK_NAME_LEN.
+ *
+ * @param usStackDepth The number of variables (not bytes) the stack can hold,
+ * which must be the size of the array pointed to by puxStackBuffer.
+ *
+ * @param pvParameters Pointer that will be used as the parameter for the task
+ * being created.
+ *
+ * @param uxPriority The priority at which the task will run.
+ *
+ * @param puxStackBuffer Must point to a portSTACK_TYPE array that has at least
+ * usStackDepth indexes - the array will then be used as the task's stack.
+ *
+ * @param pxTaskBuffer Must point to a variable of type xStaticTask, which will
+ * then be used to hold the task's data structures (TCB).
+ *
+ * @return The handle of the created task, or NULL if either buffer is NULL.
+ *
+ * Example usage:
+   <pre>
+ #define STACK_SIZE 200
+
+ // The buffer used as the task's TCB.
+ xStaticTask xTaskBuffer;
+
+ // The array used as the task's stack.
+ portSTACK_TYPE xStack[ STACK_SIZE ];
+
+ void vOtherFunction( void )
+ {
+ xTaskHandle xHandle;
+
+	 // Create the task without using any dynamic memory allocation.
+	 xHandle = xTaskCreateStatic( vTaskCode, "NAME", STACK_SIZE, NULL, tskIDLE_PRIORITY, xStack, &xTaskBuffer );
+
+	 // xHandle can be used to reference the task, for example to change its
+	 // priority or delete it.
+	 vTaskSuspend( xHandle );
+ }
+   </pre>
+ * \defgroup xTaskCreateStatic xTaskCreateStatic
+ * \ingroup Tasks
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+	xTaskHandle xTaskCreateStatic( pdTASK_CODE pvTaskCode, const signed char * const pcName, unsigned short usStackDepth, void *pvParameters, unsigned portBASE_TYPE uxPriority, portSTACK_TYPE * const puxStackBuffer, xStaticTask * const pxTaskBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  *<pre>
@@ -439,12 +598,16 @@ void vTaskAllocateMPURegions( xTaskHandle xTask, const xMemoryRegion * const pxR
  * Remove a task from the RTOS real time kernels management.  The task being
  * deleted will be removed from all ready, blocked, suspended and event lists.
  *
- * NOTE:  The idle task is responsible for freeing the kernel allocated
- * memory from tasks that have been deleted.  It is therefore important that
- * the idle task is not starved of microcontroller processing time if your
- * application makes any calls to vTaskDelete ().  Memory allocated by the
- * task code is not automatically freed, and should be freed before the task
- * is deleted.
+ * NOTE:  The kernel allocated memory of a task deleted by another task is
+ * freed before vTaskDelete() returns.  A task that deletes itself is still
+ * using its stack, so the idle task frees its memory instead.  It is
+ * therefore important that the idle task is not starved of microcontroller
+ * processing time if tasks delete themselves.  When configTASK_POOL_SIZE is
+ * greater than 0 the memory is not returned to the heap but kept, up to that
+ * many TCB and stack pairs, for the next task created by xTaskCreate() whose
+ * stack fits, so tasks can be created and deleted repeatedly without heap
+ * calls.  Memory allocated by the task code is not automatically freed, and
+ * should be freed before the task is deleted.
  *
  * See the demo application file death.c for sample code that utilises
  * vTaskDelete ().
@@ -583,6 +746,100 @@ void vTaskDelay( portTickType xTicksToDelay ) PRIVILEGED_FUNCTION;
  */
 void vTaskDelayUntil( portTickType * const pxPreviousWakeTime, portTickType xTimeIncrement ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>void vTaskDelayHighRes( unsigned long ulMicrosecondsToDelay );</pre>
+ *
+ * configUSE_HIGH_RES_DELAYS must be defined as 1 for this function to be
+ * available, and the port must provide a high resolution clock and alarm.
+ * See the configuration section for more information.
+ *
+ * Delay a task for a number of microseconds.  Unlike vTaskDelay(), the wake
+ * time is not rounded to a tick period, so a task can wake within a few
+ * microseconds of the requested time without raising configTICK_RATE_HZ.
+ * Whole tick periods are spent in the delayed list as with vTaskDelay(), and
+ * only the last part of the delay, between one and two tick periods, is timed
+ * by the port's high resolution alarm interrupt, so a late tick does not make
+ * the task late.  The task is moved to the ready list when the alarm fires,
+ * and runs straight away if it has the highest priority of the ready tasks.
+ *
+ * @param ulMicrosecondsToDelay The time the calling task should block for,
+ * in microseconds.  Must be less than half the range of the high resolution
+ * clock, which for the LPC17xx TIMER0 at 25MHz is 85 seconds.
+ *
+ * Example usage:
+   <pre>
+ void vTaskFunction( void * pvParameters )
+ {
+	 for( ;; )
+	 {
+		 // Start the conversion, and read the result 250us later.
+		 vStartConversion();
+		 vTaskDelayHighRes( 250 );
+		 vReadConversion();
+	 }
+ }
+   </pre>
+ * \defgroup vTaskDelayHighRes vTaskDelayHighRes
+ * \ingroup TaskCtrl
+ */
+void vTaskDelayHighRes( unsigned long ulMicrosecondsToDelay ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>void vTaskDelayUntilHighRes( unsigned long * const pulPreviousWakeTime, unsigned long ulMicrosecondIncrement );</pre>
+ *
+ * configUSE_HIGH_RES_DELAYS must be defined as 1 for this function to be
+ * available.
+ *
+ * The high resolution equivalent of vTaskDelayUntil().  Blocks the calling
+ * task until ulMicrosecondIncrement microseconds after *pulPreviousWakeTime,
+ * then updates *pulPreviousWakeTime to that time.  If that time has already
+ * passed the task does not block.
+ *
+ * @param pulPreviousWakeTime Pointer to a variable that holds the time at
+ * which the task was last unblocked, in counts of the high resolution clock.
+ * The variable must be initialised with ulTaskGetHighResTime() before its
+ * first use.
+ *
+ * @param ulMicrosecondIncrement The cycle time period in microseconds.
+ *
+ * Example usage:
+   <pre>
+ // Sample the input every 500us.
+ void vTaskFunction( void * pvParameters )
+ {
+ unsigned long ulLastWakeTime;
+
+	 ulLastWakeTime = ulTaskGetHighResTime();
+	 for( ;; )
+	 {
+		 vTaskDelayUntilHighRes( &ulLastWakeTime, 500 );
+		 vSampleInput();
+	 }
+ }
+   </pre>
+ * \defgroup vTaskDelayUntilHighRes vTaskDelayUntilHighRes
+ * \ingroup TaskCtrl
+ */
+void vTaskDelayUntilHighRes( unsigned long * const pulPreviousWakeTime, unsigned long ulMicrosecondIncrement ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>unsigned long ulTaskGetHighResTime( void );</pre>
+ *
+ * configUSE_HIGH_RES_DELAYS must be defined as 1 for this function to be
+ * available.
+ *
+ * @return The current count of the high resolution clock, which counts
+ * portHIGH_RES_COUNTS_PER_US times a microsecond and wraps at the width of an
+ * unsigned long.
+ *
+ * \defgroup ulTaskGetHighResTime ulTaskGetHighResTime
+ * \ingroup TaskUtils
+ */
+unsigned long ulTaskGetHighResTime( void ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <pre>unsigned portBASE_TYPE uxTaskPriorityGet( xTaskHandle xTask );</pre>
@@ -690,6 +947,135 @@ eTaskState eTaskGetState( xTaskHandle xTask ) PRIVILEGED_FUNCTION;
  */
 void vTaskPrioritySet( xTaskHandle xTask, unsigned portBASE_TYPE uxNewPriority ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>void vTaskSetDeadline( xTaskHandle xTask, portTickType xRelativeDeadline );</pre>
+ *
+ * configUSE_EDF_SCHEDULING must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Give a task a deadline, so it is scheduled earliest deadline first among
+ * the ready tasks of its priority.  Priorities still come first: a task with
+ * a deadline only competes on deadline with tasks of the same priority, and
+ * ready tasks of that priority without a deadline only run once no task with
+ * a deadline is ready.  Placing all the periodic tasks of an application at
+ * one priority therefore schedules them by EDF, while tasks above that
+ * priority keep preempting them as before.
+ *
+ * The deadline of the current job is set to xRelativeDeadline ticks from the
+ * time of the call.  After that each call to vTaskDelayUntil() releases a new
+ * job at the wake time it calculates, with a deadline xRelativeDeadline ticks
+ * after it.  For a task with an implicit deadline pass the same period that is
+ * passed to vTaskDelayUntil().  If a job calls vTaskDelayUntil() after its
+ * deadline has passed traceTASK_DEADLINE_MISSED() is called.
+ *
+ * Deadlines are compared by the time left until them, so they are taken in
+ * the right order when they straddle a tick count overflow.  A relative
+ * deadline must be less than half the range of portTickType.
+ *
+ * @param xTask Handle to the task whose deadline is being set.  Passing a NULL
+ * handle sets the deadline of the calling task.
+ *
+ * @param xRelativeDeadline The deadline of each job, in ticks from its release.
+ * Passing 0 returns the task to being scheduled by priority alone.
+ *
+ * Example usage:
+   <pre>
+ void vPeriodicTask( void *pvParameters )
+ {
+ portTickType xLastWakeTime = xTaskGetTickCount();
+ const portTickType xPeriod = 100 / portTICK_RATE_MS;
+
+	 // Each job must complete before the next one is released.
+	 vTaskSetDeadline( NULL, xPeriod );
+
+	 for( ;; )
+	 {
+		 // Perform the job here, then wait for the next release.
+		 vTaskDelayUntil( &xLastWakeTime, xPeriod );
+	 }
+ }
+   </pre>
+ * \defgroup vTaskSetDeadline vTaskSetDeadline
+ * \ingroup TaskCtrl
+ */
+void vTaskSetDeadline( xTaskHandle xTask, portTickType xRelativeDeadline ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>portTickType xTaskGetDeadline( xTaskHandle xTask );</pre>
+ *
+ * configUSE_EDF_SCHEDULING must be defined as 1 for this function to be
+ * available.
+ *
+ * @param xTask Handle of the task to query.  Passing a NULL handle queries the
+ * calling task.
+ *
+ * @return The tick count by which the current job of xTask should complete,
+ * or portMAX_DELAY if the task has no deadline.
+ *
+ * \defgroup xTaskGetDeadline xTaskGetDeadline
+ * \ingroup TaskCtrl
+ */
+portTickType xTaskGetDeadline( xTaskHandle xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>void vTaskSetTimeSlice( xTaskHandle xTask, portTickType xTimeSliceTicks );</pre>
+ *
+ * configUSE_TASK_TIME_SLICES must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Set the number of ticks a task runs before it gives way to a ready task of
+ * the same priority.  Without this function, or with a time slice of one tick,
+ * tasks of equal priority take turns on every tick interrupt.  A task that
+ * does long computations can be given a longer slice to switch less often,
+ * while tasks that respond to events keep the default of
+ * configDEFAULT_TIME_SLICE_TICKS.  Tasks of higher priority still preempt a
+ * task in the middle of its slice, and the task starts a new slice when it
+ * runs again.
+ *
+ * @param xTask Handle to the task whose time slice is being set.  Passing a
+ * NULL handle sets the time slice of the calling task.
+ *
+ * @param xTimeSliceTicks The length of the time slice in ticks.  Must be at
+ * least 1.
+ *
+ * Example usage:
+   <pre>
+ void vBatchTask( void *pvParameters )
+ {
+	 // Run for 10 ms at a time before sharing the processor.
+	 vTaskSetTimeSlice( NULL, 10 / portTICK_RATE_MS );
+
+	 for( ;; )
+	 {
+		 // Process the next block of data here.
+	 }
+ }
+   </pre>
+ * \defgroup vTaskSetTimeSlice vTaskSetTimeSlice
+ * \ingroup TaskCtrl
+ */
+void vTaskSetTimeSlice( xTaskHandle xTask, portTickType xTimeSliceTicks ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>portTickType xTaskGetTimeSlice( xTaskHandle xTask );</pre>
+ *
+ * configUSE_TASK_TIME_SLICES must be defined as 1 for this function to be
+ * available.
+ *
+ * @param xTask Handle of the task to query.  Passing a NULL handle queries the
+ * calling task.
+ *
+ * @return The length of the time slice of xTask in ticks.
+ *
+ * \defgroup xTaskGetTimeSlice xTaskGetTimeSlice
+ * \ingroup TaskCtrl
+ */
+portTickType xTaskGetTimeSlice( xTaskHandle xTask ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <pre>void vTaskSuspend( xTaskHandle xTaskToSuspend );</pre>
@@ -1046,13 +1432,51 @@ portTickType xTaskGetTickCount( void ) PRIVILEGED_FUNCTION;
  */
 portTickType xTaskGetTickCountFromISR( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <PRE>portTick64Type xTaskGetTickCount64( void );</PRE>
+ *
+ * configUSE_64_BIT_TICKS must be set to 1 for this function to be available.
+ *
+ * @return The count of ticks since vTaskStartScheduler was called, as a 64 bit
+ * value that will not overflow.  xTaskGetTickCount() returns the low bits of
+ * the same count.
+ *
+ * The count is read inside a critical section, so a tick interrupt cannot
+ * change it part way through the read on a processor that has to read it in
+ * more than one access.
+ *
+ * \defgroup xTaskGetTickCount64 xTaskGetTickCount64
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_64_BIT_TICKS == 1 )
+	portTick64Type xTaskGetTickCount64( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * <PRE>portTick64Type xTaskGetTickCount64FromISR( void );</PRE>
+ *
+ * @return The count of ticks since vTaskStartScheduler was called, as a 64 bit
+ * value.
+ *
+ * This is a version of xTaskGetTickCount64() that is safe to be called from
+ * an ISR.  The tick interrupt is masked for the duration of the read.
+ *
+ * \defgroup xTaskGetTickCount64 xTaskGetTickCount64
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_64_BIT_TICKS == 1 )
+	portTick64Type xTaskGetTickCount64FromISR( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * <PRE>unsigned short uxTaskGetNumberOfTasks( void );</PRE>
  *
  * @return The number of tasks that the real time kernel is currently managing.
  * This includes all ready, blocked and suspended tasks.  A task that
- * has been deleted but not yet freed by the idle task will also be
+ * has deleted itself but not yet been freed by the idle task will also be
  * included in the count.
  *
  * \defgroup uxTaskGetNumberOfTasks uxTaskGetNumberOfTasks
@@ -1166,11 +1590,15 @@ xTaskHandle xTaskGetIdleTaskHandle( void );
  * the number of xTaskStatusType structures contained in the array, not by the
  * number of bytes in the array.
  *
- * @param pulTotalRunTime If configGENERATE_RUN_TIME_STATS is set to 1 in
- * FreeRTOSConfig.h then *pulTotalRunTime is set by uxTaskGetSystemState() to the
- * total run time (as defined by the run time stats clock, see
- * http://www.freertos.org/rtos-run-time-stats.html) since the target booted.
- * pulTotalRunTime can be set to NULL to omit the total run time information.
+ * @param pullTotalRunTime If configGENERATE_RUN_TIME_STATS is set to 1 in
+ * FreeRTOSConfig.h then *pullTotalRunTime is set by uxTaskGetSystemState() to
+ * the total run time (as defined by the run time stats clock, see
+ * http://www.freertos.org/rtos-run-time-stats.html) since the scheduler was
+ * started.  This is the sum of the run time of every task, including deleted
+ * tasks, and every interrupt registered with vTaskRegisterISRRunTimeStats().
+ * The clock itself may be only 32 bits wide, but the totals are accumulated in
+ * 64 bits so they do not overflow.  pullTotalRunTime can be set to NULL to omit
+ * the total run time information.
  *
  * @return The number of xTaskStatusType structures that were populated by
  * uxTaskGetSystemState().  This should equal the number returned by the
@@ -1186,7 +1614,8 @@ xTaskHandle xTaskGetIdleTaskHandle( void );
 	{
 	xTaskStatusType *pxTaskStatusArray;
 	volatile unsigned portBASE_TYPE uxArraySize, x;
-	unsigned long ulTotalRunTime, ulStatsAsPercentage;
+	unsigned long long ullTotalRunTime;
+	unsigned long ulStatsAsPercentage;
 
 		// Make sure the write buffer does not contain a string.
 		*pcWriteBuffer = 0x00;
@@ -1202,13 +1631,13 @@ xTaskHandle xTaskGetIdleTaskHandle( void );
 		if( pxTaskStatusArray != NULL )
 		{
 			// Generate raw status information about each task.
-			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalRunTime );
+			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ullTotalRunTime );
 
 			// For percentage calculations.
-			ulTotalRunTime /= 100UL;
+			ullTotalRunTime /= 100ULL;
 
 			// Avoid divide by zero errors.
-			if( ulTotalRunTime > 0 )
+			if( ullTotalRunTime > 0 )
 			{
 				// For each populated position in the pxTaskStatusArray array,
 				// format the raw data as human readable ASCII data
@@ -1216,18 +1645,18 @@ xTaskHandle xTaskGetIdleTaskHandle( void );
 				{
 					// What percentage of the total run time has the task used?
 					// This will always be rounded down to the nearest integer.
-					// ulTotalRunTimeDiv100 has already been divided by 100.
-					ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalRunTime;
+					// ullTotalRunTime has already been divided by 100.
+					ulStatsAsPercentage = ( unsigned long ) ( pxTaskStatusArray[ x ].ullRunTimeCounter / ullTotalRunTime );
 
 					if( ulStatsAsPercentage > 0UL )
 					{
-						sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
+						sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%llu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ullRunTimeCounter, ulStatsAsPercentage );
 					}
 					else
 					{
 						// If the percentage is zero here then the task has
 						// consumed less than 1% of the total run time.
-						sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter );
+						sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%llu\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ullRunTimeCounter );
 					}
 
 					pcWriteBuffer += strlen( ( char * ) pcWriteBuffer );
@@ -1240,7 +1669,7 @@ xTaskHandle xTaskGetIdleTaskHandle( void );
 	}
 	</pre>
  */
-unsigned portBASE_TYPE uxTaskGetSystemState( xTaskStatusType *pxTaskStatusArray, unsigned portBASE_TYPE uxArraySize, unsigned long *pulTotalRunTime );
+unsigned portBASE_TYPE uxTaskGetSystemState( xTaskStatusType *pxTaskStatusArray, unsigned portBASE_TYPE uxArraySize, unsigned long long *pullTotalRunTime );
 
 /**
  * task. h
@@ -1299,7 +1728,13 @@ void vTaskList( signed char *pcWriteBuffer ) PRIVILEGED_FUNCTION;
  * portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() and portGET_RUN_TIME_COUNTER_VALUE
  * to configure a peripheral timer/counter and return the timers current count
  * value respectively.  The counter should be at least 10 times the frequency of
- * the tick count.
+ * the tick count.  The Cortex-M3 port provides both, using the DWT cycle
+ * counter, unless FreeRTOSConfig.h defines them first.
+ *
+ * The counter must be free running and must not be reset once the scheduler
+ * has started.  Time is accumulated from the difference between successive
+ * readings, so the counter is allowed to wrap provided it is read at least
+ * once per wrap period - which happens at every context switch.
  *
  * NOTE 1: This function will disable interrupts for its duration.  It is
  * not intended for normal application runtime use but as a debug aid.
@@ -1310,7 +1745,8 @@ void vTaskList( signed char *pcWriteBuffer ) PRIVILEGED_FUNCTION;
  * configured by the portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() macro.
  * Calling vTaskGetRunTimeStats() writes the total execution time of each
  * task into a buffer, both as an absolute count value and as a percentage
- * of the total system execution time.
+ * of the total system execution time.  Interrupts registered with
+ * vTaskRegisterISRRunTimeStats() are listed after the tasks.
  *
  * NOTE 2:
  *
@@ -1343,6 +1779,395 @@ void vTaskList( signed char *pcWriteBuffer ) PRIVILEGED_FUNCTION;
  */
 void vTaskGetRunTimeStats( signed char *pcWriteBuffer ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <PRE>void vTaskRegisterISRRunTimeStats( xISRRunTimeStats *pxISRStats, const signed char *pcISRName );</PRE>
+ *
+ * configGENERATE_RUN_TIME_STATS must be defined as 1 for this function to be
+ * available.
+ *
+ * Without instrumentation the time spent in an interrupt is charged to
+ * whichever task it interrupted.  Registering an interrupt, and wrapping its
+ * handler in taskENTER_ISR_RUN_TIME() / taskEXIT_ISR_RUN_TIME(), charges that
+ * time to the interrupt instead, so both tasks and interrupts can be seen in
+ * uxTaskGetISRSystemState() and vTaskGetRunTimeStats().
+ *
+ * Only interrupts that are allowed to use the FromISR API - those at or below
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY - can be instrumented.
+ *
+ * @param pxISRStats A structure that must remain in scope for as long as the
+ * interrupt is in use.  It is never unregistered.
+ *
+ * @param pcISRName A descriptive name for the interrupt.
+ *
+ * Example usage:
+   <pre>
+ static xISRRunTimeStats xUARTRunTime;
+
+ void vUARTInit( void )
+ {
+     vTaskRegisterISRRunTimeStats( &xUARTRunTime, ( const signed char * ) "UART" );
+     // Then configure and enable the peripheral and its interrupt.
+ }
+
+ void UART_IRQHandler( void )
+ {
+ portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+ taskENTER_ISR_RUN_TIME( xUARTRunTime );
+
+     // Service the peripheral, possibly unblocking a task.
+
+     // Must be called before the context switch is requested, and on every
+     // path out of the handler.
+     taskEXIT_ISR_RUN_TIME();
+     portEND_SWITCHING_ISR( xHigherPriorityTaskWoken );
+ }
+   </pre>
+ * \defgroup vTaskRegisterISRRunTimeStats vTaskRegisterISRRunTimeStats
+ * \ingroup TaskUtils
+ */
+void vTaskRegisterISRRunTimeStats( xISRRunTimeStats *pxISRStats, const signed char *pcISRName ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>unsigned portBASE_TYPE uxTaskGetISRSystemState( xISRStatusType *pxISRStatusArray, unsigned portBASE_TYPE uxArraySize );</PRE>
+ *
+ * configGENERATE_RUN_TIME_STATS must be defined as 1 for this function to be
+ * available.
+ *
+ * The interrupt equivalent of uxTaskGetSystemState().  Copies the run time of
+ * each interrupt registered with vTaskRegisterISRRunTimeStats() into
+ * pxISRStatusArray, most recently registered first.  Each entry is copied with
+ * interrupts masked so its 64-bit counter is consistent, and the time since
+ * the counters were last updated is charged first so the figures are current.
+ * The total to compare them against is returned by uxTaskGetSystemState().
+ *
+ * @param pxISRStatusArray The array to fill.
+ *
+ * @param uxArraySize The number of entries in pxISRStatusArray.  Interrupts
+ * that do not fit are left out.
+ *
+ * @return The number of entries populated.
+ *
+ * \defgroup uxTaskGetISRSystemState uxTaskGetISRSystemState
+ * \ingroup TaskUtils
+ */
+unsigned portBASE_TYPE uxTaskGetISRSystemState( xISRStatusType *pxISRStatusArray, unsigned portBASE_TYPE uxArraySize ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskGetSectionLatencyStats( eLatencySection eSection, xSectionLatencyStats *pxStats );</PRE>
+ *
+ * configRECORD_SECTION_LATENCY must be defined as 1 for this function to be
+ * available, which in turn requires configGENERATE_RUN_TIME_STATS to be 1 as
+ * sections are timed with the run time stats clock.
+ *
+ * Each critical section, and each period the scheduler is suspended, delays
+ * interrupts or tasks for its whole length.  When configRECORD_SECTION_LATENCY
+ * is 1 the length of every outermost section is added to a log2 histogram, and
+ * the longest section seen from each call site is kept so the code paths that
+ * exceed a latency budget can be found.  On the Cortex-M3 port the lengths are
+ * in core clock cycles, and a call site is a Thumb address with bit 0 set that
+ * can be looked up in the linker map.
+ *
+ * Sections that end in an interrupt, or that the kernel enters with
+ * portSET_INTERRUPT_MASK_FROM_ISR(), are not included.
+ *
+ * @param eSection Which kind of section to return the figures for.
+ *
+ * @param pxStats The structure into which the figures are copied.
+ *
+ * \defgroup vTaskGetSectionLatencyStats vTaskGetSectionLatencyStats
+ * \ingroup TaskUtils
+ */
+void vTaskGetSectionLatencyStats( eLatencySection eSection, xSectionLatencyStats *pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskResetSectionLatencyStats( eLatencySection eSection );</PRE>
+ *
+ * configRECORD_SECTION_LATENCY must be defined as 1 for this function to be
+ * available.
+ *
+ * Clears the figures returned by vTaskGetSectionLatencyStats() for one kind
+ * of section, for example to measure a single phase of the application.
+ *
+ * \defgroup vTaskResetSectionLatencyStats vTaskResetSectionLatencyStats
+ * \ingroup TaskUtils
+ */
+void vTaskResetSectionLatencyStats( eLatencySection eSection ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>unsigned portBASE_TYPE uxTaskGetWakeLatencyStats( xWakeLatencyStatus *pxWakeLatencyArray, unsigned portBASE_TYPE uxArraySize );</PRE>
+ *
+ * configRECORD_WAKE_LATENCY must be defined as 1 for this function to be
+ * available, which in turn requires configGENERATE_RUN_TIME_STATS to be 1.
+ *
+ * When a handler wrapped in taskENTER_ISR_RUN_TIME() / taskEXIT_ISR_RUN_TIME()
+ * unblocks or resumes a task, whether through a queue, semaphore, stream
+ * buffer, notification or xTaskResumeFromISR(), the time the handler was
+ * entered is stored in the task.  When the scheduler next switches the task in
+ * the time since then is added to the statistics of that interrupt.  A task
+ * the tick interrupt unblocks is attributed to the tick if the tick handler is
+ * instrumented.  The latency covers the rest of the handler, any
+ * higher priority tasks that ran first, and the context switch up to the end
+ * of vTaskSwitchContext().  The few instructions that restore the task's
+ * registers after that are not included, nor on the POSIX port the switch
+ * between host threads.
+ *
+ * Copies the statistics of each interrupt registered with
+ * vTaskRegisterISRRunTimeStats() into pxWakeLatencyArray, most recently
+ * registered first.
+ *
+ * @param pxWakeLatencyArray The array to fill.
+ *
+ * @param uxArraySize The number of entries in pxWakeLatencyArray.  Interrupts
+ * that do not fit are left out.
+ *
+ * @return The number of entries populated.
+ *
+ * \defgroup uxTaskGetWakeLatencyStats uxTaskGetWakeLatencyStats
+ * \ingroup TaskUtils
+ */
+unsigned portBASE_TYPE uxTaskGetWakeLatencyStats( xWakeLatencyStatus *pxWakeLatencyArray, unsigned portBASE_TYPE uxArraySize ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskResetWakeLatencyStats( void );</PRE>
+ *
+ * configRECORD_WAKE_LATENCY must be defined as 1 for this function to be
+ * available.
+ *
+ * Clears the wake up latencies of every registered interrupt.
+ *
+ * \defgroup vTaskResetWakeLatencyStats vTaskResetWakeLatencyStats
+ * \ingroup TaskUtils
+ */
+void vTaskResetWakeLatencyStats( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Wrap the body of an interrupt handler registered with
+ * vTaskRegisterISRRunTimeStats().  taskENTER_ISR_RUN_TIME() declares a local
+ * variable so must be placed with the handler's declarations, and
+ * taskEXIT_ISR_RUN_TIME() must be reached on every path out of the handler,
+ * before portEND_SWITCHING_ISR().  Registered interrupts can nest; each only
+ * accumulates the time it was not itself interrupted.  Both compile to nothing
+ * when configGENERATE_RUN_TIME_STATS is 0.
+ */
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	#define taskENTER_ISR_RUN_TIME( xISRStats )	unsigned long long * const pullInterruptedRunTime = pullTaskEnterISRRunTime( &( xISRStats ) )
+	#define taskEXIT_ISR_RUN_TIME()				vTaskExitISRRunTime( pullInterruptedRunTime )
+#else
+	#define taskENTER_ISR_RUN_TIME( xISRStats )
+	#define taskEXIT_ISR_RUN_TIME()
+#endif
+
+/**
+ * task. h
+ * <PRE>portBASE_TYPE xTaskGenericNotify( xTaskHandle xTaskToNotify, unsigned long ulValue, eNotifyAction eAction, unsigned long *pulPreviousNotificationValue );</PRE>
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * function to be available.
+ *
+ * Each task has a 32-bit notification value that is initialised to zero when
+ * the task is created.  Sending a notification to a task unblocks it if it
+ * was blocked in xTaskNotifyWait() or ulTaskNotifyTake(), and can update the
+ * notification value at the same time.  A notification is sent directly to
+ * the task, so no separate queue or semaphore object needs to be created,
+ * and unblocking the task does not involve any event list.  This makes a
+ * notification both faster and smaller than a binary semaphore, counting
+ * semaphore, event flag or length one mailbox in the cases where there is
+ * exactly one receiving task.
+ *
+ * This function is not normally called directly.  Use the xTaskNotify(),
+ * xTaskNotifyAndQuery() and xTaskNotifyGive() macros instead.
+ *
+ * @param xTaskToNotify The handle of the task being notified.
+ *
+ * @param ulValue Data that can be sent with the notification.  How the data
+ * is used depends on the value of the eAction parameter.
+ *
+ * @param eAction Specifies how the notification updates the task's
+ * notification value:
+ *
+ *	eSetBits -
+ *	The task's notification value is bitwise ORed with ulValue.  pdPASS is
+ *	always returned.
+ *
+ *	eIncrement -
+ *	The task's notification value is incremented.  ulValue is not used and
+ *	pdPASS is always returned.
+ *
+ *	eSetValueWithOverwrite -
+ *	The task's notification value is set to ulValue, even if the task had
+ *	not yet processed the previous notification.  pdPASS is always returned.
+ *
+ *	eSetValueWithoutOverwrite -
+ *	If the task does not already have a notification pending then its
+ *	notification value is set to ulValue and pdPASS is returned.  If the task
+ *	already had a notification pending then no action is performed and pdFAIL
+ *	is returned.
+ *
+ *	eNoAction -
+ *	The task receives a notification without its notification value being
+ *	updated.  ulValue is not used and pdPASS is always returned.
+ *
+ * @param pulPreviousNotificationValue If not NULL, the task's notification
+ * value before it was modified by this call is written to
+ * *pulPreviousNotificationValue.
+ *
+ * @return Dependent on the value of eAction.  See the description of the
+ * eAction parameter.
+ *
+ * \defgroup xTaskNotify xTaskNotify
+ * \ingroup TaskNotifications
+ */
+portBASE_TYPE xTaskGenericNotify( xTaskHandle xTaskToNotify, unsigned long ulValue, eNotifyAction eAction, unsigned long *pulPreviousNotificationValue ) PRIVILEGED_FUNCTION;
+#define xTaskNotify( xTaskToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL )
+#define xTaskNotifyAndQuery( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
+
+/**
+ * task. h
+ * <PRE>portBASE_TYPE xTaskGenericNotifyFromISR( xTaskHandle xTaskToNotify, unsigned long ulValue, eNotifyAction eAction, unsigned long *pulPreviousNotificationValue, portBASE_TYPE *pxHigherPriorityTaskWoken );</PRE>
+ *
+ * A version of xTaskGenericNotify() that can be called from an interrupt
+ * service routine.  Normally used through the xTaskNotifyFromISR() and
+ * xTaskNotifyAndQueryFromISR() macros.
+ *
+ * @param xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue As per
+ * xTaskGenericNotify().
+ *
+ * @param pxHigherPriorityTaskWoken xTaskGenericNotifyFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if sending the notification caused the
+ * task to which the notification was sent to leave the Blocked state, and the
+ * unblocked task has a priority higher than the currently running task.  If
+ * xTaskGenericNotifyFromISR() sets this value to pdTRUE then a context switch
+ * should be requested before the interrupt is exited, for example by passing
+ * the value to portEND_SWITCHING_ISR().
+ *
+ * @return As per xTaskGenericNotify().
+ *
+ * \defgroup xTaskNotifyFromISR xTaskNotifyFromISR
+ * \ingroup TaskNotifications
+ */
+portBASE_TYPE xTaskGenericNotifyFromISR( xTaskHandle xTaskToNotify, unsigned long ulValue, eNotifyAction eAction, unsigned long *pulPreviousNotificationValue, portBASE_TYPE *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyFromISR( xTaskToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * task. h
+ * <PRE>portBASE_TYPE xTaskNotifyWait( unsigned long ulBitsToClearOnEntry, unsigned long ulBitsToClearOnExit, unsigned long *pulNotificationValue, portTickType xTicksToWait );</pre>
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * function to be available.
+ *
+ * Wait, optionally in the Blocked state, for the calling task to receive a
+ * notification.  A task that is blocked waiting for a notification does not
+ * consume any CPU time.
+ *
+ * @param ulBitsToClearOnEntry Bits that are set in ulBitsToClearOnEntry are
+ * cleared in the calling task's notification value before the task checks
+ * for a pending notification - but only if no notification was already
+ * pending.  Setting ulBitsToClearOnEntry to 0xffffffffUL resets the
+ * notification value to 0.
+ *
+ * @param ulBitsToClearOnExit Bits that are set in ulBitsToClearOnExit are
+ * cleared in the calling task's notification value before
+ * xTaskNotifyWait() returns, if a notification was received.  The value is
+ * passed out through pulNotificationValue before any bits are cleared.
+ *
+ * @param pulNotificationValue If not NULL, the task's notification value
+ * (before ulBitsToClearOnExit is applied) is written to
+ * *pulNotificationValue.
+ *
+ * @param xTicksToWait The maximum time to wait in the Blocked state for a
+ * notification to be received.  Specified in ticks - use portTICK_RATE_MS
+ * to convert a time in milliseconds.
+ *
+ * @return pdTRUE if a notification was received (including one that was
+ * already pending when xTaskNotifyWait() was called), otherwise pdFALSE.
+ *
+ * \defgroup xTaskNotifyWait xTaskNotifyWait
+ * \ingroup TaskNotifications
+ */
+portBASE_TYPE xTaskNotifyWait( unsigned long ulBitsToClearOnEntry, unsigned long ulBitsToClearOnExit, unsigned long *pulNotificationValue, portTickType xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>portBASE_TYPE xTaskNotifyGive( xTaskHandle xTaskToNotify );</PRE>
+ *
+ * Increments the notification value of xTaskToNotify, unblocking it if it is
+ * waiting in ulTaskNotifyTake().  Used in place of xSemaphoreGive() when a
+ * task notification is used as a light weight binary or counting semaphore.
+ * Implemented as a macro that calls xTaskGenericNotify() with eIncrement.
+ *
+ * @return Always pdPASS.
+ *
+ * \defgroup xTaskNotifyGive xTaskNotifyGive
+ * \ingroup TaskNotifications
+ */
+#define xTaskNotifyGive( xTaskToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( 0UL ), eIncrement, NULL )
+
+/**
+ * task. h
+ * <PRE>void vTaskNotifyGiveFromISR( xTaskHandle xTaskToNotify, portBASE_TYPE *pxHigherPriorityTaskWoken );</PRE>
+ *
+ * A version of xTaskNotifyGive() that can be called from an interrupt service
+ * routine.  It is cheaper than calling xTaskNotifyFromISR() with eIncrement
+ * as there is no previous value to return and the action is fixed.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the notification unblocked
+ * a task with a priority above that of the currently running task, in which
+ * case a context switch should be requested before the interrupt exits.
+ *
+ * \defgroup vTaskNotifyGiveFromISR vTaskNotifyGiveFromISR
+ * \ingroup TaskNotifications
+ */
+void vTaskNotifyGiveFromISR( xTaskHandle xTaskToNotify, portBASE_TYPE *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>unsigned long ulTaskNotifyTake( portBASE_TYPE xClearCountOnExit, portTickType xTicksToWait );</pre>
+ *
+ * Used in place of xSemaphoreTake() when a task notification is used as a
+ * light weight binary or counting semaphore.  If the calling task's
+ * notification value is zero the task waits, optionally in the Blocked state,
+ * for it to become non-zero.
+ *
+ * @param xClearCountOnExit If pdFALSE the notification value is decremented
+ * before the function exits, so it behaves like a counting semaphore.  If
+ * not pdFALSE the notification value is cleared to zero, so it behaves like a
+ * binary semaphore.
+ *
+ * @param xTicksToWait The maximum time to wait in the Blocked state for the
+ * notification value to become non-zero.
+ *
+ * @return The task's notification value before it was decremented or
+ * cleared.  Zero means the call timed out.
+ *
+ * \defgroup ulTaskNotifyTake ulTaskNotifyTake
+ * \ingroup TaskNotifications
+ */
+unsigned long ulTaskNotifyTake( portBASE_TYPE xClearCountOnExit, portTickType xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vApplicationGetIdleTaskMemory( xStaticTask **ppxIdleTaskTCBBuffer, portSTACK_TYPE **ppxIdleTaskStackBuffer, unsigned short *pusIdleTaskStackSize );</PRE>
+ *
+ * When configSUPPORT_STATIC_ALLOCATION is set to 1 the idle task is created
+ * with xTaskCreateStatic(), and the application must provide this function to
+ * supply the memory it uses.  *pusIdleTaskStackSize is initialised to
+ * configMINIMAL_STACK_SIZE and should be set to the number of portSTACK_TYPE
+ * variables in the array returned in *ppxIdleTaskStackBuffer.
+ *
+ * \defgroup vApplicationGetIdleTaskMemory vApplicationGetIdleTaskMemory
+ * \ingroup Tasks
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+	void vApplicationGetIdleTaskMemory( xStaticTask **ppxIdleTaskTCBBuffer, portSTACK_TYPE **ppxIdleTaskStackBuffer, unsigned short *pusIdleTaskStackSize );
+#endif
+
 /*-----------------------------------------------------------
  * SCHEDULER INTERNALS AVAILABLE FOR PORTING PURPOSES
  *----------------------------------------------------------*/
@@ -1364,6 +2189,19 @@ void vTaskGetRunTimeStats( signed char *pcWriteBuffer ) PRIVILEGED_FUNCTION;
  */
 portBASE_TYPE xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
+ * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
+ * AN INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Called from the interrupt raised by portSET_HIGH_RES_ALARM() when
+ * configUSE_HIGH_RES_DELAYS is 1.  Readies the tasks delayed by
+ * vTaskDelayHighRes() and vTaskDelayUntilHighRes() whose wake time has
+ * passed, and sets the alarm for the next one.  Returns pdTRUE if a context
+ * switch is required.  A spurious call does no harm.
+ */
+portBASE_TYPE xTaskHighResAlarm( void ) PRIVILEGED_FUNCTION;
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
  * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
@@ -1419,6 +2257,37 @@ void vTaskPlaceOnEventListRestricted( xList * const pxEventList, portTickType xT
  */
 signed portBASE_TYPE xTaskRemoveFromEventList( const xList * const pxEventList ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.
+ *
+ * Used by the event groups implementation.  Places the calling task at the
+ * end of pxEventList (the list is not kept in priority order, as every
+ * waiting task has to be inspected when bits are set anyway) and stores
+ * xItemValue, which holds the bits the task is waiting for, in the event list
+ * item.  The item value is marked as in use so that a priority change does
+ * not overwrite it while the task is blocked.
+ */
+void vTaskPlaceOnUnorderedEventList( xList * pxEventList, const portTickType xItemValue, const portTickType xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.
+ *
+ * The counterpart of vTaskPlaceOnUnorderedEventList().  Readies the task
+ * that owns pxEventListItem, leaving xItemValue (the event bits that
+ * unblocked the task) in the event list item for the task to collect with
+ * uxTaskResetEventItemValue().
+ *
+ * @return pdTRUE if the task being removed has a higher priority than the task
+ * making the call, otherwise pdFALSE.
+ */
+signed portBASE_TYPE xTaskRemoveFromUnorderedEventList( xListItem * pxEventListItem, const portTickType xItemValue ) PRIVILEGED_FUNCTION;
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
  * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
@@ -1429,6 +2298,16 @@ signed portBASE_TYPE xTaskRemoveFromEventList( const xList * const pxEventList )
  */
 void vTaskSwitchContext( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Returns the value held in the calling task's event list item - the event
+ * bits that unblocked it if it was waiting in an event group - and restores
+ * the item value to the priority ordering used by the other event lists.
+ */
+portTickType uxTaskResetEventItemValue( void ) PRIVILEGED_FUNCTION;
+
 /*
  * Return the handle of the calling task.
  */
@@ -1458,16 +2337,59 @@ void vTaskMissedYield( void ) PRIVILEGED_FUNCTION;
 portBASE_TYPE xTaskGetSchedulerState( void ) PRIVILEGED_FUNCTION;
 
 /*
- * Raises the priority of the mutex holder to that of the calling task should
- * the mutex holder have a priority less than the calling task.
+ * Called by the calling task as it takes a mutex.  Adds the mutex, through
+ * pxMutexItem, to the mutexes the task holds, and returns the task's handle to
+ * record as the mutex holder.  The owner of pxMutexItem must be the list of
+ * tasks blocked on the mutex.
+ */
+void *pvTaskMutexTaken( xListItem * const pxMutexItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * As pvTaskMutexTaken(), but records xTask as the task taking the mutex.  Used
+ * to pass a mutex straight to a task that is about to be unblocked, before it
+ * runs.
+ */
+void *pvTaskMutexGivenTo( xTaskHandle xTask, xListItem * const pxMutexItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Records the mutex the calling task is about to block on, or NULL once it
+ * has stopped waiting, so inherited priorities can pass through the task to
+ * the holder of that mutex.
+ */
+void vTaskSetMutexWaitedOn( void *pvMutex ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sets the priority of the mutex holder to the highest of its own priority
+ * and the priorities of the tasks blocked on the mutexes it holds.  Called
+ * after a task blocks on a mutex, and after a task blocked on a mutex times
+ * out.  If the holder's priority changed and it is itself blocked on a mutex,
+ * that mutex is returned so the caller can update its holder in turn.
+ * Otherwise NULL is returned.
  */
-void vTaskPriorityInherit( xTaskHandle const pxMutexHolder ) PRIVILEGED_FUNCTION;
+void *pvTaskPriorityInherit( xTaskHandle const pxMutexHolder ) PRIVILEGED_FUNCTION;
 
 /*
- * Set the priority of a task back to its proper priority in the case that it
- * inherited a higher priority while it was holding a semaphore.
+ * Removes the mutex identified by pxMutexItem from the mutexes held by the
+ * mutex holder, and sets the holder back to the priority it should have
+ * without it.  A priority inherited through other mutexes it still holds is
+ * kept.  Returns pdTRUE if that leaves a task of higher priority than the
+ * calling task ready to run.
  */
-void vTaskPriorityDisinherit( xTaskHandle const pxMutexHolder ) PRIVILEGED_FUNCTION;
+portBASE_TYPE xTaskPriorityDisinherit( xTaskHandle const pxMutexHolder, xListItem * const pxMutexItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Raises the calling task to the ceiling of a priority ceiling mutex it has
+ * just taken, and returns the ceiling the task held before so it can be
+ * restored when the mutex is given back.
+ */
+unsigned portBASE_TYPE uxTaskPriorityRaiseToCeiling( unsigned portBASE_TYPE uxCeilingPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * Restores the ceiling the mutex holder held before it took a priority
+ * ceiling mutex.  Must be followed by xTaskPriorityDisinherit(), which
+ * drops the holder's priority to match.
+ */
+void vTaskPriorityRestoreCeiling( xTaskHandle const pxMutexHolder, unsigned portBASE_TYPE uxPreviousCeiling ) PRIVILEGED_FUNCTION;
 
 /*
  * Generic version of the task creation function which is in turn called by the
@@ -1510,6 +2432,28 @@ void vTaskStepTick( portTickType xTicksToJump );
  */
 eSleepModeStatus eTaskConfirmSleepModeStatus( void );
 
+/*
+ * Used through the taskENTER_ISR_RUN_TIME() and taskEXIT_ISR_RUN_TIME()
+ * macros only.  Entering charges the elapsed run time to whatever was running
+ * and starts charging pxISRStats, returning the counter that was being charged
+ * so that exiting can resume charging it.  When configRECORD_WAKE_LATENCY is 1
+ * pxISRStats is also the interrupt tasks readied until the exit are
+ * attributed to.
+ */
+unsigned long long *pullTaskEnterISRRunTime( xISRRunTimeStats *pxISRStats ) PRIVILEGED_FUNCTION;
+void vTaskExitISRRunTime( unsigned long long *pullInterruptedRunTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE ONLY
+ * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER.
+ *
+ * Called by the port, with interrupts masked, when the outermost critical
+ * section is entered and left, if configRECORD_SECTION_LATENCY is 1.  pvCaller
+ * is the return address of vPortEnterCritical().
+ */
+void vTaskSectionLatencyStart( eLatencySection eSection, void *pvCaller ) PRIVILEGED_FUNCTION;
+void vTaskSectionLatencyEnd( eLatencySection eSection ) PRIVILEGED_FUNCTION;
+
 #ifdef __cplusplus
 }
 #endif
@@ -80,7 +80,7 @@ void vListInitialise( xList * const pxList )
 
 	/* The list end value is the highest possible value in the list to
 	ensure it remains at the end of the list. */
-	pxList->xListEnd.xItemValue = portMAX_DELAY;
+	pxList->xListEnd.xItemValue = listMAX_ITEM_VALUE;
 
 	/* The list end next and previous pointers point to itself so we know
 	when the list is empty. */
@@ -122,7 +122,7 @@ xListItem * pxIndex;
 void vListInsert( xList * const pxList, xListItem * const pxNewListItem )
 {
 xListItem *pxIterator;
-portTickType xValueOfInsertion;
+listITEM_VALUE_TYPE xValueOfInsertion;
 
 	/* Insert the new list item into the list, sorted in ulListItem order. */
 	xValueOfInsertion = pxNewListItem->xItemValue;
@@ -134,7 +134,7 @@ portTickType xValueOfInsertion;
 	the back marker the iteration loop below will not end.  This means we need
 	to guard against this by checking the value first and modifying the
 	algorithm slightly if necessary. */
-	if( xValueOfInsertion == portMAX_DELAY )
+	if( xValueOfInsertion == listMAX_ITEM_VALUE )
 	{
 		pxIterator = pxList->xListEnd.pxPrevious;
 	}
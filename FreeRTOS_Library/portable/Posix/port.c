@@ -0,0 +1,1056 @@
+/*
+    FreeRTOS V7.5.2 - Copyright (C) 2013 Real Time Engineers Ltd.
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for a POSIX (Linux) host.
+ *
+ * Each task runs in its own host thread, but only the thread belonging to
+ * pxCurrentTCB is ever allowed to execute.  All other task threads are parked
+ * on a private event until the scheduler selects them.  The tick interrupt is
+ * simulated with SIGALRM from an interval timer, and "disabling interrupts"
+ * blocks signal delivery to the running thread.  This allows the unmodified
+ * kernel sources to be exercised on a desktop machine.
+ *
+ * When configUSE_TICKLESS_IDLE is 1 the tick follows CLOCK_MONOTONIC the same
+ * way the LPC17xx TIMER0 driver follows its free running counter: the interval
+ * timer is used as a one shot "match" for the next tick period, so idle
+ * periods can be suppressed and the tick count checked against the host clock
+ * for drift.
+ *
+ * When configNUM_CORES is greater than 1 that many task threads run at once,
+ * one per simulated core, and the kernel data is protected by a spin lock
+ * owned by a core rather than by masking signals alone.  The lock is handed
+ * from thread to thread along with the core when tasks are switched, so it is
+ * held continuously from the point a task enters the kernel until the task
+ * switched in leaves it.  The tick count is also kept to CLOCK_MONOTONIC, as
+ * the tick signal is lost whenever it expires while every core has it masked.
+ *
+ * Build with -pthread, placing this directory ahead of FreeRTOS_Library/portable
+ * on the include path.
+ *----------------------------------------------------------*/
+
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/time.h>
+#include <time.h>
+#include <sched.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The signal used to simulate the tick interrupt. */
+#define portTICK_SIGNAL				SIGALRM
+
+/* The signal one core uses to make another reschedule.  SIGUSR1 is left to
+the application (the benchmarks use it as a peripheral interrupt). */
+#define portYIELD_SIGNAL			SIGUSR2
+
+/* The signal raised by the high resolution alarm.  Real time signals are
+queued and not used by the thread library. */
+#define portHIGH_RES_ALARM_SIGNAL	SIGRTMIN
+
+/* Value of xKernelLockOwner while no core holds the kernel lock. */
+#define portNO_CORE					( ( portBASE_TYPE ) -1 )
+
+/* The length of one tick period on the host clock. */
+#define portTICK_PERIOD_NS			( 1000000000ULL / ( unsigned long long ) configTICK_RATE_HZ )
+
+/* Value used to mark a thread that should exit as soon as it is woken. */
+#define portTHREAD_DYING			( ( portBASE_TYPE ) 1 )
+
+/* Host thread state.  One of these lives at the top of each task stack, which
+is why pxTopOfStack in the TCB points at it. */
+typedef struct xPOSIX_THREAD
+{
+	pthread_t xThreadHandle;
+	pthread_mutex_t xEventMutex;
+	pthread_cond_t xEventCondition;
+	volatile portBASE_TYPE xEventPending;
+	volatile portBASE_TYPE xDying;
+	pdTASK_CODE pxCode;
+	void *pvParameters;
+	unsigned portBASE_TYPE uxSavedCriticalNesting;
+	#if ( configNUM_CORES > 1 )
+		volatile portBASE_TYPE xCoreID;				/* The core the thread is, or was last, running on. */
+		unsigned portBASE_TYPE uxSavedLockCount;	/* The thread's share of uxKernelLockCount while it is switched out. */
+	#endif
+} xPosixThread;
+
+#if ( configNUM_CORES == 1 )
+
+	/* The TCB of the task that is allowed to run. */
+	extern void * volatile pxCurrentTCB;
+	#define prvGetCurrentTCB( xCoreID )	( ( void ) ( xCoreID ), pxCurrentTCB )
+
+	/* Each task maintains its own interrupt status in the critical nesting
+	variable.  The value is saved into the task's thread structure whenever
+	the task is switched out. */
+	static unsigned portBASE_TYPE uxCriticalNesting = 0xaaaaaaaa;
+
+#else
+
+	/* The TCB of the task that is allowed to run on each core. */
+	extern void * volatile pxCurrentTCBs[ configNUM_CORES ];
+	#define prvGetCurrentTCB( xCoreID )	( pxCurrentTCBs[ ( xCoreID ) ] )
+
+	/* Task threads run in parallel, so the nesting count is kept per thread.
+	It is still saved and restored around switches, which is harmless. */
+	static __thread unsigned portBASE_TYPE uxCriticalNesting = 0xaaaaaaaa;
+
+	/* The thread structure of the calling task thread, NULL in the thread
+	that started the scheduler. */
+	static __thread xPosixThread *pxThisThread = NULL;
+
+	/* The kernel lock.  It is recursive, and owned by a core rather than by a
+	thread so that it survives the switch from one task thread to the next.
+	vTaskSuspendAll() holds it with signals unmasked, which is safe as the
+	core does not switch tasks while its scheduler is suspended, and a signal
+	handler that runs on the core in the meantime takes it recursively. */
+	static volatile portBASE_TYPE xKernelLockOwner = portNO_CORE;
+	static volatile unsigned portBASE_TYPE uxKernelLockCount = 0;
+
+#endif /* configNUM_CORES */
+
+/* The signal set blocked while "interrupts" are disabled. */
+static sigset_t xAllSignals;
+
+/* Set once the signal mask has been configured. */
+static portBASE_TYPE xSignalsConfigured = pdFALSE;
+
+/* Used by vPortEndScheduler() to wake the thread that started the kernel. */
+static pthread_mutex_t xSchedulerEndMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t xSchedulerEndCondition = PTHREAD_COND_INITIALIZER;
+static volatile portBASE_TYPE xSchedulerEnded = pdFALSE;
+
+#if ( configUSE_TICKLESS_IDLE == 1 ) || ( configNUM_CORES > 1 )
+
+	/* CLOCK_MONOTONIC time at the start of the tick period the kernel is
+	currently in.  Only advanced in whole periods. */
+	static unsigned long long ullLastTickTime = 0ULL;
+
+#endif
+
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+
+	/* The POSIX timer used as the high resolution alarm. */
+	static timer_t xHighResAlarmTimer;
+
+#endif /* configUSE_HIGH_RES_DELAYS */
+
+/*
+ * Setup the interval timer to generate the tick interrupts.
+ */
+static void prvSetupTimerInterrupt( void );
+
+/*
+ * SIGALRM handler - the simulated tick interrupt.
+ */
+static void prvPortTickSignalHandler( int iSignal );
+
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+
+	/*
+	 * SIGRTMIN handler - the simulated high resolution alarm interrupt.
+	 */
+	static void prvPortHighResAlarmSignalHandler( int iSignal );
+
+#endif /* configUSE_HIGH_RES_DELAYS */
+
+#if ( configNUM_CORES > 1 )
+
+	/*
+	 * SIGUSR2 handler - sent by vPortYieldCore() to make the receiving core
+	 * select a task again.
+	 */
+	static void prvPortYieldSignalHandler( int iSignal );
+
+	/*
+	 * Take and release the kernel lock for the calling core.  Must be called
+	 * with signals masked, so the calling thread cannot change core while it
+	 * holds the lock.
+	 */
+	static void prvGetKernelLock( void );
+	static void prvReleaseKernelLock( void );
+
+#endif /* configNUM_CORES */
+
+/*
+ * Block every maskable signal in the calling thread and install the tick
+ * handler.  Called once before the first task thread is created so all task
+ * threads inherit the blocked mask.
+ */
+static void prvSetupSignals( void );
+
+/*
+ * Entry point of every task thread.  Waits to be scheduled for the first time
+ * before calling the task function.
+ */
+static void *prvTaskThreadEntry( void *pvParameters );
+
+/*
+ * Park the calling task thread until prvSignalThread() is called on it.
+ */
+static void prvWaitForThread( xPosixThread *pxThread );
+static void prvSignalThread( xPosixThread *pxThread );
+
+/*
+ * Hand the processor from pxFrom to pxTo.  Returns when pxFrom is next
+ * selected to run.
+ */
+static void prvSwitchThread( xPosixThread *pxTo, xPosixThread *pxFrom );
+
+#if ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_HIGH_RES_DELAYS == 1 ) || ( configNUM_CORES > 1 )
+
+	/*
+	 * Read the host clock in nanoseconds.
+	 */
+	static unsigned long long prvGetTimeNs( void );
+
+#endif
+
+#if configUSE_TICKLESS_IDLE == 1
+
+	/*
+	 * Arm the interval timer as a one shot that expires at ullMatch, or
+	 * almost immediately if ullMatch has already passed.
+	 */
+	static void prvSetNextTickMatch( unsigned long long ullMatch );
+
+#endif /* configUSE_TICKLESS_IDLE */
+
+/*
+ * Obtain the thread structure belonging to a TCB.
+ */
+#define prvGetThreadFromTCB( pxTCB ) ( *( xPosixThread ** ) ( pxTCB ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+portSTACK_TYPE *pxPortInitialiseStack( portSTACK_TYPE *pxTopOfStack, pdTASK_CODE pxCode, void *pvParameters )
+{
+xPosixThread *pxThread;
+pthread_attr_t xAttributes;
+int iResult;
+unsigned long ulSavedMask;
+
+	if( xSignalsConfigured == pdFALSE )
+	{
+		prvSetupSignals();
+		xSignalsConfigured = pdTRUE;
+	}
+
+	/* Carve the thread structure out of the top of the task stack.  The task
+	code itself executes on the stack allocated by the host thread library. */
+	pxThread = ( ( xPosixThread * ) ( pxTopOfStack + 1 ) ) - 1;
+	pxThread = ( xPosixThread * ) ( ( ( portPOINTER_SIZE_TYPE ) pxThread ) & ( ( portPOINTER_SIZE_TYPE ) ~portBYTE_ALIGNMENT_MASK ) );
+	memset( ( void * ) pxThread, 0x00, sizeof( xPosixThread ) );
+
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xEventPending = pdFALSE;
+	pxThread->xDying = pdFALSE;
+	pxThread->uxSavedCriticalNesting = 0;
+	pthread_mutex_init( &( pxThread->xEventMutex ), NULL );
+	pthread_cond_init( &( pxThread->xEventCondition ), NULL );
+
+	/* The new thread inherits the signal mask of its creator, which is a
+	running task with the tick unmasked unless the tick is masked here.  The
+	mask also stops the tick switching this task out while the thread library
+	holds its internal locks. */
+	ulSavedMask = ulPortSetInterruptMask();
+
+	pthread_attr_init( &xAttributes );
+	iResult = pthread_create( &( pxThread->xThreadHandle ), &xAttributes, prvTaskThreadEntry, ( void * ) pxThread );
+	pthread_attr_destroy( &xAttributes );
+
+	vPortClearInterruptMask( ulSavedMask );
+
+	configASSERT( iResult == 0 );
+	( void ) iResult;
+
+	return ( portSTACK_TYPE * ) pxThread;
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xPortStartScheduler( void )
+{
+	/* Start the timer that generates the tick signal. */
+	prvSetupTimerInterrupt();
+
+	/* Initialise the critical nesting count ready for the first task. */
+	uxCriticalNesting = 0;
+
+	#if ( configNUM_CORES == 1 )
+	{
+		/* Start the first task. */
+		prvSignalThread( prvGetThreadFromTCB( pxCurrentTCB ) );
+	}
+	#else
+	{
+	portBASE_TYPE xCoreID;
+	xPosixThread *pxThread;
+
+		/* Start the task vTaskStartScheduler() chose for each core. */
+		for( xCoreID = 0; xCoreID < ( portBASE_TYPE ) configNUM_CORES; xCoreID++ )
+		{
+			pxThread = prvGetThreadFromTCB( pxCurrentTCBs[ xCoreID ] );
+			pxThread->xCoreID = xCoreID;
+			prvSignalThread( pxThread );
+		}
+	}
+	#endif /* configNUM_CORES */
+
+	/* The thread that started the scheduler does nothing more until
+	vPortEndScheduler() is called. */
+	pthread_mutex_lock( &xSchedulerEndMutex );
+	while( xSchedulerEnded == pdFALSE )
+	{
+		pthread_cond_wait( &xSchedulerEndCondition, &xSchedulerEndMutex );
+	}
+	pthread_mutex_unlock( &xSchedulerEndMutex );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer;
+
+	/* Stop the tick. */
+	memset( &xTimer, 0x00, sizeof( xTimer ) );
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	/* Let xPortStartScheduler() return to its caller. */
+	pthread_mutex_lock( &xSchedulerEndMutex );
+	xSchedulerEnded = pdTRUE;
+	pthread_cond_signal( &xSchedulerEndCondition );
+	pthread_mutex_unlock( &xSchedulerEndMutex );
+
+	/* The calling task never runs again. */
+	prvWaitForThread( prvGetThreadFromTCB( prvGetCurrentTCB( portGET_CORE_ID() ) ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	vPortEnterCritical();
+	vPortYieldFromISR();
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+xPosixThread *pxThreadToSuspend, *pxThreadToResume;
+const portBASE_TYPE xCoreID = portGET_CORE_ID();
+
+	#if ( configNUM_CORES > 1 )
+	{
+		/* Called from the handlers of interrupts that are not part of this
+		port, which only take the lock while they call the kernel. */
+		prvGetKernelLock();
+	}
+	#endif /* configNUM_CORES */
+
+	pxThreadToSuspend = prvGetThreadFromTCB( prvGetCurrentTCB( xCoreID ) );
+	vTaskSwitchContext();
+	pxThreadToResume = prvGetThreadFromTCB( prvGetCurrentTCB( xCoreID ) );
+
+	if( pxThreadToResume != pxThreadToSuspend )
+	{
+		#if ( configNUM_CORES > 1 )
+		{
+			pxThreadToResume->xCoreID = xCoreID;
+		}
+		#endif /* configNUM_CORES */
+
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+
+	#if ( configNUM_CORES > 1 )
+	{
+		prvReleaseKernelLock();
+	}
+	#endif /* configNUM_CORES */
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	portDISABLE_INTERRUPTS();
+
+	#if ( configNUM_CORES > 1 )
+	{
+		prvGetKernelLock();
+	}
+	#endif /* configNUM_CORES */
+
+	uxCriticalNesting++;
+
+	#if ( configRECORD_SECTION_LATENCY == 1 )
+	{
+		if( uxCriticalNesting == 1 )
+		{
+			vTaskSectionLatencyStart( eLatencyCriticalSection, portRETURN_ADDRESS() );
+		}
+	}
+	#endif /* configRECORD_SECTION_LATENCY */
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+
+	#if ( configNUM_CORES > 1 )
+	{
+		prvReleaseKernelLock();
+	}
+	#endif /* configNUM_CORES */
+
+	if( uxCriticalNesting == 0 )
+	{
+		#if ( configRECORD_SECTION_LATENCY == 1 )
+		{
+			vTaskSectionLatencyEnd( eLatencyCriticalSection );
+		}
+		#endif /* configRECORD_SECTION_LATENCY */
+
+		portENABLE_INTERRUPTS();
+	}
+}
+/*-----------------------------------------------------------*/
+
+unsigned long ulPortSetInterruptMask( void )
+{
+sigset_t xPreviousMask;
+
+	pthread_sigmask( SIG_BLOCK, &xAllSignals, &xPreviousMask );
+
+	/* Return non-zero if the tick was already masked, so the matching call to
+	vPortClearInterruptMask() leaves it masked. */
+	return ( unsigned long ) sigismember( &xPreviousMask, portTICK_SIGNAL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( unsigned long ulNewMaskValue )
+{
+	if( ulNewMaskValue == 0UL )
+	{
+		pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_CORES > 1 )
+
+	unsigned long ulPortSetInterruptMaskFromISR( void )
+	{
+	unsigned long ulSavedMask;
+
+		ulSavedMask = ulPortSetInterruptMask();
+		prvGetKernelLock();
+
+		return ulSavedMask;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortClearInterruptMaskFromISR( unsigned long ulNewMaskValue )
+	{
+		prvReleaseKernelLock();
+		vPortClearInterruptMask( ulNewMaskValue );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortGetKernelLock( void )
+	{
+		prvGetKernelLock();
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortReleaseKernelLock( void )
+	{
+		prvReleaseKernelLock();
+	}
+	/*-----------------------------------------------------------*/
+
+	portBASE_TYPE xPortGetCoreID( void )
+	{
+	portBASE_TYPE xReturn = 0;
+
+		/* The thread that started the scheduler runs the kernel as core 0
+		until the task threads take over. */
+		if( pxThisThread != NULL )
+		{
+			xReturn = pxThisThread->xCoreID;
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortYieldCore( portBASE_TYPE xCoreID )
+	{
+		/* Called with the kernel lock held, so the core cannot switch to
+		another thread before the signal is sent.  If the thread is switched
+		out before the signal is delivered, the signal makes it reschedule
+		once more when it next runs, which does no harm. */
+		pthread_kill( prvGetThreadFromTCB( pxCurrentTCBs[ xCoreID ] )->xThreadHandle, portYIELD_SIGNAL );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvGetKernelLock( void )
+	{
+	const portBASE_TYPE xCoreID = portGET_CORE_ID();
+	portBASE_TYPE xExpected;
+
+		/* Only the calling core ever sets the owner to its own ID, so it does
+		not have to be read atomically to check for recursion. */
+		if( xKernelLockOwner != xCoreID )
+		{
+			for( ;; )
+			{
+				xExpected = portNO_CORE;
+				if( __atomic_compare_exchange_n( &xKernelLockOwner, &xExpected, xCoreID, pdFALSE, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) )
+				{
+					break;
+				}
+
+				/* The owner may be sharing a host CPU with this thread. */
+				sched_yield();
+			}
+		}
+
+		uxKernelLockCount++;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvReleaseKernelLock( void )
+	{
+		configASSERT( xKernelLockOwner == portGET_CORE_ID() );
+		configASSERT( uxKernelLockCount );
+
+		uxKernelLockCount--;
+		if( uxKernelLockCount == 0 )
+		{
+			__atomic_store_n( &xKernelLockOwner, portNO_CORE, __ATOMIC_RELEASE );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvPortYieldSignalHandler( int iSignal )
+	{
+		( void ) iSignal;
+		vPortYieldFromISR();
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configNUM_CORES */
+
+void vPortCleanUpTCB( void *pxTCB )
+{
+xPosixThread *pxThread = prvGetThreadFromTCB( pxTCB );
+unsigned long ulSavedMask;
+
+	/* As in pxPortInitialiseStack(), the calling task must not be switched
+	out while the thread library holds its locks. */
+	ulSavedMask = ulPortSetInterruptMask();
+
+	/* The thread is parked waiting for an event that will never come.  Ask it
+	to exit, and wait until it has done so before the stack holding its
+	thread structure is freed. */
+	pxThread->xDying = portTHREAD_DYING;
+	prvSignalThread( pxThread );
+	pthread_join( pxThread->xThreadHandle, NULL );
+
+	pthread_cond_destroy( &( pxThread->xEventCondition ) );
+	pthread_mutex_destroy( &( pxThread->xEventMutex ) );
+
+	vPortClearInterruptMask( ulSavedMask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPortTickSignalHandler( int iSignal )
+{
+	( void ) iSignal;
+
+	/* All signals are blocked for the duration of the handler (see
+	prvSetupSignals()), so the handler behaves as the highest priority
+	kernel interrupt would on real hardware. */
+	#if ( configNUM_CORES > 1 )
+	{
+	unsigned long long ullNow;
+	portBASE_TYPE xSwitchRequired = pdFALSE;
+
+		/* The tick is delivered to whichever core's thread has it unmasked.
+		Tasks it unblocks that should run on other cores are given to them
+		by the kernel through vPortYieldCore(). */
+		prvGetKernelLock();
+
+		/* A timer expiry that falls while every core has the tick masked is
+		merged with the next one, as signals do not queue.  Process every
+		whole period that has passed so the tick count does not fall behind
+		the host clock. */
+		ullNow = prvGetTimeNs();
+		while( ( ullNow - ullLastTickTime ) >= portTICK_PERIOD_NS )
+		{
+			ullLastTickTime += portTICK_PERIOD_NS;
+			if( xTaskIncrementTick() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+		}
+
+		if( xSwitchRequired != pdFALSE )
+		{
+			vPortYieldFromISR();
+		}
+		prvReleaseKernelLock();
+	}
+	#elif configUSE_TICKLESS_IDLE == 1
+	{
+	unsigned long long ullNow = prvGetTimeNs();
+	portBASE_TYPE xSwitchRequired = pdFALSE;
+
+		/* Process every whole period that has passed, which is more than one
+		if the signal was delivered late or ended a sleep. */
+		while( ( ullNow - ullLastTickTime ) >= portTICK_PERIOD_NS )
+		{
+			ullLastTickTime += portTICK_PERIOD_NS;
+			if( xTaskIncrementTick() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+		}
+
+		prvSetNextTickMatch( ullLastTickTime + portTICK_PERIOD_NS );
+
+		if( xSwitchRequired != pdFALSE )
+		{
+			vPortYieldFromISR();
+		}
+	}
+	#else
+	{
+		if( xTaskIncrementTick() != pdFALSE )
+		{
+			vPortYieldFromISR();
+		}
+	}
+	#endif /* configUSE_TICKLESS_IDLE */
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupTimerInterrupt( void )
+{
+	#if configUSE_TICKLESS_IDLE == 1
+	{
+		ullLastTickTime = prvGetTimeNs();
+		prvSetNextTickMatch( ullLastTickTime + portTICK_PERIOD_NS );
+	}
+	#else
+	{
+	struct itimerval xTimer;
+
+		#if ( configNUM_CORES > 1 )
+		{
+			ullLastTickTime = prvGetTimeNs();
+		}
+		#endif /* configNUM_CORES */
+
+		xTimer.it_interval.tv_sec = 0;
+		xTimer.it_interval.tv_usec = 1000000L / configTICK_RATE_HZ;
+		xTimer.it_value = xTimer.it_interval;
+		setitimer( ITIMER_REAL, &xTimer, NULL );
+	}
+	#endif /* configUSE_TICKLESS_IDLE */
+
+	#if ( configUSE_HIGH_RES_DELAYS == 1 )
+	{
+	struct sigevent xEvent;
+	int iResult;
+
+		/* The signal is sent to the process, so as with the tick it is
+		delivered to whichever task thread has interrupts enabled. */
+		memset( &xEvent, 0x00, sizeof( xEvent ) );
+		xEvent.sigev_notify = SIGEV_SIGNAL;
+		xEvent.sigev_signo = portHIGH_RES_ALARM_SIGNAL;
+		iResult = timer_create( CLOCK_MONOTONIC, &xEvent, &xHighResAlarmTimer );
+		configASSERT( iResult == 0 );
+		( void ) iResult;
+	}
+	#endif /* configUSE_HIGH_RES_DELAYS */
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignals( void )
+{
+struct sigaction xTickAction;
+
+	sigfillset( &xAllSignals );
+
+	/* Leave SIGINT deliverable so a debugger can still break in while the
+	kernel is inside a critical section, and SIGTERM so the process can
+	always be stopped. */
+	sigdelset( &xAllSignals, SIGINT );
+	sigdelset( &xAllSignals, SIGTERM );
+
+	/* Threads inherit the signal mask of their creator, so blocking everything
+	here means only the running task thread ever unblocks the tick. */
+	pthread_sigmask( SIG_SETMASK, &xAllSignals, NULL );
+
+	memset( &xTickAction, 0x00, sizeof( xTickAction ) );
+	xTickAction.sa_handler = prvPortTickSignalHandler;
+	sigfillset( &xTickAction.sa_mask );
+	sigaction( portTICK_SIGNAL, &xTickAction, NULL );
+
+	#if ( configNUM_CORES > 1 )
+	{
+		xTickAction.sa_handler = prvPortYieldSignalHandler;
+		sigaction( portYIELD_SIGNAL, &xTickAction, NULL );
+	}
+	#endif /* configNUM_CORES */
+
+	#if ( configUSE_HIGH_RES_DELAYS == 1 )
+	{
+		xTickAction.sa_handler = prvPortHighResAlarmSignalHandler;
+		sigaction( portHIGH_RES_ALARM_SIGNAL, &xTickAction, NULL );
+	}
+	#endif /* configUSE_HIGH_RES_DELAYS */
+}
+/*-----------------------------------------------------------*/
+
+static void *prvTaskThreadEntry( void *pvParameters )
+{
+xPosixThread *pxThread = ( xPosixThread * ) pvParameters;
+
+	#if ( configNUM_CORES > 1 )
+	{
+		pxThisThread = pxThread;
+	}
+	#endif /* configNUM_CORES */
+
+	prvWaitForThread( pxThread );
+
+	if( pxThread->xDying == pdFALSE )
+	{
+		/* First time this task has been selected.  Tasks start with interrupts
+		enabled. */
+		uxCriticalNesting = 0;
+
+		#if ( configNUM_CORES > 1 )
+		{
+			/* The thread that switched to this one left the kernel lock held
+			for it, unless this is one of the first tasks to start. */
+			if( xKernelLockOwner == pxThread->xCoreID )
+			{
+				uxKernelLockCount = 0;
+				__atomic_store_n( &xKernelLockOwner, portNO_CORE, __ATOMIC_RELEASE );
+			}
+		}
+		#endif /* configNUM_CORES */
+
+		portENABLE_INTERRUPTS();
+
+		pxThread->pxCode( pxThread->pvParameters );
+
+		/* Task functions must not return.  Treat a return as a request for
+		the task to delete itself. */
+		vTaskDelete( NULL );
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitForThread( xPosixThread *pxThread )
+{
+	pthread_mutex_lock( &( pxThread->xEventMutex ) );
+	while( pxThread->xEventPending == pdFALSE )
+	{
+		pthread_cond_wait( &( pxThread->xEventCondition ), &( pxThread->xEventMutex ) );
+	}
+	pxThread->xEventPending = pdFALSE;
+	pthread_mutex_unlock( &( pxThread->xEventMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSignalThread( xPosixThread *pxThread )
+{
+	pthread_mutex_lock( &( pxThread->xEventMutex ) );
+	pxThread->xEventPending = pdTRUE;
+	pthread_cond_signal( &( pxThread->xEventCondition ) );
+	pthread_mutex_unlock( &( pxThread->xEventMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( xPosixThread *pxTo, xPosixThread *pxFrom )
+{
+	/* The interrupt status is a property of the task, not of the processor. */
+	pxFrom->uxSavedCriticalNesting = uxCriticalNesting;
+
+	#if ( configNUM_CORES > 1 )
+	{
+		/* So is the depth to which it holds the kernel lock.  pxTo may start
+		changing the count as soon as it is signalled. */
+		pxFrom->uxSavedLockCount = uxKernelLockCount;
+	}
+	#endif /* configNUM_CORES */
+
+	prvSignalThread( pxTo );
+	prvWaitForThread( pxFrom );
+
+	if( pxFrom->xDying != pdFALSE )
+	{
+		/* The task was deleted while it was switched out. */
+		pthread_exit( NULL );
+	}
+
+	uxCriticalNesting = pxFrom->uxSavedCriticalNesting;
+
+	#if ( configNUM_CORES > 1 )
+	{
+		uxKernelLockCount = pxFrom->uxSavedLockCount;
+	}
+	#endif /* configNUM_CORES */
+}
+/*-----------------------------------------------------------*/
+
+#if configUSE_TICKLESS_IDLE == 1
+
+	void vPortSuppressTicksAndSleep( portTickType xExpectedIdleTime )
+	{
+	sigset_t xTickSignal;
+	unsigned long long ullElapsedTicks;
+	portTickType xModifiableIdleTime;
+	int iSignal;
+
+		/* Masking "interrupts" leaves the tick signal pending rather than
+		delivered, which is the host equivalent of cpsid i followed by wfi. */
+		portDISABLE_INTERRUPTS();
+
+		if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+		{
+			portENABLE_INTERRUPTS();
+			return;
+		}
+
+		/* The task that is due to unblock does so at the start of tick period
+		xExpectedIdleTime, counting the current period as zero. */
+		prvSetNextTickMatch( ullLastTickTime + ( portTICK_PERIOD_NS * ( unsigned long long ) xExpectedIdleTime ) );
+
+		xModifiableIdleTime = xExpectedIdleTime;
+		configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+		if( xModifiableIdleTime > 0 )
+		{
+			/* The tick and the high resolution alarm are the only simulated
+			interrupts, so they are the only things that can end the sleep.
+			sigwait() consumes the signal, the same as wfi returning without
+			the handler having run. */
+			sigemptyset( &xTickSignal );
+			sigaddset( &xTickSignal, portTICK_SIGNAL );
+
+			#if ( configUSE_HIGH_RES_DELAYS == 1 )
+			{
+				sigaddset( &xTickSignal, portHIGH_RES_ALARM_SIGNAL );
+			}
+			#endif /* configUSE_HIGH_RES_DELAYS */
+
+			( void ) sigwait( &xTickSignal, &iSignal );
+
+			#if ( configUSE_HIGH_RES_DELAYS == 1 )
+			{
+				/* Unlike the tick, the alarm has no clock to catch up from,
+				so it is pended again for its handler to run once interrupts
+				are enabled below. */
+				if( iSignal == portHIGH_RES_ALARM_SIGNAL )
+				{
+					pthread_kill( pthread_self(), portHIGH_RES_ALARM_SIGNAL );
+				}
+			}
+			#endif /* configUSE_HIGH_RES_DELAYS */
+		}
+		configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+		ullElapsedTicks = ( prvGetTimeNs() - ullLastTickTime ) / portTICK_PERIOD_NS;
+
+		/* Leave the period in which the task unblocks to the tick handler, as
+		only xTaskIncrementTick() moves the task to the ready list. */
+		if( ullElapsedTicks >= ( unsigned long long ) xExpectedIdleTime )
+		{
+			ullElapsedTicks = ( unsigned long long ) xExpectedIdleTime - 1ULL;
+		}
+
+		ullLastTickTime += portTICK_PERIOD_NS * ullElapsedTicks;
+		vTaskStepTick( ( portTickType ) ullElapsedTicks );
+
+		/* Fires almost at once if the wake up period has already started. */
+		prvSetNextTickMatch( ullLastTickTime + portTICK_PERIOD_NS );
+
+		portENABLE_INTERRUPTS();
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvSetNextTickMatch( unsigned long long ullMatch )
+	{
+	struct itimerval xTimer;
+	unsigned long long ullNow = prvGetTimeNs(), ullDelay;
+
+		/* A zero it_value would disarm the timer, so a match that has
+		already passed is brought forward to 1us from now instead. */
+		ullDelay = ( ullMatch > ullNow ) ? ( ullMatch - ullNow ) : 0ULL;
+		ullDelay = ( ullDelay + 999ULL ) / 1000ULL;
+		if( ullDelay == 0ULL )
+		{
+			ullDelay = 1ULL;
+		}
+
+		memset( &xTimer, 0x00, sizeof( xTimer ) );
+		xTimer.it_value.tv_sec = ( time_t ) ( ullDelay / 1000000ULL );
+		xTimer.it_value.tv_usec = ( suseconds_t ) ( ullDelay % 1000000ULL );
+		setitimer( ITIMER_REAL, &xTimer, NULL );
+	}
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_HIGH_RES_DELAYS == 1 ) || ( configNUM_CORES > 1 )
+
+	static unsigned long long prvGetTimeNs( void )
+	{
+	struct timespec xNow;
+
+		clock_gettime( CLOCK_MONOTONIC, &xNow );
+		return ( ( unsigned long long ) xNow.tv_sec * 1000000000ULL ) + ( unsigned long long ) xNow.tv_nsec;
+	}
+
+#endif
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+
+	unsigned long ulPortGetHighResTime( void )
+	{
+		return ( unsigned long ) ( prvGetTimeNs() / 1000ULL );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortSetHighResAlarm( unsigned long ulAlarmTime )
+	{
+	struct itimerspec xAlarm;
+	unsigned long long ullNowUs = prvGetTimeNs() / 1000ULL, ullAlarmNs;
+	unsigned long ulTimeToWait;
+
+		/* Work out the alarm time in full from the difference to now, as the
+		microsecond count may have wrapped.  A time that has passed gives an
+		absolute expiry in the past, which the timer signals at once, the
+		same as the LPC17xx driver pending the interrupt by hand. */
+		ulTimeToWait = ulAlarmTime - ( unsigned long ) ullNowUs;
+		if( ulTimeToWait > ( ( ~( unsigned long ) 0UL ) >> 1 ) )
+		{
+			ulTimeToWait = 0UL;
+		}
+		ullAlarmNs = ( ullNowUs + ( unsigned long long ) ulTimeToWait ) * 1000ULL;
+
+		memset( &xAlarm, 0x00, sizeof( xAlarm ) );
+		xAlarm.it_value.tv_sec = ( time_t ) ( ullAlarmNs / 1000000000ULL );
+		xAlarm.it_value.tv_nsec = ( long ) ( ullAlarmNs % 1000000000ULL );
+		timer_settime( xHighResAlarmTimer, TIMER_ABSTIME, &xAlarm, NULL );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvPortHighResAlarmSignalHandler( int iSignal )
+	{
+		( void ) iSignal;
+
+		/* xTaskHighResAlarm() masks interrupts itself, which also takes the
+		kernel lock when there is more than one core. */
+		portEND_SWITCHING_ISR( xTaskHighResAlarm() );
+	}
+
+#endif /* configUSE_HIGH_RES_DELAYS */
+/*-----------------------------------------------------------*/
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	unsigned long ulPortGetRunTimeCounterValue( void )
+	{
+	struct timespec xNow;
+
+		/* Where unsigned long is only 32 bits this wraps every 4.3 seconds,
+		which the kernel allows for as long as tasks switch more often than
+		that. */
+		clock_gettime( CLOCK_MONOTONIC, &xNow );
+		return ( ( unsigned long ) xNow.tv_sec * 1000000000UL ) + ( unsigned long ) xNow.tv_nsec;
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
@@ -0,0 +1,246 @@
+/*
+    FreeRTOS V7.5.2 - Copyright (C) 2013 Real Time Engineers Ltd.
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-----------------------------------------------------------
+ * Port specific definitions.
+ *
+ * The settings in this file configure FreeRTOS correctly for the
+ * given hardware and compiler.
+ *
+ * These settings should not be altered.
+ *-----------------------------------------------------------
+ */
+
+/* Type definitions. */
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		int
+#define portSHORT		short
+#define portSTACK_TYPE	unsigned long
+#define portBASE_TYPE	long
+
+#if( configUSE_16_BIT_TICKS == 1 )
+	typedef unsigned portSHORT portTickType;
+	#define portMAX_DELAY ( portTickType ) 0xffff
+#else
+	typedef unsigned portLONG portTickType;
+	#define portMAX_DELAY ( portTickType ) 0xffffffff
+#endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+#define portSTACK_GROWTH			( -1 )
+#define portTICK_RATE_MS			( ( portTickType ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT			8
+/*-----------------------------------------------------------*/
+
+/* Scheduler utilities.  Every task is a host thread, only one of which is
+allowed to run at any one time on each core.  A yield hands the processor to the thread
+of the task selected by vTaskSwitchContext() and parks the calling thread. */
+extern void vPortYield( void );
+extern void vPortYieldFromISR( void );
+#define portYIELD()					vPortYield()
+#define portEND_SWITCHING_ISR( xSwitchRequired ) if( xSwitchRequired ) vPortYieldFromISR()
+#define portYIELD_FROM_ISR( x ) portEND_SWITCHING_ISR( x )
+
+#if ( configNUM_CORES > 1 )
+	/* Each core is a task thread that is allowed to run at the same time as
+	the others.  A core is interrupted with a signal sent to its thread. */
+	extern portBASE_TYPE xPortGetCoreID( void );
+	extern void vPortYieldCore( portBASE_TYPE xCoreID );
+	#define portGET_CORE_ID()		xPortGetCoreID()
+	#define portYIELD_CORE( x )		vPortYieldCore( x )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Critical section management.  Interrupts are simulated with signals, so
+masking interrupts means blocking signal delivery to the running thread. */
+extern void vPortEnterCritical( void );
+extern void vPortExitCritical( void );
+extern unsigned long ulPortSetInterruptMask( void );
+extern void vPortClearInterruptMask( unsigned long ulNewMaskValue );
+#if ( configNUM_CORES > 1 )
+	/* With more than one core masking signals only stops the calling core
+	switching tasks, so critical sections and the interrupt safe API also
+	hold the kernel lock. */
+	extern unsigned long ulPortSetInterruptMaskFromISR( void );
+	extern void vPortClearInterruptMaskFromISR( unsigned long ulNewMaskValue );
+	#define portSET_INTERRUPT_MASK_FROM_ISR()		ulPortSetInterruptMaskFromISR()
+	#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortClearInterruptMaskFromISR(x)
+	#define portSET_INTERRUPT_MASK()				ulPortSetInterruptMask()
+	#define portCLEAR_INTERRUPT_MASK(x)				vPortClearInterruptMask(x)
+
+	/* The kernel lock on its own, for vTaskSuspendAll(), which holds it with
+	interrupts enabled.  Must be called with interrupts masked. */
+	extern void vPortGetKernelLock( void );
+	extern void vPortReleaseKernelLock( void );
+	#define portGET_KERNEL_LOCK()					vPortGetKernelLock()
+	#define portRELEASE_KERNEL_LOCK()				vPortReleaseKernelLock()
+#else
+	#define portSET_INTERRUPT_MASK_FROM_ISR()		ulPortSetInterruptMask()
+	#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortClearInterruptMask(x)
+#endif
+#define portDISABLE_INTERRUPTS()				( void ) ulPortSetInterruptMask()
+#define portENABLE_INTERRUPTS()					vPortClearInterruptMask( 0 )
+#define portENTER_CRITICAL()					vPortEnterCritical()
+#define portEXIT_CRITICAL()						vPortExitCritical()
+/*-----------------------------------------------------------*/
+
+/* Tickless idle support, see vPortSuppressTicksAndSleep() in port.c. */
+#ifndef portSUPPRESS_TICKS_AND_SLEEP
+	extern void vPortSuppressTicksAndSleep( portTickType xExpectedIdleTime );
+	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Run time stats clock, unless FreeRTOSConfig.h provides its own.  Counts
+host nanoseconds, see ulPortGetRunTimeCounterValue() in port.c. */
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	extern unsigned long ulPortGetRunTimeCounterValue( void );
+	#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+		#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+	#endif
+	#if !defined( portGET_RUN_TIME_COUNTER_VALUE ) && !defined( portALT_GET_RUN_TIME_COUNTER_VALUE )
+		#define portGET_RUN_TIME_COUNTER_VALUE()	ulPortGetRunTimeCounterValue()
+	#endif
+#endif
+/*-----------------------------------------------------------*/
+
+/* High resolution delays.  The clock counts host microseconds and the alarm
+is a POSIX timer, see vPortSetHighResAlarm() in port.c. */
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+	extern unsigned long ulPortGetHighResTime( void );
+	extern void vPortSetHighResAlarm( unsigned long ulAlarmTime );
+	#define portGET_HIGH_RES_TIME()					ulPortGetHighResTime()
+	#define portSET_HIGH_RES_ALARM( ulAlarmTime )	vPortSetHighResAlarm( ulAlarmTime )
+	#define portHIGH_RES_COUNTS_PER_US				1UL
+#endif
+/*-----------------------------------------------------------*/
+
+/* The host thread backing a task has to be reclaimed before the memory that
+holds its control block is freed. */
+extern void vPortCleanUpTCB( void *pxTCB );
+#define portCLEAN_UP_TCB( pxTCB )	vPortCleanUpTCB( pxTCB )
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site.  These are
+not necessary for to use this port.  They are defined so the common demo files
+(which build with all the ports) will build. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+/*-----------------------------------------------------------*/
+
+/* Architecture specific optimisations. */
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+	/* Check the configuration.  Each bit map holds 32 priorities.  Above 32
+	priorities tasks.c keeps a bit map per group of 32 priorities and one more
+	for the groups, so two levels reach 32 * 32 priorities. */
+	#if( configMAX_PRIORITIES > 1024 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 1024.
+	#endif
+
+	/* Store/clear the ready priorities in a bit map. */
+	#define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+	#define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+	/*-----------------------------------------------------------*/
+
+	#define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) uxTopPriority = ( 31 - __builtin_clz( ( unsigned int ) ( uxReadyPriorities ) ) )
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+/*-----------------------------------------------------------*/
+
+/* portNOP() is not required by this port. */
+#define portNOP()
+
+/* The address a function will return to, used to identify its caller. */
+#define portRETURN_ADDRESS() __builtin_return_address( 0 )
+
+/* With one core only one task thread runs at a time and threads hand over
+through a mutex, so only the compiler has to be stopped reordering accesses
+around the signal handlers that simulate interrupts.  With more than one core
+task threads really do run in parallel. */
+#if ( configNUM_CORES > 1 )
+	#define portMEMORY_BARRIER() __sync_synchronize()
+#else
+	#define portMEMORY_BARRIER() __asm volatile( "" ::: "memory" )
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTMACRO_H */
+
@@ -330,6 +330,16 @@ void vPortEnterCritical( void )
 	uxCriticalNesting++;
 	__asm volatile( "dsb" );
 	__asm volatile( "isb" );
+
+	#if ( configRECORD_SECTION_LATENCY == 1 )
+	{
+		/* uxCriticalNesting only reaches 1 once the scheduler has started. */
+		if( uxCriticalNesting == 1 )
+		{
+			vTaskSectionLatencyStart( eLatencyCriticalSection, portRETURN_ADDRESS() );
+		}
+	}
+	#endif /* configRECORD_SECTION_LATENCY */
 }
 /*-----------------------------------------------------------*/
 
@@ -338,6 +348,12 @@ void vPortExitCritical( void )
 	uxCriticalNesting--;
 	if( uxCriticalNesting == 0 )
 	{
+		#if ( configRECORD_SECTION_LATENCY == 1 )
+		{
+			vTaskSectionLatencyEnd( eLatencyCriticalSection );
+		}
+		#endif /* configRECORD_SECTION_LATENCY */
+
 		portENABLE_INTERRUPTS();
 	}
 }
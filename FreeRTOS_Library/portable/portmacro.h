@@ -127,6 +127,26 @@ extern void vPortClearInterruptMask( unsigned long ulNewMaskValue );
 #define portEXIT_CRITICAL()						vPortExitCritical()
 /*-----------------------------------------------------------*/
 
+/* High resolution delays.  The clock is the free running TIMER0 counter and
+the alarm its match register 1, both owned by the TIMER0 tick driver selected
+with configUSE_TICKLESS_IDLE set to 2 (see SimpleDemo/inc/tickless.c). */
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+
+	#if ( configUSE_TICKLESS_IDLE != 2 )
+		#error configUSE_HIGH_RES_DELAYS needs the TIMER0 tick, so configUSE_TICKLESS_IDLE must be 2.
+	#endif
+
+	#define portTIMER0_TC_REG				( * ( ( volatile unsigned long * ) 0x40004008 ) )
+
+	extern void vPortSetHighResAlarm( unsigned long ulAlarmTime );
+	extern unsigned long ulPortHighResCountsPerUs;
+	#define portGET_HIGH_RES_TIME()					portTIMER0_TC_REG
+	#define portSET_HIGH_RES_ALARM( ulAlarmTime )	vPortSetHighResAlarm( ulAlarmTime )
+	#define portHIGH_RES_COUNTS_PER_US				ulPortHighResCountsPerUs
+
+#endif /* configUSE_HIGH_RES_DELAYS */
+/*-----------------------------------------------------------*/
+
 /* Task function macros as described on the FreeRTOS.org WEB site.  These are
 not necessary for to use this port.  They are defined so the common demo files
 (which build with all the ports) will build. */
@@ -141,6 +161,31 @@ not necessary for to use this port.  They are defined so the common demo files
 #endif
 /*-----------------------------------------------------------*/
 
+/* Run time stats clock.  Unless FreeRTOSConfig.h provides its own, the DWT
+cycle counter is used, so run time is measured in core clock cycles.  The
+counter wraps every 2^32 cycles, which the kernel allows for.  It does not
+count while the core clock is stopped by wfi, so time spent asleep in tickless
+idle is not part of the totals.  The registers are not defined by CMSIS v1.30.
+The counter is never reset here as the trace recorder uses it too. */
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	#define portDEMCR_REG				( * ( ( volatile unsigned long * ) 0xe000edfc ) )
+	#define portDWT_CTRL_REG			( * ( ( volatile unsigned long * ) 0xe0001000 ) )
+	#define portDWT_CYCCNT_REG			( * ( ( volatile unsigned long * ) 0xe0001004 ) )
+	#define portDEMCR_TRCENA_BIT		( 1UL << 24UL )
+	#define portDWT_CYCCNTENA_BIT		( 1UL << 0UL )
+
+	#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+		#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()	{ portDEMCR_REG |= portDEMCR_TRCENA_BIT; portDWT_CTRL_REG |= portDWT_CYCCNTENA_BIT; }
+	#endif
+
+	#if !defined( portGET_RUN_TIME_COUNTER_VALUE ) && !defined( portALT_GET_RUN_TIME_COUNTER_VALUE )
+		#define portGET_RUN_TIME_COUNTER_VALUE()			portDWT_CYCCNT_REG
+	#endif
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
 /* Architecture specific optimisations. */
 #if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
 
@@ -153,9 +198,11 @@ not necessary for to use this port.  They are defined so the common demo files
 		return ucReturn;
 	}
 
-	/* Check the configuration. */
-	#if( configMAX_PRIORITIES > 32 )
-		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+	/* Check the configuration.  Each bit map holds 32 priorities.  Above 32
+	priorities tasks.c keeps a bit map per group of 32 priorities and one more
+	for the groups, so two levels reach 32 * 32 priorities. */
+	#if( configMAX_PRIORITIES > 1024 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 1024.
 	#endif
 
 	/* Store/clear the ready priorities in a bit map. */
@@ -178,6 +225,14 @@ not necessary for to use this port.  They are defined so the common demo files
 /* portNOP() is not required by this port. */
 #define portNOP()
 
+/* The address a function will return to, used to identify its caller. */
+#define portRETURN_ADDRESS() __builtin_return_address( 0 )
+
+/* Stops the compiler moving memory accesses across the barrier.  The core
+executes loads and stores in program order, so no barrier instruction is
+required. */
+#define portMEMORY_BARRIER() __asm volatile( "" ::: "memory" )
+
 #ifdef __cplusplus
 }
 #endif
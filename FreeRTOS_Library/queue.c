@@ -109,6 +109,10 @@ zero. */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH ( ( unsigned portBASE_TYPE ) 0 )
 #define queueMUTEX_GIVE_BLOCK_TIME		 ( ( portTickType ) 0U )
 
+/* The ceiling of a mutex that uses priority inheritance rather than a
+priority ceiling. */
+#define queueNO_PRIORITY_CEILING		( ( unsigned portBASE_TYPE ) 0U )
+
 
 /*
  * Definition of the queue used by the scheduler.
@@ -137,6 +141,10 @@ typedef struct QueueDefinition
 	volatile signed portBASE_TYPE xRxLock;	/*< Stores the number of items received from the queue (removed from the queue) while the queue was locked.  Set to queueUNLOCKED when the queue is not locked. */
 	volatile signed portBASE_TYPE xTxLock;	/*< Stores the number of items transmitted to the queue (added to the queue) while the queue was locked.  Set to queueUNLOCKED when the queue is not locked. */
 
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+		unsigned char ucStaticallyAllocated;	/*< Set to pdTRUE if the memory used by the queue was provided by the application, so it is not freed when the queue is deleted. */
+	#endif
+
 	#if ( configUSE_TRACE_FACILITY == 1 )
 		unsigned char ucQueueNumber;
 		unsigned char ucQueueType;
@@ -146,6 +154,19 @@ typedef struct QueueDefinition
 		struct QueueDefinition *pxQueueSetContainer;
 	#endif
 
+	#if ( configUSE_MUTEXES == 1 )
+		xListItem xMutexHeldItem;				/*< Held in the list of mutexes held by the mutex holder.  Its owner is xTasksWaitingToReceive, from which the holder's inherited priority is worked out.  Only used by mutexes. */
+	#endif
+
+	#if ( configUSE_READ_WRITE_LOCKS == 1 )
+		xListItem xWriteHeldItem;				/*< As xMutexHeldItem, but owned by xTasksWaitingToSend, so the writer holding a read write lock also inherits from the writers waiting for it. */
+	#endif
+
+	#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+		unsigned portBASE_TYPE uxCeilingPriority;	/*< The priority the holder of a mutex runs at while it holds the mutex, or queueNO_PRIORITY_CEILING if the mutex uses priority inheritance.  Only used by mutexes. */
+		unsigned portBASE_TYPE uxPreviousCeiling;	/*< The ceiling the holder held before it took the mutex, restored when the mutex is given back. */
+	#endif
+
 } xQUEUE;
 /*-----------------------------------------------------------*/
 
@@ -197,15 +218,88 @@ static signed portBASE_TYPE prvIsQueueFull( const xQUEUE *pxQueue ) PRIVILEGED_F
 
 /*
  * Copies an item into the queue, either at the front of the queue or the
- * back of the queue.
+ * back of the queue.  Returns pdTRUE if giving back a mutex lowered the
+ * priority of the calling task below that of a ready task, in which case a
+ * yield is required.
  */
-static void prvCopyDataToQueue( xQUEUE *pxQueue, const void *pvItemToQueue, portBASE_TYPE xPosition ) PRIVILEGED_FUNCTION;
+static portBASE_TYPE prvCopyDataToQueue( xQUEUE *pxQueue, const void *pvItemToQueue, portBASE_TYPE xPosition ) PRIVILEGED_FUNCTION;
 
 /*
  * Copies an item out of a queue.
  */
 static void prvCopyDataFromQueue( xQUEUE * const pxQueue, const void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copy uxCount items to the back of a queue, or from the front of a queue,
+ * with one memcpy() or, where the items wrap around the end of the storage
+ * area, two.  The number of items in the queue is not updated.
+ */
+static void prvCopyItemsToQueue( xQUEUE * const pxQueue, const signed char *pcItems, unsigned portBASE_TYPE uxCount ) PRIVILEGED_FUNCTION;
+static void prvCopyItemsFromQueue( xQUEUE * const pxQueue, signed char *pcBuffer, unsigned portBASE_TYPE uxCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks up to uxCount of the tasks on pxEventList.  Returns pdTRUE if one
+ * of them has a priority above that of the calling task.  Must be called from
+ * a critical section.
+ */
+static portBASE_TYPE prvUnblockWaitingTasks( xList * const pxEventList, unsigned portBASE_TYPE uxCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Does for uxCount items just sent to a queue what sending each of them would
+ * have done: posts an event to the queue set the queue is a member of for
+ * each item, or unblocks a task waiting to receive for each item.  Returns
+ * pdTRUE if a context switch is required.  Must be called from a critical
+ * section.
+ */
+static portBASE_TYPE prvNotifyItemsSent( xQUEUE * const pxQueue, unsigned portBASE_TYPE uxCount ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_MUTEXES == 1 )
+
+	/*
+	 * Brings the priority of the holder of pxMutex into line with the tasks
+	 * blocked on the mutexes it holds.  If the holder is itself blocked on a
+	 * mutex the holder of that mutex is updated in turn, and so on along the
+	 * chain.  Must be called from a critical section.
+	 */
+	static void prvUpdateMutexHolderPriority( xQUEUE *pxMutex ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+
+	/*
+	 * Returns pdTRUE if the read write lock can be taken for writing (xWrite
+	 * is pdTRUE) or for reading (xWrite is pdFALSE).  Readers are held back
+	 * while a writer is waiting, so a stream of readers cannot starve it.
+	 */
+	static portBASE_TYPE prvIsReadWriteLockAvailable( const xQUEUE *pxLock, portBASE_TYPE xWrite ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Unblocks the tasks that can now take a read write lock that is not
+	 * held for writing: the highest priority waiting writer if there are no
+	 * readers, otherwise every waiting reader if no writer is waiting.  The
+	 * writer is given the lock before it is unblocked, so a reader cannot
+	 * take the lock before the writer runs.  Returns pdTRUE if an unblocked task has a priority above that of the
+	 * calling task.  Must be called from a critical section.
+	 */
+	static portBASE_TYPE prvUnblockReadWriteLockWaiters( xQUEUE *pxLock ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Initialises a queue once the memory for the queue structure and its storage
+ * area has been obtained, whether from the heap or from the application.
+ */
+static void prvInitialiseNewQueue( unsigned portBASE_TYPE uxQueueLength, unsigned portBASE_TYPE uxItemSize, signed char *pcQueueStorage, unsigned char ucQueueType, xQUEUE *pxNewQueue ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_MUTEXES == 1 )
+	/*
+	 * Initialises a queue structure for use as a mutex, then gives the mutex
+	 * so it starts in the available state.
+	 */
+	static void prvInitialiseMutex( xQUEUE *pxNewQueue, unsigned char ucQueueType ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -284,12 +378,9 @@ xQueueHandle xQueueGenericCreate( unsigned portBASE_TYPE uxQueueLength, unsigned
 {
 xQUEUE *pxNewQueue;
 size_t xQueueSizeInBytes;
+signed char *pcQueueStorage;
 xQueueHandle xReturn = NULL;
 
-	/* Remove compiler warnings about unused parameters should
-	configUSE_TRACE_FACILITY not be set to 1. */
-	( void ) ucQueueType;
-
 	/* Allocate the new queue structure. */
 	if( uxQueueLength > ( unsigned portBASE_TYPE ) 0 )
 	{
@@ -300,28 +391,19 @@ xQueueHandle xReturn = NULL;
 			longer than asked for to make wrap checking easier/faster. */
 			xQueueSizeInBytes = ( size_t ) ( uxQueueLength * uxItemSize ) + ( size_t ) 1; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
-			pxNewQueue->pcHead = ( signed char * ) pvPortMalloc( xQueueSizeInBytes );
-			if( pxNewQueue->pcHead != NULL )
+			pcQueueStorage = ( signed char * ) pvPortMalloc( xQueueSizeInBytes );
+			if( pcQueueStorage != NULL )
 			{
-				/* Initialise the queue members as described above where the
-				queue type is defined. */
-				pxNewQueue->uxLength = uxQueueLength;
-				pxNewQueue->uxItemSize = uxItemSize;
-				( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
-
-				#if ( configUSE_TRACE_FACILITY == 1 )
-				{
-					pxNewQueue->ucQueueType = ucQueueType;
-				}
-				#endif /* configUSE_TRACE_FACILITY */
-
-				#if( configUSE_QUEUE_SETS == 1 )
+				#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
 				{
-					pxNewQueue->pxQueueSetContainer = NULL;
+					/* Queues can be created either statically or dynamically, so
+					note this queue was created dynamically in case it is later
+					deleted. */
+					pxNewQueue->ucStaticallyAllocated = pdFALSE;
 				}
-				#endif /* configUSE_QUEUE_SETS */
+				#endif /* configSUPPORT_STATIC_ALLOCATION */
 
-				traceQUEUE_CREATE( pxNewQueue );
+				prvInitialiseNewQueue( uxQueueLength, uxItemSize, pcQueueStorage, ucQueueType, pxNewQueue );
 				xReturn = pxNewQueue;
 			}
 			else
@@ -338,58 +420,103 @@ xQueueHandle xReturn = NULL;
 }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
 
-	xQueueHandle xQueueCreateMutex( unsigned char ucQueueType )
+	xQueueHandle xQueueGenericCreateStatic( unsigned portBASE_TYPE uxQueueLength, unsigned portBASE_TYPE uxItemSize, unsigned char *pucQueueStorage, xStaticQueue *pxStaticQueue, unsigned char ucQueueType )
 	{
 	xQUEUE *pxNewQueue;
 
-		/* Prevent compiler warnings about unused parameters if
-		configUSE_TRACE_FACILITY does not equal 1. */
-		( void ) ucQueueType;
+		configASSERT( uxQueueLength > ( unsigned portBASE_TYPE ) 0 );
 
-		/* Allocate the new queue structure. */
-		pxNewQueue = ( xQUEUE * ) pvPortMalloc( sizeof( xQUEUE ) );
-		if( pxNewQueue != NULL )
-		{
-			/* Information required for priority inheritance. */
-			pxNewQueue->pxMutexHolder = NULL;
-			pxNewQueue->uxQueueType = queueQUEUE_IS_MUTEX;
+		/* The xStaticQueue structure is used to hold the queue, so it must be
+		provided. */
+		configASSERT( pxStaticQueue != NULL );
 
-			/* Queues used as a mutex no data is actually copied into or out
-			of the queue. */
-			pxNewQueue->pcWriteTo = NULL;
-			pxNewQueue->u.pcReadFrom = NULL;
+		/* A queue storage area should be provided if the item size is not 0,
+		and should not be provided if the item size is 0. */
+		configASSERT( !( ( pucQueueStorage != NULL ) && ( uxItemSize == 0 ) ) );
+		configASSERT( !( ( pucQueueStorage == NULL ) && ( uxItemSize != 0 ) ) );
 
-			/* Each mutex has a length of 1 (like a binary semaphore) and
-			an item size of 0 as nothing is actually copied into or out
-			of the mutex. */
-			pxNewQueue->uxMessagesWaiting = ( unsigned portBASE_TYPE ) 0U;
-			pxNewQueue->uxLength = ( unsigned portBASE_TYPE ) 1U;
-			pxNewQueue->uxItemSize = ( unsigned portBASE_TYPE ) 0U;
-			pxNewQueue->xRxLock = queueUNLOCKED;
-			pxNewQueue->xTxLock = queueUNLOCKED;
+		/* Sanity check that the size of the structure used to declare a
+		variable of type xStaticQueue equals the size of the real queue
+		structure. */
+		configASSERT( sizeof( xStaticQueue ) == sizeof( xQUEUE ) );
 
-			#if ( configUSE_TRACE_FACILITY == 1 )
-			{
-				pxNewQueue->ucQueueType = ucQueueType;
-			}
-			#endif
+		/* The address of a statically allocated queue was passed in, use it.
+		The address of a statically allocated storage area was also passed in
+		but is already set. */
+		pxNewQueue = ( xQUEUE * ) pxStaticQueue; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
 
-			#if ( configUSE_QUEUE_SETS == 1 )
+		if( pxNewQueue != NULL )
+		{
+			/* Queues can be created either statically or dynamically, so note
+			this queue was created statically in case the queue is later
+			deleted. */
+			pxNewQueue->ucStaticallyAllocated = pdTRUE;
+
+			/* A semaphore has no storage area, but pcHead must still not be
+			NULL as a NULL pcHead marks a mutex, so point it at the queue
+			structure itself - it is never dereferenced. */
+			if( pucQueueStorage == NULL )
 			{
-				pxNewQueue->pxQueueSetContainer = NULL;
+				pucQueueStorage = ( unsigned char * ) pxNewQueue;
 			}
-			#endif
 
-			/* Ensure the event queues start with the correct state. */
-			vListInitialise( &( pxNewQueue->xTasksWaitingToSend ) );
-			vListInitialise( &( pxNewQueue->xTasksWaitingToReceive ) );
+			prvInitialiseNewQueue( uxQueueLength, uxItemSize, ( signed char * ) pucQueueStorage, ucQueueType, pxNewQueue );
+		}
+
+		return pxNewQueue;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewQueue( unsigned portBASE_TYPE uxQueueLength, unsigned portBASE_TYPE uxItemSize, signed char *pcQueueStorage, unsigned char ucQueueType, xQUEUE *pxNewQueue )
+{
+	/* Remove compiler warnings about unused parameters should
+	configUSE_TRACE_FACILITY not be set to 1. */
+	( void ) ucQueueType;
+
+	/* Initialise the queue members as described above where the queue type
+	is defined. */
+	pxNewQueue->pcHead = pcQueueStorage;
+	pxNewQueue->uxLength = uxQueueLength;
+	pxNewQueue->uxItemSize = uxItemSize;
+	( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
+
+	#if ( configUSE_TRACE_FACILITY == 1 )
+	{
+		pxNewQueue->ucQueueType = ucQueueType;
+	}
+	#endif /* configUSE_TRACE_FACILITY */
+
+	#if( configUSE_QUEUE_SETS == 1 )
+	{
+		pxNewQueue->pxQueueSetContainer = NULL;
+	}
+	#endif /* configUSE_QUEUE_SETS */
+
+	traceQUEUE_CREATE( pxNewQueue );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	xQueueHandle xQueueCreateMutex( unsigned char ucQueueType )
+	{
+	xQUEUE *pxNewQueue;
 
-			traceCREATE_MUTEX( pxNewQueue );
+		/* Allocate the new queue structure. */
+		pxNewQueue = ( xQUEUE * ) pvPortMalloc( sizeof( xQUEUE ) );
+		if( pxNewQueue != NULL )
+		{
+			#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				pxNewQueue->ucStaticallyAllocated = pdFALSE;
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
 
-			/* Start with the semaphore in the expected state. */
-			( void ) xQueueGenericSend( pxNewQueue, NULL, ( portTickType ) 0U, queueSEND_TO_BACK );
+			prvInitialiseMutex( pxNewQueue, ucQueueType );
 		}
 		else
 		{
@@ -403,6 +530,140 @@ xQueueHandle xReturn = NULL;
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	xQueueHandle xQueueCreateMutexStatic( unsigned char ucQueueType, xStaticQueue *pxStaticQueue )
+	{
+	xQUEUE *pxNewQueue;
+
+		configASSERT( pxStaticQueue != NULL );
+		configASSERT( sizeof( xStaticQueue ) == sizeof( xQUEUE ) );
+
+		pxNewQueue = ( xQUEUE * ) pxStaticQueue; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+		if( pxNewQueue != NULL )
+		{
+			pxNewQueue->ucStaticallyAllocated = pdTRUE;
+			prvInitialiseMutex( pxNewQueue, ucQueueType );
+		}
+
+		return pxNewQueue;
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	static void prvInitialiseMutex( xQUEUE *pxNewQueue, unsigned char ucQueueType )
+	{
+		/* Prevent compiler warnings about unused parameters if
+		configUSE_TRACE_FACILITY does not equal 1. */
+		( void ) ucQueueType;
+
+		/* Information required for priority inheritance. */
+		pxNewQueue->pxMutexHolder = NULL;
+		pxNewQueue->uxQueueType = queueQUEUE_IS_MUTEX;
+		vListInitialiseItem( &( pxNewQueue->xMutexHeldItem ) );
+		listSET_LIST_ITEM_OWNER( &( pxNewQueue->xMutexHeldItem ), &( pxNewQueue->xTasksWaitingToReceive ) );
+
+		#if ( configUSE_READ_WRITE_LOCKS == 1 )
+		{
+			vListInitialiseItem( &( pxNewQueue->xWriteHeldItem ) );
+			listSET_LIST_ITEM_OWNER( &( pxNewQueue->xWriteHeldItem ), &( pxNewQueue->xTasksWaitingToSend ) );
+		}
+		#endif
+
+		#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+		{
+			pxNewQueue->uxCeilingPriority = queueNO_PRIORITY_CEILING;
+			pxNewQueue->uxPreviousCeiling = queueNO_PRIORITY_CEILING;
+		}
+		#endif
+
+		/* Queues used as a mutex no data is actually copied into or out
+		of the queue. */
+		pxNewQueue->pcWriteTo = NULL;
+		pxNewQueue->u.pcReadFrom = NULL;
+
+		/* Each mutex has a length of 1 (like a binary semaphore) and
+		an item size of 0 as nothing is actually copied into or out
+		of the mutex. */
+		pxNewQueue->uxMessagesWaiting = ( unsigned portBASE_TYPE ) 0U;
+		pxNewQueue->uxLength = ( unsigned portBASE_TYPE ) 1U;
+		pxNewQueue->uxItemSize = ( unsigned portBASE_TYPE ) 0U;
+		pxNewQueue->xRxLock = queueUNLOCKED;
+		pxNewQueue->xTxLock = queueUNLOCKED;
+
+		#if ( configUSE_TRACE_FACILITY == 1 )
+		{
+			pxNewQueue->ucQueueType = ucQueueType;
+		}
+		#endif
+
+		#if ( configUSE_QUEUE_SETS == 1 )
+		{
+			pxNewQueue->pxQueueSetContainer = NULL;
+		}
+		#endif
+
+		/* Ensure the event queues start with the correct state. */
+		vListInitialise( &( pxNewQueue->xTasksWaitingToSend ) );
+		vListInitialise( &( pxNewQueue->xTasksWaitingToReceive ) );
+
+		traceCREATE_MUTEX( pxNewQueue );
+
+		/* Start with the semaphore in the expected state. */
+		( void ) xQueueGenericSend( pxNewQueue, NULL, ( portTickType ) 0U, queueSEND_TO_BACK );
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+
+	xQueueHandle xQueueCreateCeilingMutex( unsigned char ucQueueType, unsigned portBASE_TYPE uxCeilingPriority )
+	{
+	xQueueHandle xHandle;
+
+		configASSERT( uxCeilingPriority < ( unsigned portBASE_TYPE ) configMAX_PRIORITIES );
+
+		/* The ceiling is set once the mutex has been given its initial
+		state, so that give does not try to restore a ceiling. */
+		xHandle = xQueueCreateMutex( ucQueueType );
+
+		if( xHandle != NULL )
+		{
+			( ( xQUEUE * ) xHandle )->uxCeilingPriority = uxCeilingPriority;
+		}
+
+		return xHandle;
+	}
+
+#endif /* configUSE_PRIORITY_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	xQueueHandle xQueueCreateCeilingMutexStatic( unsigned char ucQueueType, unsigned portBASE_TYPE uxCeilingPriority, xStaticQueue *pxStaticQueue )
+	{
+	xQueueHandle xHandle;
+
+		configASSERT( uxCeilingPriority < ( unsigned portBASE_TYPE ) configMAX_PRIORITIES );
+
+		xHandle = xQueueCreateMutexStatic( ucQueueType, pxStaticQueue );
+
+		if( xHandle != NULL )
+		{
+			( ( xQUEUE * ) xHandle )->uxCeilingPriority = uxCeilingPriority;
+		}
+
+		return xHandle;
+	}
+
+#endif /* ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
 
 	void* xQueueGetMutexHolder( xQueueHandle xSemaphore )
@@ -524,88 +785,365 @@ xQueueHandle xReturn = NULL;
 #endif /* configUSE_RECURSIVE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_COUNTING_SEMAPHORES == 1 )
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
 
-	xQueueHandle xQueueCreateCountingSemaphore( unsigned portBASE_TYPE uxCountValue, unsigned portBASE_TYPE uxInitialCount )
+	xQueueHandle xQueueCreateReadWriteLock( void )
 	{
 	xQueueHandle xHandle;
 
-		xHandle = xQueueGenericCreate( uxCountValue, queueSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+		xHandle = xQueueCreateMutex( queueQUEUE_TYPE_READ_WRITE_LOCK );
 
 		if( xHandle != NULL )
 		{
-			( ( xQUEUE * ) xHandle )->uxMessagesWaiting = uxInitialCount;
-
-			traceCREATE_COUNTING_SEMAPHORE();
+			/* A mutex is created available, with a count of one.  A read
+			write lock counts the tasks reading it, so starts at zero. */
+			( ( xQUEUE * ) xHandle )->uxMessagesWaiting = ( unsigned portBASE_TYPE ) 0U;
 		}
-		else
+
+		return xHandle;
+	}
+
+#endif /* configUSE_READ_WRITE_LOCKS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_READ_WRITE_LOCKS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	xQueueHandle xQueueCreateReadWriteLockStatic( xStaticQueue *pxStaticQueue )
+	{
+	xQueueHandle xHandle;
+
+		xHandle = xQueueCreateMutexStatic( queueQUEUE_TYPE_READ_WRITE_LOCK, pxStaticQueue );
+
+		if( xHandle != NULL )
 		{
-			traceCREATE_COUNTING_SEMAPHORE_FAILED();
+			( ( xQUEUE * ) xHandle )->uxMessagesWaiting = ( unsigned portBASE_TYPE ) 0U;
 		}
 
-		configASSERT( xHandle );
 		return xHandle;
 	}
 
-#endif /* configUSE_COUNTING_SEMAPHORES */
+#endif /* ( configUSE_READ_WRITE_LOCKS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
-signed portBASE_TYPE xQueueGenericSend( xQueueHandle xQueue, const void * const pvItemToQueue, portTickType xTicksToWait, portBASE_TYPE xCopyPosition )
-{
-signed portBASE_TYPE xEntryTimeSet = pdFALSE;
-xTimeOutType xTimeOut;
-xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
-
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( unsigned portBASE_TYPE ) 0U ) ) );
-	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
 
-	/* This function relaxes the coding standard somewhat to allow return
-	statements within the function itself.  This is done in the interest
-	of execution time efficiency. */
-	for( ;; )
+	portBASE_TYPE xQueueTakeReadWriteLock( xQueueHandle xLock, portTickType xTicksToWait, portBASE_TYPE xWrite )
 	{
-		taskENTER_CRITICAL();
+	signed portBASE_TYPE xEntryTimeSet = pdFALSE;
+	xTimeOutType xTimeOut;
+	xList *pxWaitingTasks;
+	xQUEUE * const pxLock = ( xQUEUE * ) xLock;
+
+		configASSERT( pxLock );
+
+		/* Readers wait in xTasksWaitingToReceive and writers in
+		xTasksWaitingToSend.  pxMutexHolder is the writer holding the lock,
+		if any, and uxMessagesWaiting the number of tasks reading it. */
+		if( xWrite != pdFALSE )
 		{
-			/* Is there room on the queue now?  The running task must be
-			the highest priority task wanting to access the queue.  If
-			the head item in the queue is to be overwritten then it does
-			not matter if the queue is full. */
-			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
-			{
-				traceQUEUE_SEND( pxQueue );
-				prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+			pxWaitingTasks = &( pxLock->xTasksWaitingToSend );
+		}
+		else
+		{
+			pxWaitingTasks = &( pxLock->xTasksWaitingToReceive );
+		}
 
-				#if ( configUSE_QUEUE_SETS == 1 )
+		/* As in xQueueGenericReceive(), return statements are used within
+		the function in the interest of execution time efficiency. */
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( ( xEntryTimeSet != pdFALSE ) && ( pxLock->pxMutexHolder == ( void * ) xTaskGetCurrentTaskHandle() ) ) /*lint !e961 Not a redundant cast as xTaskHandle is a typedef. */
 				{
-					if( pxQueue->pxQueueSetContainer != NULL )
+					/* This writer blocked, and was given the lock by
+					prvUnblockReadWriteLockWaiters() as it was unblocked. */
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+				else if( prvIsReadWriteLockAvailable( pxLock, xWrite ) != pdFALSE )
+				{
+					if( xWrite != pdFALSE )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) == pdTRUE )
-						{
-							/* The queue is a member of a queue set, and posting
-							to the queue set caused a higher priority task to
-							unblock. A context switch is required. */
-							portYIELD_WITHIN_API();
-						}
+						/* The writer is recorded as holding the lock through
+						both of its lists of waiting tasks, so it inherits
+						from readers and writers alike. */
+						pxLock->pxMutexHolder = ( signed char * ) pvTaskMutexTaken( &( pxLock->xMutexHeldItem ) );
+						( void ) pvTaskMutexTaken( &( pxLock->xWriteHeldItem ) );
 					}
 					else
 					{
-						/* If there was a task waiting for data to arrive on the
-						queue then unblock it now. */
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-						{
-							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) == pdTRUE )
-							{
-								/* The unblocked task has a priority higher than
-								our own so yield immediately.  Yes it is ok to
-								do this from within the critical section - the
-								kernel takes care of that. */
-								portYIELD_WITHIN_API();
-							}
-						}
+						++( pxLock->uxMessagesWaiting );
 					}
-				}
-				#else /* configUSE_QUEUE_SETS */
+
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+				else
+				{
+					if( xTicksToWait == ( portTickType ) 0 )
+					{
+						taskEXIT_CRITICAL();
+						return errQUEUE_EMPTY;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						/* Entry time was already set. */
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			vTaskSuspendAll();
+			prvLockQueue( pxLock );
+
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( prvIsReadWriteLockAvailable( pxLock, xWrite ) == pdFALSE )
+				{
+					vTaskPlaceOnEventList( pxWaitingTasks, xTicksToWait );
+
+					/* A writer holding the lock inherits the priority of this
+					task.  Tasks reading the lock are not known individually,
+					so do not. */
+					portENTER_CRITICAL();
+					{
+						vTaskSetMutexWaitedOn( ( void * ) pxLock );
+						prvUpdateMutexHolderPriority( pxLock );
+					}
+					portEXIT_CRITICAL();
+
+					prvUnlockQueue( pxLock );
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+
+					vTaskSetMutexWaitedOn( NULL );
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxLock );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				prvUnlockQueue( pxLock );
+				( void ) xTaskResumeAll();
+
+				taskENTER_CRITICAL();
+				{
+					prvUpdateMutexHolderPriority( pxLock );
+
+					/* Readers held back by this writer may now be able to
+					take the lock. */
+					if( xWrite != pdFALSE )
+					{
+						if( prvUnblockReadWriteLockWaiters( pxLock ) != pdFALSE )
+						{
+							portYIELD_WITHIN_API();
+						}
+					}
+				}
+				taskEXIT_CRITICAL();
+
+				return errQUEUE_EMPTY;
+			}
+		}
+	}
+
+#endif /* configUSE_READ_WRITE_LOCKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+
+	portBASE_TYPE xQueueGiveReadWriteLock( xQueueHandle xLock, portBASE_TYPE xWrite )
+	{
+	portBASE_TYPE xReturn = pdPASS, xYieldRequired = pdFALSE;
+	xQUEUE * const pxLock = ( xQUEUE * ) xLock;
+
+		configASSERT( pxLock );
+
+		taskENTER_CRITICAL();
+		{
+			if( xWrite != pdFALSE )
+			{
+				if( pxLock->pxMutexHolder == ( void * ) xTaskGetCurrentTaskHandle() ) /*lint !e961 Not a redundant cast as xTaskHandle is a typedef. */
+				{
+					/* Both entries are removed before the priority of the
+					writer is worked out again. */
+					if( listLIST_ITEM_CONTAINER( &( pxLock->xWriteHeldItem ) ) != NULL )
+					{
+						( void ) uxListRemove( &( pxLock->xWriteHeldItem ) );
+					}
+
+					xYieldRequired = xTaskPriorityDisinherit( ( void * ) pxLock->pxMutexHolder, &( pxLock->xMutexHeldItem ) );
+					pxLock->pxMutexHolder = NULL;
+				}
+				else
+				{
+					/* Only the writer holding the lock can give it back. */
+					xReturn = pdFAIL;
+				}
+			}
+			else
+			{
+				if( pxLock->uxMessagesWaiting > ( unsigned portBASE_TYPE ) 0U )
+				{
+					--( pxLock->uxMessagesWaiting );
+				}
+				else
+				{
+					xReturn = pdFAIL;
+				}
+			}
+
+			if( xReturn == pdPASS )
+			{
+				if( prvUnblockReadWriteLockWaiters( pxLock ) != pdFALSE )
+				{
+					xYieldRequired = pdTRUE;
+				}
+
+				if( xYieldRequired != pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_READ_WRITE_LOCKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_COUNTING_SEMAPHORES == 1 )
+
+	xQueueHandle xQueueCreateCountingSemaphore( unsigned portBASE_TYPE uxCountValue, unsigned portBASE_TYPE uxInitialCount )
+	{
+	xQueueHandle xHandle;
+
+		xHandle = xQueueGenericCreate( uxCountValue, queueSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+
+		if( xHandle != NULL )
+		{
+			( ( xQUEUE * ) xHandle )->uxMessagesWaiting = uxInitialCount;
+
+			traceCREATE_COUNTING_SEMAPHORE();
+		}
+		else
+		{
+			traceCREATE_COUNTING_SEMAPHORE_FAILED();
+		}
+
+		configASSERT( xHandle );
+		return xHandle;
+	}
+
+#endif /* configUSE_COUNTING_SEMAPHORES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	xQueueHandle xQueueCreateCountingSemaphoreStatic( unsigned portBASE_TYPE uxCountValue, unsigned portBASE_TYPE uxInitialCount, xStaticQueue *pxStaticQueue )
+	{
+	xQueueHandle xHandle;
+
+		configASSERT( uxInitialCount <= uxCountValue );
+
+		xHandle = xQueueGenericCreateStatic( uxCountValue, queueSEMAPHORE_QUEUE_ITEM_LENGTH, NULL, pxStaticQueue, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+
+		if( xHandle != NULL )
+		{
+			( ( xQUEUE * ) xHandle )->uxMessagesWaiting = uxInitialCount;
+
+			traceCREATE_COUNTING_SEMAPHORE();
+		}
+		else
+		{
+			traceCREATE_COUNTING_SEMAPHORE_FAILED();
+		}
+
+		return xHandle;
+	}
+
+#endif /* ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+signed portBASE_TYPE xQueueGenericSend( xQueueHandle xQueue, const void * const pvItemToQueue, portTickType xTicksToWait, portBASE_TYPE xCopyPosition )
+{
+signed portBASE_TYPE xEntryTimeSet = pdFALSE;
+portBASE_TYPE xYieldRequired;
+xTimeOutType xTimeOut;
+xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( unsigned portBASE_TYPE ) 0U ) ) );
+	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+
+	/* This function relaxes the coding standard somewhat to allow return
+	statements within the function itself.  This is done in the interest
+	of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			/* Is there room on the queue now?  The running task must be
+			the highest priority task wanting to access the queue.  If
+			the head item in the queue is to be overwritten then it does
+			not matter if the queue is full. */
+			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+			{
+				traceQUEUE_SEND( pxQueue );
+				xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+
+				#if ( configUSE_QUEUE_SETS == 1 )
+				{
+					if( pxQueue->pxQueueSetContainer != NULL )
+					{
+						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) == pdTRUE )
+						{
+							/* The queue is a member of a queue set, and posting
+							to the queue set caused a higher priority task to
+							unblock. A context switch is required. */
+							portYIELD_WITHIN_API();
+						}
+					}
+					else
+					{
+						/* If there was a task waiting for data to arrive on the
+						queue then unblock it now. */
+						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						{
+							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) == pdTRUE )
+							{
+								/* The unblocked task has a priority higher than
+								our own so yield immediately.  Yes it is ok to
+								do this from within the critical section - the
+								kernel takes care of that. */
+								portYIELD_WITHIN_API();
+							}
+						}
+						else if( xYieldRequired != pdFALSE )
+						{
+							/* Giving back a priority ceiling mutex lowered
+							the priority of this task, so a task readied while
+							the mutex was held may now take precedence. */
+							portYIELD_WITHIN_API();
+						}
+					}
+				}
+				#else /* configUSE_QUEUE_SETS */
 				{
 					/* If there was a task waiting for data to arrive on the
 					queue then unblock it now. */
@@ -620,6 +1158,13 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 							portYIELD_WITHIN_API();
 						}
 					}
+					else if( xYieldRequired != pdFALSE )
+					{
+						/* Giving back a priority ceiling mutex lowered the
+						priority of this task, so a task readied while the
+						mutex was held may now take precedence. */
+						portYIELD_WITHIN_API();
+					}
 				}
 				#endif /* configUSE_QUEUE_SETS */
 
@@ -730,7 +1275,11 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 				if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
 				{
 					traceQUEUE_SEND( pxQueue );
-					prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+					if( prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition ) != pdFALSE )
+					{
+						/* A priority ceiling mutex was given back. */
+						portYIELD_WITHIN_API();
+					}
 
 					/* If there was a task waiting for data to arrive on the
 					queue then unblock it now. */
@@ -824,7 +1373,16 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 							{
 								/* Record the information required to implement
 								priority inheritance should it become necessary. */
-								pxQueue->pxMutexHolder = ( signed char * ) xTaskGetCurrentTaskHandle();
+								pxQueue->pxMutexHolder = ( signed char * ) pvTaskMutexTaken( &( pxQueue->xMutexHeldItem ) );
+
+								#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+								{
+									if( pxQueue->uxCeilingPriority != queueNO_PRIORITY_CEILING )
+									{
+										pxQueue->uxPreviousCeiling = uxTaskPriorityRaiseToCeiling( pxQueue->uxCeilingPriority );
+									}
+								}
+								#endif
 							}
 						}
 						#endif
@@ -887,26 +1445,41 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 					if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 					{
 						traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+						vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
 
 						#if ( configUSE_MUTEXES == 1 )
 						{
 							if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
 							{
-								portENTER_CRITICAL();
-								{
-									vTaskPriorityInherit( ( void * ) pxQueue->pxMutexHolder );
-								}
-								portEXIT_CRITICAL();
+								vTaskSetMutexWaitedOn( ( void * ) pxQueue );
+								prvUpdateMutexHolderPriority( pxQueue );
 							}
 						}
 						#endif
 
-						vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
 						portYIELD_WITHIN_API();
+
+						#if ( configUSE_MUTEXES == 1 )
+						{
+							if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+							{
+								vTaskSetMutexWaitedOn( NULL );
+							}
+						}
+						#endif
 					}
 				}
 				else
 				{
+					#if ( configUSE_MUTEXES == 1 )
+					{
+						if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+						{
+							prvUpdateMutexHolderPriority( pxQueue );
+						}
+					}
+					#endif
+
 					taskEXIT_CRITICAL();
 					traceQUEUE_RECEIVE_FAILED( pxQueue );
 					return errQUEUE_EMPTY;
@@ -957,7 +1530,7 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 		{
 			traceQUEUE_SEND_FROM_ISR( pxQueue );
 
-			prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+			( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
 
 			/* If the queue is locked we do not alter the event list.  This will
 			be done when the queue is unlocked later. */
@@ -1073,7 +1646,20 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 						{
 							/* Record the information required to implement
 							priority inheritance should it become necessary. */
-							pxQueue->pxMutexHolder = ( signed char * ) xTaskGetCurrentTaskHandle(); /*lint !e961 Cast is not redundant as xTaskHandle is a typedef. */
+							pxQueue->pxMutexHolder = ( signed char * ) pvTaskMutexTaken( &( pxQueue->xMutexHeldItem ) );
+
+							#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+							{
+								/* A priority ceiling mutex raises its holder
+								straight away, so no task that might take the
+								mutex can preempt the holder and nothing has to
+								be inherited later. */
+								if( pxQueue->uxCeilingPriority != queueNO_PRIORITY_CEILING )
+								{
+									pxQueue->uxPreviousCeiling = uxTaskPriorityRaiseToCeiling( pxQueue->uxCeilingPriority );
+								}
+							}
+							#endif
 						}
 					}
 					#endif
@@ -1148,26 +1734,39 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
 
 				#if ( configUSE_MUTEXES == 1 )
 				{
 					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
 					{
+						/* This task is now one of the tasks the mutex holder
+						inherits its priority from.  The holder cannot run
+						until the scheduler is resumed. */
 						portENTER_CRITICAL();
 						{
-							vTaskPriorityInherit( ( void * ) pxQueue->pxMutexHolder );
+							vTaskSetMutexWaitedOn( ( void * ) pxQueue );
+							prvUpdateMutexHolderPriority( pxQueue );
 						}
 						portEXIT_CRITICAL();
 					}
 				}
 				#endif
 
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
 				prvUnlockQueue( pxQueue );
 				if( xTaskResumeAll() == pdFALSE )
 				{
 					portYIELD_WITHIN_API();
 				}
+
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+					{
+						vTaskSetMutexWaitedOn( NULL );
+					}
+				}
+				#endif
 			}
 			else
 			{
@@ -1180,11 +1779,27 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 		{
 			prvUnlockQueue( pxQueue );
 			( void ) xTaskResumeAll();
-			traceQUEUE_RECEIVE_FAILED( pxQueue );
-			return errQUEUE_EMPTY;
-		}
-	}
-}
+
+			#if ( configUSE_MUTEXES == 1 )
+			{
+				if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+				{
+					/* The mutex holder, and any task it is waiting for, no
+					longer has to run at the priority of this task. */
+					taskENTER_CRITICAL();
+					{
+						prvUpdateMutexHolderPriority( pxQueue );
+					}
+					taskEXIT_CRITICAL();
+				}
+			}
+			#endif
+
+			traceQUEUE_RECEIVE_FAILED( pxQueue );
+			return errQUEUE_EMPTY;
+		}
+	}
+}
 /*-----------------------------------------------------------*/
 
 signed portBASE_TYPE xQueueReceiveFromISR( xQueueHandle xQueue, const void * const pvBuffer, signed portBASE_TYPE *pxHigherPriorityTaskWoken )
@@ -1315,6 +1930,346 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 }
 /*-----------------------------------------------------------*/
 
+unsigned portBASE_TYPE xQueueSendMultiple( xQueueHandle xQueue, const void * const pvItemsToQueue, unsigned portBASE_TYPE uxItemCount, portTickType xTicksToWait )
+{
+signed portBASE_TYPE xEntryTimeSet = pdFALSE;
+unsigned portBASE_TYPE uxSent = ( unsigned portBASE_TYPE ) 0, uxBatch, ux;
+xTimeOutType xTimeOut;
+xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvItemsToQueue == NULL ) && ( pxQueue->uxItemSize != ( unsigned portBASE_TYPE ) 0U ) ) );
+	configASSERT( pxQueue->uxQueueType != queueQUEUE_IS_MUTEX );
+
+	/* As xQueueGenericSend(), but each pass through the loop copies as many
+	of the remaining items as there is room for, and only blocks while the
+	queue is full. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			uxBatch = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+			if( uxBatch > ( uxItemCount - uxSent ) )
+			{
+				uxBatch = uxItemCount - uxSent;
+			}
+
+			if( uxBatch > ( unsigned portBASE_TYPE ) 0 )
+			{
+				prvCopyItemsToQueue( pxQueue, ( ( const signed char * ) pvItemsToQueue ) + ( uxSent * pxQueue->uxItemSize ), uxBatch );
+
+				for( ux = ( unsigned portBASE_TYPE ) 0; ux < uxBatch; ux++ )
+				{
+					traceQUEUE_SEND( pxQueue );
+					++( pxQueue->uxMessagesWaiting );
+				}
+				uxSent += uxBatch;
+
+				/* Unblock the tasks waiting for the items in one go.  Yes it
+				is ok to yield from within the critical section - the kernel
+				takes care of that. */
+				if( prvNotifyItemsSent( pxQueue, uxBatch ) != pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+			}
+
+			if( uxSent == uxItemCount )
+			{
+				taskEXIT_CRITICAL();
+				return uxSent;
+			}
+			else if( xTicksToWait == ( portTickType ) 0 )
+			{
+				/* The queue is full and no block time is specified (or the
+				block time has expired) so leave with what has been sent. */
+				taskEXIT_CRITICAL();
+				traceQUEUE_SEND_FAILED( pxQueue );
+				return uxSent;
+			}
+			else if( xEntryTimeSet == pdFALSE )
+			{
+				vTaskSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Entry time was already set. */
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+			}
+			else
+			{
+				/* Try again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* The timeout has expired. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			traceQUEUE_SEND_FAILED( pxQueue );
+			return uxSent;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+unsigned portBASE_TYPE xQueueSendMultipleFromISR( xQueueHandle xQueue, const void * const pvItemsToQueue, unsigned portBASE_TYPE uxItemCount, signed portBASE_TYPE *pxHigherPriorityTaskWoken )
+{
+unsigned portBASE_TYPE uxBatch, ux;
+unsigned portBASE_TYPE uxSavedInterruptStatus;
+xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvItemsToQueue == NULL ) && ( pxQueue->uxItemSize != ( unsigned portBASE_TYPE ) 0U ) ) );
+	configASSERT( pxQueue->uxQueueType != queueQUEUE_IS_MUTEX );
+
+	/* See the comment in xQueueGenericSendFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		uxBatch = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+		if( uxBatch > uxItemCount )
+		{
+			uxBatch = uxItemCount;
+		}
+
+		if( uxBatch > ( unsigned portBASE_TYPE ) 0 )
+		{
+			prvCopyItemsToQueue( pxQueue, ( const signed char * ) pvItemsToQueue, uxBatch );
+
+			for( ux = ( unsigned portBASE_TYPE ) 0; ux < uxBatch; ux++ )
+			{
+				traceQUEUE_SEND_FROM_ISR( pxQueue );
+				++( pxQueue->uxMessagesWaiting );
+			}
+
+			/* If the queue is locked the event list will not be modified.
+			Instead the lock count is raised by the number of items, so the
+			task that unlocks the queue unblocks a task for each of them. */
+			if( pxQueue->xTxLock == queueUNLOCKED )
+			{
+				if( prvNotifyItemsSent( pxQueue, uxBatch ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+				}
+			}
+			else
+			{
+				pxQueue->xTxLock += ( signed portBASE_TYPE ) uxBatch;
+			}
+		}
+		else if( uxItemCount > ( unsigned portBASE_TYPE ) 0 )
+		{
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+		}
+		else
+		{
+			/* Nothing to send. */
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return uxBatch;
+}
+/*-----------------------------------------------------------*/
+
+unsigned portBASE_TYPE xQueueReceiveMultiple( xQueueHandle xQueue, void * const pvBuffer, unsigned portBASE_TYPE uxMaxItems, portTickType xTicksToWait )
+{
+signed portBASE_TYPE xEntryTimeSet = pdFALSE;
+unsigned portBASE_TYPE uxBatch, ux;
+xTimeOutType xTimeOut;
+xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( unsigned portBASE_TYPE ) 0U ) ) );
+	configASSERT( pxQueue->uxQueueType != queueQUEUE_IS_MUTEX );
+
+	/* A member of a queue set may only be read once for each time it is
+	returned by xQueueSelectFromSet(). */
+	#if ( configUSE_QUEUE_SETS == 1 )
+	{
+		configASSERT( pxQueue->pxQueueSetContainer == NULL );
+	}
+	#endif
+
+	/* As xQueueGenericReceive(), but as soon as there is data in the queue
+	all of it, up to uxMaxItems items, is copied out at once. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			uxBatch = pxQueue->uxMessagesWaiting;
+			if( uxBatch > uxMaxItems )
+			{
+				uxBatch = uxMaxItems;
+			}
+
+			if( uxBatch > ( unsigned portBASE_TYPE ) 0 )
+			{
+				prvCopyItemsFromQueue( pxQueue, ( signed char * ) pvBuffer, uxBatch );
+
+				for( ux = ( unsigned portBASE_TYPE ) 0; ux < uxBatch; ux++ )
+				{
+					traceQUEUE_RECEIVE( pxQueue );
+					--( pxQueue->uxMessagesWaiting );
+				}
+
+				/* Unblock a waiting sender for each item removed. */
+				if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), uxBatch ) != pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+
+				taskEXIT_CRITICAL();
+				return uxBatch;
+			}
+			else if( ( xTicksToWait == ( portTickType ) 0 ) || ( uxMaxItems == ( unsigned portBASE_TYPE ) 0 ) )
+			{
+				/* The queue was empty and no block time is specified (or
+				the block time has expired) so leave now. */
+				taskEXIT_CRITICAL();
+				traceQUEUE_RECEIVE_FAILED( pxQueue );
+				return ( unsigned portBASE_TYPE ) 0;
+			}
+			else if( xEntryTimeSet == pdFALSE )
+			{
+				vTaskSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Entry time was already set. */
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+			}
+			else
+			{
+				/* Try again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			traceQUEUE_RECEIVE_FAILED( pxQueue );
+			return ( unsigned portBASE_TYPE ) 0;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+unsigned portBASE_TYPE xQueueReceiveMultipleFromISR( xQueueHandle xQueue, void * const pvBuffer, unsigned portBASE_TYPE uxMaxItems, signed portBASE_TYPE *pxHigherPriorityTaskWoken )
+{
+unsigned portBASE_TYPE uxBatch, ux;
+unsigned portBASE_TYPE uxSavedInterruptStatus;
+xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( unsigned portBASE_TYPE ) 0U ) ) );
+	configASSERT( pxQueue->uxQueueType != queueQUEUE_IS_MUTEX );
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+	{
+		configASSERT( pxQueue->pxQueueSetContainer == NULL );
+	}
+	#endif
+
+	/* See the comment in xQueueGenericSendFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		uxBatch = pxQueue->uxMessagesWaiting;
+		if( uxBatch > uxMaxItems )
+		{
+			uxBatch = uxMaxItems;
+		}
+
+		if( uxBatch > ( unsigned portBASE_TYPE ) 0 )
+		{
+			prvCopyItemsFromQueue( pxQueue, ( signed char * ) pvBuffer, uxBatch );
+
+			for( ux = ( unsigned portBASE_TYPE ) 0; ux < uxBatch; ux++ )
+			{
+				traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+				--( pxQueue->uxMessagesWaiting );
+			}
+
+			/* If the queue is locked the event list will not be modified.
+			Instead the lock count is raised by the number of items, so the
+			task that unlocks the queue unblocks a sender for each of them. */
+			if( pxQueue->xRxLock == queueUNLOCKED )
+			{
+				if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), uxBatch ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+				}
+			}
+			else
+			{
+				pxQueue->xRxLock += ( signed portBASE_TYPE ) uxBatch;
+			}
+		}
+		else
+		{
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return uxBatch;
+}
+/*-----------------------------------------------------------*/
+
 unsigned portBASE_TYPE uxQueueMessagesWaiting( const xQueueHandle xQueue )
 {
 unsigned portBASE_TYPE uxReturn;
@@ -1353,8 +2308,50 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 		vQueueUnregisterQueue( pxQueue );
 	}
 	#endif
-	vPortFree( pxQueue->pcHead );
-	vPortFree( pxQueue );
+
+	#if ( configUSE_MUTEXES == 1 )
+	{
+		/* A mutex deleted while held must not remain in the list of mutexes
+		held by its holder. */
+		if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( listLIST_ITEM_CONTAINER( &( pxQueue->xMutexHeldItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxQueue->xMutexHeldItem ) );
+				}
+
+				#if ( configUSE_READ_WRITE_LOCKS == 1 )
+				{
+					if( listLIST_ITEM_CONTAINER( &( pxQueue->xWriteHeldItem ) ) != NULL )
+					{
+						( void ) uxListRemove( &( pxQueue->xWriteHeldItem ) );
+					}
+				}
+				#endif
+			}
+			taskEXIT_CRITICAL();
+		}
+	}
+	#endif
+
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+		/* The queue can only have been allocated dynamically - free it
+		again. */
+		if( pxQueue->ucStaticallyAllocated == ( unsigned char ) pdFALSE )
+		{
+			vPortFree( pxQueue->pcHead );
+			vPortFree( pxQueue );
+		}
+	}
+	#else
+	{
+		vPortFree( pxQueue->pcHead );
+		vPortFree( pxQueue );
+	}
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
 }
 /*-----------------------------------------------------------*/
 
@@ -1388,16 +2385,27 @@ xQUEUE * const pxQueue = ( xQUEUE * ) xQueue;
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-static void prvCopyDataToQueue( xQUEUE *pxQueue, const void *pvItemToQueue, portBASE_TYPE xPosition )
+static portBASE_TYPE prvCopyDataToQueue( xQUEUE *pxQueue, const void *pvItemToQueue, portBASE_TYPE xPosition )
 {
+portBASE_TYPE xReturn = pdFALSE;
+
 	if( pxQueue->uxItemSize == ( unsigned portBASE_TYPE ) 0 )
 	{
 		#if ( configUSE_MUTEXES == 1 )
 		{
 			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
 			{
+				#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+				{
+					if( pxQueue->uxCeilingPriority != queueNO_PRIORITY_CEILING )
+					{
+						vTaskPriorityRestoreCeiling( ( void * ) pxQueue->pxMutexHolder, pxQueue->uxPreviousCeiling );
+					}
+				}
+				#endif
+
 				/* The mutex is no longer being held. */
-				vTaskPriorityDisinherit( ( void * ) pxQueue->pxMutexHolder );
+				xReturn = xTaskPriorityDisinherit( ( void * ) pxQueue->pxMutexHolder, &( pxQueue->xMutexHeldItem ) );
 				pxQueue->pxMutexHolder = NULL;
 			}
 		}
@@ -1435,6 +2443,8 @@ static void prvCopyDataToQueue( xQUEUE *pxQueue, const void *pvItemToQueue, port
 	}
 
 	++( pxQueue->uxMessagesWaiting );
+
+	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
@@ -1452,6 +2462,203 @@ static void prvCopyDataFromQueue( xQUEUE * const pxQueue, const void * const pvB
 }
 /*-----------------------------------------------------------*/
 
+static void prvCopyItemsToQueue( xQUEUE * const pxQueue, const signed char *pcItems, unsigned portBASE_TYPE uxCount )
+{
+size_t xBytes, xFirst;
+
+	if( pxQueue->uxItemSize != ( unsigned portBASE_TYPE ) 0 )
+	{
+		xBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+		xFirst = ( size_t ) ( pxQueue->pcTail - pxQueue->pcWriteTo );
+
+		if( xBytes < xFirst )
+		{
+			( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pcItems, xBytes );
+			pxQueue->pcWriteTo += xBytes;
+		}
+		else
+		{
+			/* The items run up to or past the end of the storage area, so
+			the rest are written from the start of it. */
+			( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pcItems, xFirst );
+			xBytes -= xFirst;
+			( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) ( pcItems + xFirst ), xBytes );
+			pxQueue->pcWriteTo = pxQueue->pcHead + xBytes;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyItemsFromQueue( xQUEUE * const pxQueue, signed char *pcBuffer, unsigned portBASE_TYPE uxCount )
+{
+size_t xBytes, xFirst;
+signed char *pcReadFrom;
+
+	if( pxQueue->uxItemSize != ( unsigned portBASE_TYPE ) 0 )
+	{
+		/* u.pcReadFrom points to the last item read, so the first item to
+		read is the one after it. */
+		pcReadFrom = pxQueue->u.pcReadFrom + pxQueue->uxItemSize;
+		if( pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+		{
+			pcReadFrom = pxQueue->pcHead;
+		}
+
+		xBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+		xFirst = ( size_t ) ( pxQueue->pcTail - pcReadFrom );
+
+		if( xBytes <= xFirst )
+		{
+			( void ) memcpy( ( void * ) pcBuffer, ( const void * ) pcReadFrom, xBytes );
+			pxQueue->u.pcReadFrom = pcReadFrom + ( xBytes - pxQueue->uxItemSize );
+		}
+		else
+		{
+			( void ) memcpy( ( void * ) pcBuffer, ( const void * ) pcReadFrom, xFirst );
+			xBytes -= xFirst;
+			( void ) memcpy( ( void * ) ( pcBuffer + xFirst ), ( const void * ) pxQueue->pcHead, xBytes );
+			pxQueue->u.pcReadFrom = pxQueue->pcHead + ( xBytes - pxQueue->uxItemSize );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvUnblockWaitingTasks( xList * const pxEventList, unsigned portBASE_TYPE uxCount )
+{
+portBASE_TYPE xReturn = pdFALSE;
+
+	while( ( uxCount > ( unsigned portBASE_TYPE ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+	{
+		if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+		{
+			xReturn = pdTRUE;
+		}
+
+		--uxCount;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvNotifyItemsSent( xQUEUE * const pxQueue, unsigned portBASE_TYPE uxCount )
+{
+portBASE_TYPE xReturn = pdFALSE;
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+	{
+		if( pxQueue->pxQueueSetContainer != NULL )
+		{
+			/* The queue set holds one event per item. */
+			while( uxCount > ( unsigned portBASE_TYPE ) 0 )
+			{
+				if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+
+				--uxCount;
+			}
+		}
+		else
+		{
+			xReturn = prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxCount );
+		}
+	}
+	#else /* configUSE_QUEUE_SETS */
+	{
+		xReturn = prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxCount );
+	}
+	#endif /* configUSE_QUEUE_SETS */
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	static void prvUpdateMutexHolderPriority( xQUEUE *pxMutex )
+	{
+		/* The walk ends at the first holder whose priority does not change.
+		Every priority changed by one walk moves in the same direction, so the
+		walk also ends if the tasks are deadlocked in a cycle. */
+		while( pxMutex != NULL )
+		{
+			pxMutex = ( xQUEUE * ) pvTaskPriorityInherit( ( void * ) pxMutex->pxMutexHolder );
+		}
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+
+	static portBASE_TYPE prvIsReadWriteLockAvailable( const xQUEUE *pxLock, portBASE_TYPE xWrite )
+	{
+	portBASE_TYPE xReturn;
+
+		if( pxLock->pxMutexHolder != NULL )
+		{
+			xReturn = pdFALSE;
+		}
+		else if( xWrite != pdFALSE )
+		{
+			xReturn = ( pxLock->uxMessagesWaiting == ( unsigned portBASE_TYPE ) 0U );
+		}
+		else
+		{
+			xReturn = listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToSend ) );
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_READ_WRITE_LOCKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+
+	static portBASE_TYPE prvUnblockReadWriteLockWaiters( xQUEUE *pxLock )
+	{
+	portBASE_TYPE xReturn = pdFALSE;
+	void *pvWriter;
+
+		if( pxLock->pxMutexHolder == NULL )
+		{
+			if( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToSend ) ) == pdFALSE )
+			{
+				if( pxLock->uxMessagesWaiting == ( unsigned portBASE_TYPE ) 0U )
+				{
+					/* Had the writer to take the lock once it runs, a reader
+					could take it first and the writer would block again, so
+					readers could keep it out for ever.  It is recorded as the
+					holder, inheriting from the tasks still waiting, while it
+					is still at the head of the list. */
+					pvWriter = listGET_OWNER_OF_HEAD_ENTRY( &( pxLock->xTasksWaitingToSend ) );
+					pxLock->pxMutexHolder = ( signed char * ) pvTaskMutexGivenTo( pvWriter, &( pxLock->xMutexHeldItem ) );
+					( void ) pvTaskMutexGivenTo( pvWriter, &( pxLock->xWriteHeldItem ) );
+
+					xReturn = xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToSend ) );
+				}
+			}
+			else
+			{
+				while( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						xReturn = pdTRUE;
+					}
+				}
+			}
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_READ_WRITE_LOCKS */
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( xQUEUE *pxQueue )
 {
 	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -1667,7 +2874,7 @@ signed portBASE_TYPE xReturn;
 			if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
 			{
 				/* There is room in the queue, copy the data into the queue. */
-				prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
+				( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
 				xReturn = pdPASS;
 
 				/* Were any co-routines waiting for data to become available? */
@@ -1782,7 +2989,7 @@ signed portBASE_TYPE xReturn;
 		exit without doing anything. */
 		if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
 		{
-			prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
+			( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
 
 			/* We only want to wake one co-routine per ISR, so check that a
 			co-routine has not already been woken. */
@@ -2049,7 +3256,7 @@ signed portBASE_TYPE xReturn;
 		{
 			traceQUEUE_SEND( pxQueueSetContainer );
 			/* The data copies is the handle of the queue that contains data. */
-			prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, xCopyPosition );
+			( void ) prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, xCopyPosition );
 			if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
 			{
 				if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
@@ -0,0 +1,825 @@
+/*
+    FreeRTOS V7.5.2 - Copyright (C) 2013 Real Time Engineers Ltd.
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to build stream_buffer.c
+#endif
+
+#if ( ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error INCLUDE_xTaskGetCurrentTaskHandle or configUSE_MUTEXES must be set to 1 to build stream_buffer.c
+#endif
+
+/* The number of bytes used to hold the length of a message in the buffer. */
+#define sbBYTES_TO_STORE_MESSAGE_LENGTH ( sizeof( size_t ) )
+
+/* Bits stored in the ucFlags field of the stream buffer. */
+#define sbFLAGS_IS_MESSAGE_BUFFER		( ( unsigned char ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
+
+/*-----------------------------------------------------------*/
+
+/* Structure that hold state information on the buffer. */
+typedef struct xSTREAM_BUFFER /*lint !e9058 Style convention uses tag. */
+{
+	volatile size_t xTail;							/*< Index to the next item to read within the buffer.  Only written by the reader. */
+	volatile size_t xHead;							/*< Index to the next item to write within the buffer.  Only written by the writer. */
+	size_t xLength;									/*< The length of the buffer pointed to by pucBuffer. */
+	volatile size_t xTriggerLevelBytes;				/*< The number of bytes that must be in the stream buffer before a task that is waiting for data is unblocked. */
+	xTaskHandle volatile xTaskWaitingToReceive;		/*< Holds the handle of a task waiting for data, or NULL if no tasks are waiting. */
+	xTaskHandle volatile xTaskWaitingToSend;		/*< Holds the handle of a task waiting to send data to a message buffer that is full. */
+	unsigned char *pucBuffer;						/*< Points to the buffer itself - that is - the RAM that stores the data passed through the buffer. */
+	unsigned char ucFlags;							/*< sbFLAGS_* bits. */
+
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		unsigned portBASE_TYPE uxStreamBufferNumber;	/*< Used for tracing purposes. */
+	#endif
+} xSTREAM_BUFFER;
+
+/*
+ * The number of bytes available to be read from the buffer, and the number of
+ * bytes that can still be written to it.
+ */
+static size_t prvBytesInBuffer( const xSTREAM_BUFFER * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+static size_t prvSpaceInBuffer( const xSTREAM_BUFFER * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy data into the buffer and publish it to the reader by moving the head.
+ * A stream buffer takes as many of the xDataLengthBytes bytes as there is
+ * space for.  A message buffer takes the whole message, preceded by its
+ * length, or nothing at all.  Returns the number of bytes from pucData that
+ * were written.
+ */
+static size_t prvWriteToBuffer( xSTREAM_BUFFER * const pxStreamBuffer, const unsigned char *pucData, size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy data out of the buffer and release the space to the writer by moving
+ * the tail.  A stream buffer returns up to xBufferLengthBytes bytes.  A
+ * message buffer returns the next message, or leaves it in place and returns
+ * 0 if it does not fit in xBufferLengthBytes.
+ */
+static size_t prvReadFromBuffer( xSTREAM_BUFFER * const pxStreamBuffer, unsigned char *pucData, size_t xBufferLengthBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy xCount bytes into the buffer starting at index xHead, or out of the
+ * buffer starting at index xTail, wrapping as necessary.  The indexes held in
+ * the buffer structure are not updated - the new index is returned instead so
+ * the caller can publish several copies at once.
+ */
+static size_t prvWriteBytesToBuffer( xSTREAM_BUFFER * const pxStreamBuffer, const unsigned char *pucData, size_t xCount, size_t xHead ) PRIVILEGED_FUNCTION;
+static size_t prvReadBytesFromBuffer( const xSTREAM_BUFFER * const pxStreamBuffer, unsigned char *pucData, size_t xCount, size_t xTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by the writer once data has been published, and by the reader once
+ * space has been released, to wake a task blocked on the other side.  The
+ * waiting task handle is read without a critical section.  A notification that
+ * arrives after the waiting task has already given up is harmless as tasks
+ * clear stale notifications before they next block.
+ */
+static void prvNotifyReceiver( xSTREAM_BUFFER * const pxStreamBuffer, portBASE_TYPE xFromISR, portBASE_TYPE * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+static void prvNotifySender( xSTREAM_BUFFER * const pxStreamBuffer, portBASE_TYPE xFromISR, portBASE_TYPE * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+static void prvNotifyTask( xTaskHandle xTaskToNotify, portBASE_TYPE xFromISR, portBASE_TYPE * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Block the calling task on its direct to task notification until the other
+ * side of the buffer notifies it or xTicksToWait expires.  pxWaitingTask is the
+ * xTaskWaitingToReceive or xTaskWaitingToSend member of the buffer, and the
+ * task only blocks if pxAvailable() still returns less than xRequiredBytes
+ * after the handle has been published.
+ */
+static void prvWaitForOtherSide( xSTREAM_BUFFER * const pxStreamBuffer, xTaskHandle volatile *pxWaitingTask, size_t ( *pxAvailable )( const xSTREAM_BUFFER * const pxStreamBuffer ), size_t xRequiredBytes, portTickType xTicksToWait ) PRIVILEGED_FUNCTION;
+static portBASE_TYPE prvIsEmpty( const xSTREAM_BUFFER * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+static portBASE_TYPE prvIsFull( const xSTREAM_BUFFER * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+xStreamBufferHandle xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, portBASE_TYPE xIsMessageBuffer )
+{
+xSTREAM_BUFFER *pxStreamBuffer;
+
+	if( xIsMessageBuffer != pdFALSE )
+	{
+		/* Each message is preceded by its length, so the buffer must be able
+		to hold at least that much.  A message is only ever published whole, so
+		any data at all means a complete message can be read. */
+		configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+		xTriggerLevelBytes = ( size_t ) 1;
+	}
+	else
+	{
+		configASSERT( xBufferSizeBytes > ( size_t ) 0 );
+	}
+	configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
+
+	/* A trigger level of 0 would cause a waiting task to unblock even when the
+	buffer was empty. */
+	if( xTriggerLevelBytes == ( size_t ) 0 )
+	{
+		xTriggerLevelBytes = ( size_t ) 1;
+	}
+
+	/* A stream buffer requires an xSTREAM_BUFFER structure and a buffer.  Both
+	are allocated in a single call.  The buffer has one spare byte so a full
+	buffer can be told apart from an empty one by comparing the head and tail
+	alone, which is what allows the reader and writer to run without a lock. */
+	xBufferSizeBytes++;
+	pxStreamBuffer = ( xSTREAM_BUFFER * ) pvPortMalloc( sizeof( xSTREAM_BUFFER ) + xBufferSizeBytes );
+
+	if( pxStreamBuffer != NULL )
+	{
+		memset( ( void * ) pxStreamBuffer, 0x00, sizeof( xSTREAM_BUFFER ) );
+		pxStreamBuffer->pucBuffer = ( ( unsigned char * ) pxStreamBuffer ) + sizeof( xSTREAM_BUFFER ); /*lint !e9016 Indexing past structure valid for uint8_t pointer, also storage area has no alignment requirement. */
+		pxStreamBuffer->xLength = xBufferSizeBytes;
+		pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
+
+		if( xIsMessageBuffer != pdFALSE )
+		{
+			pxStreamBuffer->ucFlags |= sbFLAGS_IS_MESSAGE_BUFFER;
+		}
+
+		traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer );
+	}
+	else
+	{
+		traceSTREAM_BUFFER_CREATE_FAILED( xIsMessageBuffer );
+	}
+
+	return ( xStreamBufferHandle ) pxStreamBuffer;
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferDelete( xStreamBufferHandle xStreamBuffer )
+{
+xSTREAM_BUFFER * pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	traceSTREAM_BUFFER_DELETE( xStreamBuffer );
+
+	/* Both the structure and the buffer were allocated using a single call
+	to pvPortMalloc(), hence only one call to vPortFree() is required. */
+	vPortFree( ( void * ) pxStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xStreamBufferReset( xStreamBufferHandle xStreamBuffer )
+{
+xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+portBASE_TYPE xReturn = pdFAIL;
+
+	configASSERT( pxStreamBuffer );
+
+	/* Both indexes are written here, so this is the one operation that cannot
+	run alongside the reader or the writer. */
+	taskENTER_CRITICAL();
+	{
+		if( pxStreamBuffer->xTaskWaitingToReceive == NULL )
+		{
+			if( pxStreamBuffer->xTaskWaitingToSend == NULL )
+			{
+				pxStreamBuffer->xHead = ( size_t ) 0;
+				pxStreamBuffer->xTail = ( size_t ) 0;
+				xReturn = pdPASS;
+
+				traceSTREAM_BUFFER_RESET( xStreamBuffer );
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xStreamBufferSetTriggerLevel( xStreamBufferHandle xStreamBuffer, size_t xTriggerLevel )
+{
+xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+portBASE_TYPE xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	/* It is not valid for the trigger level to be 0. */
+	if( xTriggerLevel == ( size_t ) 0 )
+	{
+		xTriggerLevel = ( size_t ) 1;
+	}
+
+	/* The trigger level is the number of bytes that must be in the stream
+	buffer before a task that is waiting for data is unblocked.  xLength
+	includes the spare byte. */
+	if( xTriggerLevel < pxStreamBuffer->xLength )
+	{
+		pxStreamBuffer->xTriggerLevelBytes = xTriggerLevel;
+		xReturn = pdPASS;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSpacesAvailable( xStreamBufferHandle xStreamBuffer )
+{
+const xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	return prvSpaceInBuffer( pxStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferBytesAvailable( xStreamBufferHandle xStreamBuffer )
+{
+const xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	return prvBytesInBuffer( pxStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSend( xStreamBufferHandle xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, portTickType xTicksToWait )
+{
+xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+const unsigned char *pucData = ( const unsigned char * ) pvTxData;
+size_t xWritten, xTotalWritten = ( size_t ) 0, xRequiredSpace;
+xTimeOutType xTimeOut;
+
+	configASSERT( pvTxData );
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( unsigned char ) 0 )
+	{
+		/* A message is written whole or not at all, so the writer has to wait
+		for space for the message and its length together. */
+		xRequiredSpace = xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH;
+		configASSERT( xRequiredSpace > xDataLengthBytes );
+
+		/* Do not wait for space that can never become available. */
+		if( xRequiredSpace > ( pxStreamBuffer->xLength - ( size_t ) 1 ) )
+		{
+			xTicksToWait = ( portTickType ) 0;
+		}
+	}
+	else
+	{
+		xRequiredSpace = ( size_t ) 1;
+	}
+
+	if( xTicksToWait != ( portTickType ) 0 )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+	}
+
+	for( ;; )
+	{
+		xWritten = prvWriteToBuffer( pxStreamBuffer, &( pucData[ xTotalWritten ] ), xDataLengthBytes - xTotalWritten );
+
+		if( xWritten != ( size_t ) 0 )
+		{
+			xTotalWritten += xWritten;
+			prvNotifyReceiver( pxStreamBuffer, pdFALSE, NULL );
+		}
+
+		if( xTotalWritten == xDataLengthBytes )
+		{
+			break;
+		}
+
+		/* Wait for the reader to make space for the remaining bytes, unless
+		the block time has been used up. */
+		if( xTicksToWait == ( portTickType ) 0 )
+		{
+			break;
+		}
+
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+		{
+			break;
+		}
+
+		traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
+		prvWaitForOtherSide( pxStreamBuffer, &( pxStreamBuffer->xTaskWaitingToSend ), prvSpaceInBuffer, xRequiredSpace, xTicksToWait );
+	}
+
+	if( xTotalWritten != ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xTotalWritten );
+	}
+	else
+	{
+		traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
+	}
+
+	return xTotalWritten;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendFromISR( xStreamBufferHandle xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, portBASE_TYPE * const pxHigherPriorityTaskWoken )
+{
+xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( pvTxData );
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvWriteToBuffer( pxStreamBuffer, ( const unsigned char * ) pvTxData, xDataLengthBytes );
+
+	if( xReturn != ( size_t ) 0 )
+	{
+		prvNotifyReceiver( pxStreamBuffer, pdTRUE, pxHigherPriorityTaskWoken );
+	}
+
+	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceive( xStreamBufferHandle xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, portTickType xTicksToWait )
+{
+xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+size_t xReceivedLength;
+
+	configASSERT( pvRxData );
+	configASSERT( pxStreamBuffer );
+
+	if( ( xTicksToWait != ( portTickType ) 0 ) && ( prvIsEmpty( pxStreamBuffer ) != pdFALSE ) )
+	{
+		/* Wait for the writer to reach the trigger level.  If the wait times
+		out whatever has arrived in the meantime is still returned.  Messages
+		are published whole, so a message buffer is woken by any data. */
+		traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+		prvWaitForOtherSide( pxStreamBuffer, &( pxStreamBuffer->xTaskWaitingToReceive ), prvBytesInBuffer, ( size_t ) 1, xTicksToWait );
+	}
+
+	xReceivedLength = prvReadFromBuffer( pxStreamBuffer, ( unsigned char * ) pvRxData, xBufferLengthBytes );
+
+	if( xReceivedLength != ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
+		prvNotifySender( pxStreamBuffer, pdFALSE, NULL );
+	}
+	else
+	{
+		traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+	}
+
+	return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveFromISR( xStreamBufferHandle xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, portBASE_TYPE * const pxHigherPriorityTaskWoken )
+{
+xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+size_t xReceivedLength;
+
+	configASSERT( pvRxData );
+	configASSERT( pxStreamBuffer );
+
+	xReceivedLength = prvReadFromBuffer( pxStreamBuffer, ( unsigned char * ) pvRxData, xBufferLengthBytes );
+
+	if( xReceivedLength != ( size_t ) 0 )
+	{
+		prvNotifySender( pxStreamBuffer, pdTRUE, pxHigherPriorityTaskWoken );
+	}
+
+	traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength );
+
+	return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xStreamBufferIsEmpty( xStreamBufferHandle xStreamBuffer )
+{
+const xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	return prvIsEmpty( pxStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xStreamBufferIsFull( xStreamBufferHandle xStreamBuffer )
+{
+const xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	return prvIsFull( pxStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferNextMessageLengthBytes( xStreamBufferHandle xStreamBuffer )
+{
+const xSTREAM_BUFFER * const pxStreamBuffer = ( xSTREAM_BUFFER * ) xStreamBuffer;
+size_t xReturn = ( size_t ) 0;
+
+	configASSERT( pxStreamBuffer );
+
+	/* Only the reader moves the tail, so the length can be peeked without a
+	critical section as long as it is the reader that calls this. */
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( unsigned char ) 0 )
+	{
+		if( prvBytesInBuffer( pxStreamBuffer ) >= sbBYTES_TO_STORE_MESSAGE_LENGTH )
+		{
+			( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( unsigned char * ) &xReturn, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvIsEmpty( const xSTREAM_BUFFER * const pxStreamBuffer )
+{
+portBASE_TYPE xReturn;
+
+	if( pxStreamBuffer->xHead == pxStreamBuffer->xTail )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvIsFull( const xSTREAM_BUFFER * const pxStreamBuffer )
+{
+portBASE_TYPE xReturn;
+
+	if( prvSpaceInBuffer( pxStreamBuffer ) == ( size_t ) 0 )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvBytesInBuffer( const xSTREAM_BUFFER * const pxStreamBuffer )
+{
+/* Read each index once - the other side may move its index at any time, but
+only ever in the direction that makes the result stale, never invalid. */
+const size_t xHead = pxStreamBuffer->xHead;
+const size_t xTail = pxStreamBuffer->xTail;
+size_t xCount;
+
+	xCount = pxStreamBuffer->xLength + xHead;
+	xCount -= xTail;
+	if ( xCount >= pxStreamBuffer->xLength )
+	{
+		xCount -= pxStreamBuffer->xLength;
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvSpaceInBuffer( const xSTREAM_BUFFER * const pxStreamBuffer )
+{
+	/* xLength includes the spare byte that is never written. */
+	return ( pxStreamBuffer->xLength - ( size_t ) 1 ) - prvBytesInBuffer( pxStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteToBuffer( xSTREAM_BUFFER * const pxStreamBuffer, const unsigned char *pucData, size_t xDataLengthBytes )
+{
+size_t xHead = pxStreamBuffer->xHead, xSpace;
+
+	xSpace = prvSpaceInBuffer( pxStreamBuffer );
+
+	if( xDataLengthBytes == ( size_t ) 0 )
+	{
+		/* Nothing to write - and a zero length message could not be told
+		apart from a failed read. */
+	}
+	else if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( unsigned char ) 0 )
+	{
+		if( xSpace >= ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) )
+		{
+			xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const unsigned char * ) &xDataLengthBytes, sbBYTES_TO_STORE_MESSAGE_LENGTH, xHead );
+		}
+		else
+		{
+			xDataLengthBytes = ( size_t ) 0;
+		}
+	}
+	else if( xDataLengthBytes > xSpace )
+	{
+		xDataLengthBytes = xSpace;
+	}
+
+	if( xDataLengthBytes != ( size_t ) 0 )
+	{
+		xHead = prvWriteBytesToBuffer( pxStreamBuffer, pucData, xDataLengthBytes, xHead );
+
+		/* The data, and the length for a message, must be in the buffer
+		before the reader can see the new head. */
+		portMEMORY_BARRIER();
+		pxStreamBuffer->xHead = xHead;
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadFromBuffer( xSTREAM_BUFFER * const pxStreamBuffer, unsigned char *pucData, size_t xBufferLengthBytes )
+{
+size_t xTail = pxStreamBuffer->xTail, xCount, xMessageLength;
+
+	xCount = prvBytesInBuffer( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( unsigned char ) 0 )
+	{
+		/* The writer publishes a message and its length together, so if
+		there is any data there is a whole message. */
+		if( xCount != ( size_t ) 0 )
+		{
+			( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( unsigned char * ) &xMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xTail );
+
+			if( xMessageLength <= xBufferLengthBytes )
+			{
+				xTail += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+				if( xTail >= pxStreamBuffer->xLength )
+				{
+					xTail -= pxStreamBuffer->xLength;
+				}
+				xCount = xMessageLength;
+			}
+			else
+			{
+				/* The message does not fit in the caller's buffer, so leave it
+				where it is for a later call to xStreamBufferReceive(). */
+				xCount = ( size_t ) 0;
+			}
+		}
+	}
+	else if( xCount > xBufferLengthBytes )
+	{
+		xCount = xBufferLengthBytes;
+	}
+
+	if( xCount != ( size_t ) 0 )
+	{
+		xTail = prvReadBytesFromBuffer( pxStreamBuffer, pucData, xCount, xTail );
+
+		/* The data must have been copied out before the writer can reuse the
+		space. */
+		portMEMORY_BARRIER();
+		pxStreamBuffer->xTail = xTail;
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteBytesToBuffer( xSTREAM_BUFFER * const pxStreamBuffer, const unsigned char *pucData, size_t xCount, size_t xHead )
+{
+size_t xFirstLength;
+
+	/* Calculate the number of bytes that can be added in the first write -
+	which may be less than the total number of bytes that need to be added if
+	the buffer will wrap back to the beginning. */
+	xFirstLength = pxStreamBuffer->xLength - xHead;
+	if( xFirstLength > xCount )
+	{
+		xFirstLength = xCount;
+	}
+
+	/* Write as many bytes as can be written in the first write. */
+	( void ) memcpy( ( void * ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) pucData, xFirstLength );
+
+	/* If the number of bytes written was less than the number that could be
+	written in the first write... */
+	if( xCount > xFirstLength )
+	{
+		/* ...then write the remaining bytes to the start of the buffer. */
+		( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength );
+	}
+
+	xHead += xCount;
+	if( xHead >= pxStreamBuffer->xLength )
+	{
+		xHead -= pxStreamBuffer->xLength;
+	}
+
+	return xHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadBytesFromBuffer( const xSTREAM_BUFFER * const pxStreamBuffer, unsigned char *pucData, size_t xCount, size_t xTail )
+{
+size_t xFirstLength;
+
+	/* Calculate the number of bytes that can be read - which may be
+	less than the number wanted if the data wraps around to the start of
+	the buffer. */
+	xFirstLength = pxStreamBuffer->xLength - xTail;
+	if( xFirstLength > xCount )
+	{
+		xFirstLength = xCount;
+	}
+
+	/* Obtain the number of bytes it is possible to obtain in the first
+	read. */
+	( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength );
+
+	/* One or two reads are needed depending on whether the data wraps
+	round to the start of the buffer. */
+	if( xCount > xFirstLength )
+	{
+		/* ...then read the remaining bytes from the start of the
+		buffer. */
+		( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength );
+	}
+
+	xTail += xCount;
+	if( xTail >= pxStreamBuffer->xLength )
+	{
+		xTail -= pxStreamBuffer->xLength;
+	}
+
+	return xTail;
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyReceiver( xSTREAM_BUFFER * const pxStreamBuffer, portBASE_TYPE xFromISR, portBASE_TYPE * const pxHigherPriorityTaskWoken )
+{
+xTaskHandle xTaskToNotify;
+
+	/* The new head must be visible before the handle is read, the mirror of
+	the barrier in prvWaitForOtherSide(), or on a multicore build both sides
+	could miss each other. */
+	portMEMORY_BARRIER();
+	xTaskToNotify = pxStreamBuffer->xTaskWaitingToReceive;
+
+	/* Only wake the reader once the trigger level has been reached. */
+	if( xTaskToNotify != NULL )
+	{
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			prvNotifyTask( xTaskToNotify, xFromISR, pxHigherPriorityTaskWoken );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifySender( xSTREAM_BUFFER * const pxStreamBuffer, portBASE_TYPE xFromISR, portBASE_TYPE * const pxHigherPriorityTaskWoken )
+{
+xTaskHandle xTaskToNotify;
+
+	portMEMORY_BARRIER();
+	xTaskToNotify = pxStreamBuffer->xTaskWaitingToSend;
+
+	if( xTaskToNotify != NULL )
+	{
+		prvNotifyTask( xTaskToNotify, xFromISR, pxHigherPriorityTaskWoken );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyTask( xTaskHandle xTaskToNotify, portBASE_TYPE xFromISR, portBASE_TYPE * const pxHigherPriorityTaskWoken )
+{
+	if( xFromISR != pdFALSE )
+	{
+		( void ) xTaskNotifyFromISR( xTaskToNotify, ( unsigned long ) 0, eNoAction, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		( void ) xTaskNotify( xTaskToNotify, ( unsigned long ) 0, eNoAction );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitForOtherSide( xSTREAM_BUFFER * const pxStreamBuffer, xTaskHandle volatile *pxWaitingTask, size_t ( *pxAvailable )( const xSTREAM_BUFFER * const pxStreamBuffer ), size_t xRequiredBytes, portTickType xTicksToWait )
+{
+	/* Only one reader and one writer are supported, so there can only be one
+	task waiting on each side. */
+	configASSERT( *pxWaitingTask == NULL );
+
+	/* Discard any notification left over from an earlier wait, then publish
+	the handle.  Anything the other side does after this point will notify the
+	task, so re-checking the buffer afterwards means no event can be missed. */
+	( void ) xTaskNotifyWait( ( unsigned long ) 0, ( unsigned long ) 0, NULL, ( portTickType ) 0 );
+	*pxWaitingTask = xTaskGetCurrentTaskHandle();
+	portMEMORY_BARRIER();
+
+	if( pxAvailable( pxStreamBuffer ) < xRequiredBytes )
+	{
+		( void ) xTaskNotifyWait( ( unsigned long ) 0, ( unsigned long ) 0, NULL, xTicksToWait );
+	}
+
+	*pxWaitingTask = NULL;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	unsigned portBASE_TYPE uxStreamBufferGetStreamBufferNumber( xStreamBufferHandle xStreamBuffer )
+	{
+		return ( ( xSTREAM_BUFFER * ) xStreamBuffer )->uxStreamBufferNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	void vStreamBufferSetStreamBufferNumber( xStreamBufferHandle xStreamBuffer, unsigned portBASE_TYPE uxStreamBufferNumber )
+	{
+		( ( xSTREAM_BUFFER * ) xStreamBuffer )->uxStreamBufferNumber = uxStreamBufferNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
@@ -103,6 +103,62 @@ privileged Vs unprivileged linkage and placement. */
  */
 #define tskIDLE_STACK_SIZE	configMINIMAL_STACK_SIZE
 
+/*
+ * The event list item value normally holds the task priority, so event lists
+ * can be kept in priority order.  Event groups store the bits a task is
+ * waiting for in the item value instead, and set this bit to stop priority
+ * changes overwriting them.
+ */
+#if configUSE_16_BIT_TICKS == 1
+	#define taskEVENT_LIST_ITEM_VALUE_IN_USE	0x8000U
+#else
+	#define taskEVENT_LIST_ITEM_VALUE_IN_USE	0x80000000UL
+#endif
+
+/*
+ * The type the tick count and the wake times of delayed tasks are held in, and
+ * the value xNextTaskUnblockTime takes when no task is delayed.  A 64 bit count
+ * never overflows, so a single delayed list is used and it never has to be
+ * switched with an overflow list.
+ */
+#if ( configUSE_64_BIT_TICKS == 1 )
+	typedef portTick64Type tskTickType;
+	#define tskMAX_TICK_COUNT	( ( tskTickType ) 0xffffffffffffffffULL )
+#else
+	typedef portTickType tskTickType;
+	#define tskMAX_TICK_COUNT	portMAX_DELAY
+#endif
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	/* The state of a task's notification value. */
+	typedef enum
+	{
+		eNotWaitingNotification = 0,
+		eWaitingNotification,
+		eNotified
+	} eNotifyValue;
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	/* Values that can be assigned to the ucStaticallyAllocated member of the
+	TCB, recording which of the TCB and stack have to be freed when the task is
+	deleted. */
+	#define tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB		( ( unsigned char ) 0 )
+	#define tskSTATICALLY_ALLOCATED_STACK_ONLY			( ( unsigned char ) 1 )
+	#define tskSTATICALLY_ALLOCATED_STACK_AND_TCB		( ( unsigned char ) 2 )
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+#if ( configNUM_CORES > 1 )
+
+	/* Value of xTaskRunState for a task that is not running on any core. */
+	#define taskTASK_NOT_RUNNING	( ( portBASE_TYPE ) -1 )
+
+#endif /* configNUM_CORES */
+
 /*
  * Task control block.  A task control block (TCB) is allocated for each task,
  * and stores task state information, including a pointer to the task's context
@@ -137,6 +193,12 @@ typedef struct tskTaskControlBlock
 
 	#if ( configUSE_MUTEXES == 1 )
 		unsigned portBASE_TYPE uxBasePriority;	/*< The priority last assigned to the task - used by the priority inheritance mechanism. */
+		xList xMutexesHeld;						/*< The mutexes the task holds, so its inherited priority can be worked out again when it gives one back. */
+		void *pvMutexWaitedOn;					/*< The mutex the task is blocked on, or NULL.  Lets an inherited priority pass along a chain of blocked mutex holders. */
+	#endif
+
+	#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+		unsigned portBASE_TYPE uxCeilingPriority; /*< The highest ceiling of the priority ceiling mutexes held by the task, or tskIDLE_PRIORITY if it holds none.  The task does not run below this priority. */
 	#endif
 
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
@@ -144,7 +206,43 @@ typedef struct tskTaskControlBlock
 	#endif
 
 	#if ( configGENERATE_RUN_TIME_STATS == 1 )
-		unsigned long ulRunTimeCounter;			/*< Stores the amount of time the task has spent in the Running state. */
+		unsigned long long ullRunTimeCounter;	/*< Stores the amount of time the task has spent in the Running state. */
+	#endif
+
+	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+		volatile unsigned long ulNotifiedValue;	/*< The value sent to the task by xTaskGenericNotify() and friends. */
+		volatile eNotifyValue eNotifyState;		/*< Whether the task is waiting for, or has a pending, notification. */
+	#endif
+
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+		unsigned char ucStaticallyAllocated;	/*< Set to one of the tsk*_ALLOCATED_* values so only memory allocated by the kernel is freed when the task is deleted. */
+	#endif
+
+	#if ( configNUM_CORES > 1 )
+		volatile portBASE_TYPE xTaskRunState;	/*< The core the task is running on, or taskTASK_NOT_RUNNING. */
+	#endif
+
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		portTickType xRelativeDeadline;			/*< Deadline of each job measured from its release, or 0 if the task is scheduled by priority alone. */
+		portTickType xAbsoluteDeadline;			/*< The tick by which the current job should complete.  Orders the task within its ready list. */
+	#endif
+
+	#if ( configUSE_TASK_TIME_SLICES == 1 )
+		portTickType xTimeSlice;				/*< The number of ticks the task runs before a ready task of equal priority is given the processor. */
+		portTickType xTimeSliceLeft;			/*< The ticks left of the current time slice.  Reloaded from xTimeSlice each time the task is switched in. */
+	#endif
+
+	#if ( configUSE_HIGH_RES_DELAYS == 1 )
+		unsigned long ulHighResWakeTime;		/*< The high resolution time at which the task is to leave xHighResDelayedTaskList. */
+	#endif
+
+	#if ( configTASK_POOL_SIZE > 0 )
+		unsigned short usStackDepth;			/*< The number of words allocated for the stack, so the TCB can be reused from the pool for any task that needs no more. */
+	#endif
+
+	#if ( configRECORD_WAKE_LATENCY == 1 )
+		xISRRunTimeStats *pxWakeSource;			/*< The interrupt that last readied the task, or NULL if the task has run since or was readied by another task. */
+		unsigned long ulWakeTime;				/*< The run time stats clock when pxWakeSource was entered. */
 	#endif
 
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
@@ -172,14 +270,60 @@ typedef struct tskTaskControlBlock
 /*lint -e956 A manual analysis and inspection has been used to determine which
 static variables must be declared volatile. */
 
-PRIVILEGED_DATA tskTCB * volatile pxCurrentTCB = NULL;
+#if ( configNUM_CORES == 1 )
+
+	PRIVILEGED_DATA tskTCB * volatile pxCurrentTCB = NULL;
+
+#else
+
+	/* The task running on each core.  A task can resume on a different core
+	each time it is switched out, so the running task reads its own entry
+	through xTaskGetCurrentTaskHandle(), which masks interrupts between finding
+	the core ID and indexing the array.  Entries are only written with the
+	kernel lock held. */
+	PRIVILEGED_DATA tskTCB * volatile pxCurrentTCBs[ configNUM_CORES ] = { NULL };
+	#define pxCurrentTCB	( ( tskTCB * ) xTaskGetCurrentTaskHandle() )
+
+#endif /* configNUM_CORES */
 
 /* Lists for ready and blocked tasks. --------------------*/
 PRIVILEGED_DATA static xList pxReadyTasksLists[ configMAX_PRIORITIES ];	/*< Prioritised ready tasks. */
-PRIVILEGED_DATA static xList xDelayedTaskList1;							/*< Delayed tasks. */
-PRIVILEGED_DATA static xList xDelayedTaskList2;							/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static xList * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static xList * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#if ( configUSE_TIMING_WHEEL == 1 )
+
+	/* Delayed tasks are hashed into the slots of a hierarchical timing wheel
+	rather than held in a sorted list, so blocking and unblocking are O(1) no
+	matter how many tasks are delayed.  Each slot of level n spans
+	tskWHEEL_SLOTS^n ticks.  Tasks in a higher level slot are moved down the
+	wheel when the tick count reaches the start of the slot. */
+	#define tskWHEEL_SLOTS			( ( portTickType ) 1U << configTIMING_WHEEL_SLOT_BITS )
+	#define tskWHEEL_SLOT_MASK		( tskWHEEL_SLOTS - ( portTickType ) 1U )
+	#define tskWHEEL_LEVEL_SHIFT( uxLevel )	( ( uxLevel ) * ( unsigned portBASE_TYPE ) configTIMING_WHEEL_SLOT_BITS )
+
+	#if ( configUSE_16_BIT_TICKS == 1 )
+		#define tskWHEEL_USE_FAR_LIST	( ( configTIMING_WHEEL_SLOT_BITS * configTIMING_WHEEL_LEVELS ) < 16 )
+	#else
+		#define tskWHEEL_USE_FAR_LIST	( ( configTIMING_WHEEL_SLOT_BITS * configTIMING_WHEEL_LEVELS ) < 32 )
+	#endif
+
+	PRIVILEGED_DATA static xList xDelayedTaskWheel[ configTIMING_WHEEL_LEVELS ][ tskWHEEL_SLOTS ];	/*< Delayed tasks, hashed by wake time. */
+	PRIVILEGED_DATA static xList xDelayedTaskFarList;						/*< Delayed tasks whose wake time is beyond the span of the wheel.  Re-examined each time the top level of the wheel wraps. */
+	PRIVILEGED_DATA static portTickType xWheelTickCount = ( portTickType ) configINITIAL_TICK_COUNT;	/*< The last tick processed by the wheel.  Lags xTickCount after vTaskStepTick() until the next tick interrupt. */
+
+#elif ( configUSE_64_BIT_TICKS == 1 )
+
+	PRIVILEGED_DATA static xList xDelayedTaskList1;							/*< Delayed tasks, in order of their 64 bit wake time. */
+	#define pxDelayedTaskList	( &xDelayedTaskList1 )
+
+#else
+
+	PRIVILEGED_DATA static xList xDelayedTaskList1;							/*< Delayed tasks. */
+	PRIVILEGED_DATA static xList xDelayedTaskList2;							/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+	PRIVILEGED_DATA static xList * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
+	PRIVILEGED_DATA static xList * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#endif /* configUSE_TIMING_WHEEL */
+
 PRIVILEGED_DATA static xList xPendingReadyList;							/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -187,6 +331,10 @@ PRIVILEGED_DATA static xList xPendingReadyList;							/*< Tasks that have been r
 	PRIVILEGED_DATA static xList xTasksWaitingTermination;				/*< Tasks that have been deleted - but the their memory not yet freed. */
 	PRIVILEGED_DATA static volatile unsigned portBASE_TYPE uxTasksDeleted = ( unsigned portBASE_TYPE ) 0U;
 
+	#if ( configTASK_POOL_SIZE > 0 )
+		PRIVILEGED_DATA static xList xTaskPool;							/*< The TCBs of deleted tasks, with their stacks still attached, kept for reuse.  Sorted by stack depth. */
+	#endif
+
 #endif
 
 #if ( INCLUDE_vTaskSuspend == 1 )
@@ -195,28 +343,86 @@ PRIVILEGED_DATA static xList xPendingReadyList;							/*< Tasks that have been r
 
 #endif
 
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+
+	PRIVILEGED_DATA static xList xHighResDelayedTaskList;				/*< Tasks waiting for a high resolution wake time less than two tick periods away.  Not sorted, as the wake times can straddle the high resolution clock wrapping. */
+
+#endif
+
 #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 
 	PRIVILEGED_DATA static xTaskHandle xIdleTaskHandle = NULL;			/*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
 
 #endif
 
+#if ( ( configNUM_CORES > 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	/* Memory for the idle tasks of the second and subsequent cores.  Only the
+	first idle task is created from memory provided by the application. */
+	PRIVILEGED_DATA static xStaticTask xCoreIdleTaskTCBs[ configNUM_CORES - 1 ];
+	PRIVILEGED_DATA static portSTACK_TYPE uxCoreIdleTaskStacks[ configNUM_CORES - 1 ][ tskIDLE_STACK_SIZE ];
+
+#endif
+
 /* Other file private variables. --------------------------------*/
 PRIVILEGED_DATA static volatile unsigned portBASE_TYPE uxCurrentNumberOfTasks 	= ( unsigned portBASE_TYPE ) 0U;
-PRIVILEGED_DATA static volatile portTickType xTickCount 						= ( portTickType ) 0U;
+PRIVILEGED_DATA static volatile tskTickType xTickCount 						= ( tskTickType ) configINITIAL_TICK_COUNT;
 PRIVILEGED_DATA static volatile unsigned portBASE_TYPE uxTopReadyPriority 		= tskIDLE_PRIORITY;
 PRIVILEGED_DATA static volatile signed portBASE_TYPE xSchedulerRunning 			= pdFALSE;
-PRIVILEGED_DATA static volatile unsigned portBASE_TYPE uxSchedulerSuspended	 	= ( unsigned portBASE_TYPE ) pdFALSE;
 PRIVILEGED_DATA static volatile unsigned portBASE_TYPE uxPendedTicks 			= ( unsigned portBASE_TYPE ) 0U;
-PRIVILEGED_DATA static volatile portBASE_TYPE xYieldPending 					= pdFALSE;
-PRIVILEGED_DATA static volatile portBASE_TYPE xNumOfOverflows 					= ( portBASE_TYPE ) 0;
+
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+
+	/* The port's bit map only has room for 32 priorities, so above that the
+	ready priorities are held in one bit map per group of 32, and each bit of
+	uxTopReadyPriority says whether a group has any priority ready. */
+	#if ( configMAX_PRIORITIES > 32 )
+		#define taskREADY_PRIORITY_GROUPS	( ( configMAX_PRIORITIES + 31 ) / 32 )
+		PRIVILEGED_DATA static volatile unsigned portBASE_TYPE uxReadyPriorityGroups[ taskREADY_PRIORITY_GROUPS ];
+	#endif
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+#if ( configNUM_CORES == 1 )
+	PRIVILEGED_DATA static volatile unsigned portBASE_TYPE uxSchedulerSuspended	= ( unsigned portBASE_TYPE ) pdFALSE;
+	PRIVILEGED_DATA static volatile portBASE_TYPE xYieldPending 				= pdFALSE;
+#else
+	/* Only the core that holds the kernel lock can have the scheduler
+	suspended, see vTaskSuspendAll().  The count is still kept per core so
+	that the other cores, which may read it without the lock, do not see the
+	suspension as their own. */
+	PRIVILEGED_DATA static volatile unsigned portBASE_TYPE uxSchedulerSuspendeds[ configNUM_CORES ] = { ( unsigned portBASE_TYPE ) pdFALSE };
+	PRIVILEGED_DATA static volatile portBASE_TYPE xYieldPendings[ configNUM_CORES ] = { pdFALSE };
+	#define uxSchedulerSuspended	uxSchedulerSuspendeds[ portGET_CORE_ID() ]
+	#define xYieldPending	xYieldPendings[ portGET_CORE_ID() ]
+#endif
+#if ( configUSE_64_BIT_TICKS == 0 )
+	PRIVILEGED_DATA static volatile portBASE_TYPE xNumOfOverflows 				= ( portBASE_TYPE ) 0;
+#endif
 PRIVILEGED_DATA static unsigned portBASE_TYPE uxTaskNumber 						= ( unsigned portBASE_TYPE ) 0U;
-PRIVILEGED_DATA static volatile portTickType xNextTaskUnblockTime				= portMAX_DELAY;
+PRIVILEGED_DATA static volatile tskTickType xNextTaskUnblockTime				= tskMAX_TICK_COUNT;
 
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
-	PRIVILEGED_DATA static unsigned long ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
-	PRIVILEGED_DATA static unsigned long ulTotalRunTime = 0UL;			/*< Holds the total amount of execution time as defined by the run time counter clock. */
+	PRIVILEGED_DATA static unsigned long ulRunTimeStamp = 0UL;						/*< Holds the value of the run time counter when time was last charged to a task or interrupt. */
+	PRIVILEGED_DATA static unsigned long long ullTotalRunTime = 0ULL;				/*< Holds the total amount of execution time charged since the scheduler started. */
+	PRIVILEGED_DATA static unsigned long long *pullRunTimeCounterCharged = NULL;	/*< The counter time is currently being charged to - that of the running task, or of a registered interrupt that interrupted it. */
+	PRIVILEGED_DATA static xISRRunTimeStats *pxISRRunTimeStatsList = NULL;			/*< Interrupts registered with vTaskRegisterISRRunTimeStats(). */
+	PRIVILEGED_DATA static unsigned portBASE_TYPE uxISRRunTimeStatsCount = 0U;		/*< The number of interrupts in pxISRRunTimeStatsList. */
+
+#endif
+
+#if ( configRECORD_WAKE_LATENCY == 1 )
+
+	PRIVILEGED_DATA static xISRRunTimeStats *pxWakeSource = NULL;	/*< The innermost registered interrupt being executed, to which any task readied is attributed. */
+
+#endif
+
+#if ( configRECORD_SECTION_LATENCY == 1 )
+
+	/* Indexed by eLatencySection. */
+	PRIVILEGED_DATA static xSectionLatencyStats xSectionLatency[ 2 ];
+	PRIVILEGED_DATA static unsigned long ulSectionStartTime[ 2 ];	/*< The run time counter value when the section in progress started. */
+	PRIVILEGED_DATA static void *pvSectionCaller[ 2 ] = { NULL, NULL };	/*< Where the section in progress was started from, or NULL if none is being timed. */
 
 #endif
 
@@ -258,27 +464,36 @@ PRIVILEGED_DATA static volatile portTickType xNextTaskUnblockTime				= portMAX_D
 
 	/*-----------------------------------------------------------*/
 
-	#define taskSELECT_HIGHEST_PRIORITY_TASK()																			\
-	{																													\
-		/* Find the highest priority queue that contains ready tasks. */												\
-		while( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopReadyPriority ] ) ) )										\
+	#if ( configNUM_CORES == 1 )
+
+		#define taskSELECT_HIGHEST_PRIORITY_TASK()																		\
 		{																												\
-			configASSERT( uxTopReadyPriority );																			\
-			--uxTopReadyPriority;																						\
-		}																												\
+			/* Find the highest priority queue that contains ready tasks. */											\
+			while( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopReadyPriority ] ) ) )									\
+			{																											\
+				configASSERT( uxTopReadyPriority );																		\
+				--uxTopReadyPriority;																					\
+			}																											\
 																														\
-		/* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of										\
-		the	same priority get an equal share of the processor time. */													\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopReadyPriority ] ) );						\
-	} /* taskSELECT_HIGHEST_PRIORITY_TASK */
+			taskSELECT_FROM_READY_LIST( pxCurrentTCB, &( pxReadyTasksLists[ uxTopReadyPriority ] ) );					\
+		} /* taskSELECT_HIGHEST_PRIORITY_TASK */
+
+	#else
+
+		/* The highest priority ready task may already be running on another
+		core, so the lists have to be searched - see
+		prvSelectHighestPriorityTask(). */
+		#define taskSELECT_HIGHEST_PRIORITY_TASK() prvSelectHighestPriorityTask( portGET_CORE_ID() )
+
+	#endif /* configNUM_CORES */
 
 	/*-----------------------------------------------------------*/
 
-	/* Define away taskRESET_READY_PRIORITY() and portRESET_READY_PRIORITY() as
+	/* Define away taskRESET_READY_PRIORITY() and taskCLEAR_READY_PRIORITY() as
 	they are only required when a port optimised method of task selection is
 	being used. */
 	#define taskRESET_READY_PRIORITY( uxPriority )
-	#define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )
+	#define taskCLEAR_READY_PRIORITY( uxPriority )
 
 #else /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 
@@ -286,20 +501,62 @@ PRIVILEGED_DATA static volatile portTickType xNextTaskUnblockTime				= portMAX_D
 	performed in a way that is tailored to the particular microcontroller
 	architecture being used. */
 
-	/* A port optimised version is provided.  Call the port defined macros. */
-	#define taskRECORD_READY_PRIORITY( uxPriority )	portRECORD_READY_PRIORITY( uxPriority, uxTopReadyPriority )
+	#if ( configMAX_PRIORITIES <= 32 )
 
-	/*-----------------------------------------------------------*/
+		/* A port optimised version is provided.  Call the port defined macros. */
+		#define taskRECORD_READY_PRIORITY( uxPriority )	portRECORD_READY_PRIORITY( uxPriority, uxTopReadyPriority )
 
-	#define taskSELECT_HIGHEST_PRIORITY_TASK()														\
-	{																								\
-	unsigned portBASE_TYPE uxTopPriority;															\
-																									\
-		/* Find the highest priority queue that contains ready tasks. */							\
-		portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );								\
-		configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );		\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );		\
-	} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
+		/* Clear the bit of a priority whose ready list is known to be empty. */
+		#define taskCLEAR_READY_PRIORITY( uxPriority ) portRESET_READY_PRIORITY( ( uxPriority ), ( uxTopReadyPriority ) )
+
+		/*-----------------------------------------------------------*/
+
+		#define taskSELECT_HIGHEST_PRIORITY_TASK()														\
+		{																								\
+		unsigned portBASE_TYPE uxTopPriority;															\
+																										\
+			/* Find the highest priority queue that contains ready tasks. */							\
+			portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );								\
+			configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );		\
+			taskSELECT_FROM_READY_LIST( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );		\
+		} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
+
+	#else
+
+		/* The same port defined macros are applied twice, first to the group
+		bit map and then to uxTopReadyPriority, so selection still takes two
+		count leading zeros instructions whatever the number of priorities. */
+		#define taskRECORD_READY_PRIORITY( uxPriority )														\
+		{																									\
+			portRECORD_READY_PRIORITY( ( uxPriority ) & 31U, uxReadyPriorityGroups[ ( uxPriority ) >> 5 ] );	\
+			portRECORD_READY_PRIORITY( ( uxPriority ) >> 5, uxTopReadyPriority );							\
+		}
+
+		#define taskCLEAR_READY_PRIORITY( uxPriority )														\
+		{																									\
+			portRESET_READY_PRIORITY( ( uxPriority ) & 31U, uxReadyPriorityGroups[ ( uxPriority ) >> 5 ] );	\
+			if( uxReadyPriorityGroups[ ( uxPriority ) >> 5 ] == ( unsigned portBASE_TYPE ) 0 )				\
+			{																								\
+				portRESET_READY_PRIORITY( ( uxPriority ) >> 5, uxTopReadyPriority );						\
+			}																								\
+		}
+
+		/*-----------------------------------------------------------*/
+
+		#define taskSELECT_HIGHEST_PRIORITY_TASK()															\
+		{																									\
+		unsigned portBASE_TYPE uxTopGroup, uxTopPriority;													\
+																											\
+			/* Find the highest group with a ready priority, then the highest								\
+			ready priority within it. */																	\
+			portGET_HIGHEST_PRIORITY( uxTopGroup, uxTopReadyPriority );										\
+			portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorityGroups[ uxTopGroup ] );					\
+			uxTopPriority += uxTopGroup << 5;																\
+			configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );			\
+			taskSELECT_FROM_READY_LIST( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );			\
+		} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
+
+	#endif /* configMAX_PRIORITIES */
 
 	/*-----------------------------------------------------------*/
 
@@ -310,7 +567,7 @@ PRIVILEGED_DATA static volatile portTickType xNextTaskUnblockTime				= portMAX_D
 	{																								\
 		if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ ( uxPriority ) ] ) ) == 0 )				\
 		{																							\
-			portRESET_READY_PRIORITY( ( uxPriority ), ( uxTopReadyPriority ) );						\
+			taskCLEAR_READY_PRIORITY( uxPriority );													\
 		}																							\
 	}
 
@@ -354,14 +611,148 @@ count overflows. */
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+
+	/* The number of high resolution clock counts in one tick period. */
+	#define tskHIGH_RES_COUNTS_PER_TICK	( ( unsigned long ) portHIGH_RES_COUNTS_PER_US * ( 1000000UL / ( unsigned long ) configTICK_RATE_HZ ) )
+
+	/* The high resolution clock wraps at the width of an unsigned long.  A
+	difference between two times above half the range is taken to be
+	negative, so the later of the two times has already passed. */
+	#define tskHIGH_RES_HALF_RANGE		( ( ~( unsigned long ) 0UL ) >> 1 )
+
+#endif /* configUSE_HIGH_RES_DELAYS */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Evaluates to true if pxList is one of the lists used to hold tasks that are
+ * blocked with a timeout.
+ */
+#if ( configUSE_TIMING_WHEEL == 1 )
+
+	#define taskLIST_IS_DELAYED_LIST( pxList )																			\
+		( ( ( ( pxList ) >= &( xDelayedTaskWheel[ 0 ][ 0 ] ) ) &&														\
+			( ( pxList ) <= &( xDelayedTaskWheel[ configTIMING_WHEEL_LEVELS - 1 ][ tskWHEEL_SLOTS - 1 ] ) ) ) ||		\
+		  ( ( pxList ) == &xDelayedTaskFarList ) )
+
+#elif ( configUSE_64_BIT_TICKS == 1 )
+
+	#define taskLIST_IS_DELAYED_LIST( pxList ) ( ( pxList ) == pxDelayedTaskList )
+
+#else
+
+	#define taskLIST_IS_DELAYED_LIST( pxList ) ( ( ( pxList ) == pxDelayedTaskList ) || ( ( pxList ) == pxOverflowDelayedTaskList ) )
+
+#endif /* configUSE_TIMING_WHEEL */
+
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	/*
+	 * The deadline reported for a task, or portMAX_DELAY if it has none.
+	 */
+	#define taskDEADLINE_KEY( pxTCB ) ( ( ( pxTCB )->xRelativeDeadline != ( portTickType ) 0 ) ? ( pxTCB )->xAbsoluteDeadline : portMAX_DELAY )
+
+	/*
+	 * The time left until the deadline of pxTCB, so that deadlines either side
+	 * of a tick count overflow compare correctly.  Half the tick range is added
+	 * so a deadline that has already been missed still compares as the
+	 * earliest, rather than as one a whole tick range away.
+	 */
+	#define taskDEADLINE_DISTANCE( pxTCB ) ( ( portTickType ) ( ( ( pxTCB )->xAbsoluteDeadline - ( portTickType ) xTickCount ) + ( portMAX_DELAY >> 1 ) ) )
+
+	/*
+	 * Evaluates to pdTRUE if pxTCB has a deadline and it is earlier than that
+	 * of pxOtherTCB.  A task without a deadline comes after every task that has
+	 * one.
+	 */
+	#define taskDEADLINE_IS_EARLIER( pxTCB, pxOtherTCB )																\
+		( ( ( pxTCB )->xRelativeDeadline != ( portTickType ) 0 ) &&												\
+		  ( ( ( pxOtherTCB )->xRelativeDeadline == ( portTickType ) 0 ) || ( taskDEADLINE_DISTANCE( pxTCB ) < taskDEADLINE_DISTANCE( pxOtherTCB ) ) ) )
+
+	/*
+	 * Insert pxTCB into pxList after every task whose deadline is not later
+	 * than its own, so tasks with equal deadlines, or without one, keep their
+	 * turns.  vListInsert() cannot be used as absolute deadlines do not sort
+	 * correctly across a tick count overflow.
+	 */
+	static void prvInsertByDeadline( xList * const pxList, tskTCB * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Place the task represented by pxTCB into the appropriate ready list for
+	 * the task, in deadline order.
+	 */
+	#define prvAddTaskToReadyList( pxTCB )																			\
+		traceMOVED_TASK_TO_READY_STATE( pxTCB )																		\
+		taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );															\
+		prvInsertByDeadline( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), ( pxTCB ) )
+
+	/*
+	 * Choose the task to run from the highest priority ready list.  The task at
+	 * the head has the earliest deadline.  If it has no deadline then no task in
+	 * the list has one, and they share the processor in turn as usual.
+	 */
+	#define taskSELECT_FROM_READY_LIST( pxTCB, pxList )															\
+	{																											\
+		if( ( ( tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( pxList ) )->xRelativeDeadline != ( portTickType ) 0 )	\
+		{																										\
+			( pxTCB ) = ( tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( pxList );										\
+		}																										\
+		else																									\
+		{																										\
+			listGET_OWNER_OF_NEXT_ENTRY( ( pxTCB ), ( pxList ) );												\
+		}																										\
+	}
+
+#else
+
+	/*
+	 * Place the task represented by pxTCB into the appropriate ready list for
+	 * the task.  It is inserted at the end of the list.
+	 */
+	#define prvAddTaskToReadyList( pxTCB )																			\
+		traceMOVED_TASK_TO_READY_STATE( pxTCB )																		\
+		taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );															\
+		vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xGenericListItem ) )
+
+	/* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of the
+	same priority get an equal share of the processor time. */
+	#define taskSELECT_FROM_READY_LIST( pxTCB, pxList ) listGET_OWNER_OF_NEXT_ENTRY( ( pxTCB ), ( pxList ) )
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+/*
+ * Read the run time stats clock into ulCount, through whichever of the two
+ * macros the port provides.
+ */
+#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+	#define taskGET_RUN_TIME_COUNTER_VALUE( ulCount )	portALT_GET_RUN_TIME_COUNTER_VALUE( ulCount )
+#else
+	#define taskGET_RUN_TIME_COUNTER_VALUE( ulCount )	( ulCount ) = portGET_RUN_TIME_COUNTER_VALUE()
+#endif
+/*-----------------------------------------------------------*/
+
 /*
- * Place the task represented by pxTCB into the appropriate ready list for
- * the task.  It is inserted at the end of the list.
+ * Called as the task represented by pxTCB leaves the Blocked or Suspended
+ * state.  If a registered interrupt is executing, the task's next switch in
+ * is timed from the interrupt's entry.  Otherwise any earlier wake that did
+ * not lead to the task running is forgotten.
  */
-#define prvAddTaskToReadyList( pxTCB )																				\
-	traceMOVED_TASK_TO_READY_STATE( pxTCB )																			\
-	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );																\
-	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xGenericListItem ) )
+#if ( configRECORD_WAKE_LATENCY == 1 )
+	#define taskRECORD_WAKE_SOURCE( pxTCB )											\
+	{																				\
+		( pxTCB )->pxWakeSource = pxWakeSource;										\
+		if( pxWakeSource != NULL )													\
+		{																			\
+			( pxTCB )->ulWakeTime = pxWakeSource->ulEntryTime;						\
+		}																			\
+	}
+#else
+	#define taskRECORD_WAKE_SOURCE( pxTCB )
+#endif
 /*-----------------------------------------------------------*/
 
 /*
@@ -372,6 +763,33 @@ count overflows. */
  */
 #define prvGetTCBFromHandle( pxHandle ) ( ( ( pxHandle ) == NULL ) ? ( tskTCB * ) pxCurrentTCB : ( tskTCB * ) ( pxHandle ) )
 
+/*
+ * The priority a task returns to when it no longer has an inherited priority.
+ * That is its base priority, or the ceiling of the highest priority ceiling
+ * mutex it holds if that is higher.
+ */
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+	#define taskPRIORITY_FLOOR( pxTCB ) ( ( ( pxTCB )->uxCeilingPriority > ( pxTCB )->uxBasePriority ) ? ( pxTCB )->uxCeilingPriority : ( pxTCB )->uxBasePriority )
+#else
+	#define taskPRIORITY_FLOOR( pxTCB ) ( ( pxTCB )->uxBasePriority )
+#endif
+
+/*
+ * Evaluates to pdTRUE if pxTCB, which has just been placed in a ready list,
+ * should preempt the task running on the calling core.  xEqualPriority says
+ * whether a task of the same priority preempts.  When there is more than one
+ * core the task may instead preempt a lower priority task on another core, in
+ * which case that core is interrupted and the macro evaluates to pdFALSE.
+ */
+#if ( configNUM_CORES == 1 ) && ( configUSE_EDF_SCHEDULING == 1 )
+	/* A task of the same priority also preempts if its deadline is earlier. */
+	#define taskYIELD_FOR_TASK( pxTCB, xEqualPriority ) ( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) || ( ( ( pxTCB )->uxPriority == pxCurrentTCB->uxPriority ) && ( ( ( xEqualPriority ) != pdFALSE ) || ( taskDEADLINE_IS_EARLIER( ( pxTCB ), pxCurrentTCB ) != pdFALSE ) ) ) )
+#elif ( configNUM_CORES == 1 )
+	#define taskYIELD_FOR_TASK( pxTCB, xEqualPriority ) ( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) || ( ( ( xEqualPriority ) != pdFALSE ) && ( ( pxTCB )->uxPriority == pxCurrentTCB->uxPriority ) ) )
+#else
+	#define taskYIELD_FOR_TASK( pxTCB, xEqualPriority ) prvYieldForTask( ( pxTCB ), ( xEqualPriority ) )
+#endif
+
 /* Callback function prototypes. --------------------------*/
 extern void vApplicationStackOverflowHook( xTaskHandle xTask, signed char *pcTaskName );
 extern void vApplicationTickHook( void );
@@ -417,9 +835,38 @@ static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters );
 #endif
 
 /*
- * Used only by the idle task.  This checks to see if anything has been placed
- * in the list of tasks waiting to be deleted.  If so the task is cleaned up
- * and its TCB deleted.
+ * A TCB and stack that were both allocated by the kernel can be kept in a
+ * pool of up to configTASK_POOL_SIZE entries when their task is deleted, and
+ * given to the next task created without buffers of its own whose stack fits.
+ * prvAddToTaskPool() returns pdFALSE if pxTCB cannot be kept, in which case
+ * the memory should be freed.  prvTakeFromTaskPool() returns NULL if no
+ * pooled stack is large enough.
+ */
+#if ( configTASK_POOL_SIZE > 0 )
+
+	static portBASE_TYPE prvAddToTaskPool( tskTCB *pxTCB ) PRIVILEGED_FUNCTION;
+	static tskTCB *prvTakeFromTaskPool( unsigned short usStackDepth ) PRIVILEGED_FUNCTION;
+
+#endif /* configTASK_POOL_SIZE */
+
+/*
+ * A task holding a mutex runs at the highest priority of the tasks blocked on
+ * the mutexes it holds, if that is above its own.  prvGetInheritedPriority()
+ * works out that priority from the task's list of held mutexes.
+ * prvSetInheritedPriority() moves the task to a new priority, keeping its
+ * position in its ready list or in the event list it is blocked on in step.
+ */
+#if ( configUSE_MUTEXES == 1 )
+
+	static unsigned portBASE_TYPE prvGetInheritedPriority( const tskTCB * const pxTCB ) PRIVILEGED_FUNCTION;
+	static void prvSetInheritedPriority( tskTCB * const pxTCB, unsigned portBASE_TYPE uxNewPriority ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MUTEXES */
+
+/*
+ * Used only by the idle task.  Cleans up every task that deleted itself since
+ * the last call.  Tasks deleted by another task are cleaned up within
+ * vTaskDelete() instead, as their stacks are no longer in use.
  */
 static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
 
@@ -427,13 +874,168 @@ static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
  * The currently executing task is entering the Blocked state.  Add the task to
  * either the current or the overflow delayed task list.
  */
-static void prvAddCurrentTaskToDelayedList( portTickType xTimeToWake ) PRIVILEGED_FUNCTION;
+static void prvAddCurrentTaskToDelayedList( tskTickType xTimeToWake ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TIMING_WHEEL == 1 )
+
+	/*
+	 * Place a delayed task's generic list item into the wheel slot that
+	 * corresponds to its wake time (the list item value), relative to the last
+	 * tick processed by the wheel.
+	 */
+	static void prvWheelInsert( xListItem *pxListItem ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Move every task held in pxList back through prvWheelInsert().  Used when
+	 * the tick count reaches the start of a higher level slot.
+	 */
+	static void prvWheelCascade( xList *pxList ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Advance the wheel to xWheelTickCount, unblocking the tasks whose wake time
+	 * is that tick.  Returns pdTRUE if a context switch is required.
+	 */
+	static portBASE_TYPE prvWheelProcessTick( void ) PRIVILEGED_FUNCTION;
+
+	#if ( configUSE_TICKLESS_IDLE != 0 )
+
+		/*
+		 * Return the earliest time at which a task in the wheel could need
+		 * unblocking, or portMAX_DELAY if no tasks are delayed.  This is a scan
+		 * of the wheel so is only used when deciding how long to sleep.
+		 */
+		static portTickType prvWheelNextUnblockTime( void ) PRIVILEGED_FUNCTION;
+
+	#endif
+
+#endif /* configUSE_TIMING_WHEEL */
+
+#if ( configNUM_CORES > 1 )
+
+	/*
+	 * Select the task to run on core xCoreID: the highest priority ready task
+	 * that is not already running on another core.  Tasks of equal priority
+	 * are taken in turn, as listGET_OWNER_OF_NEXT_ENTRY() does for one core.
+	 * Must be called with the kernel lock held.
+	 */
+	static void prvSelectHighestPriorityTask( portBASE_TYPE xCoreID ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * pxTCB has just been made ready.  Find the core running the lowest
+	 * priority task below that of pxTCB (or equal to it, on the calling core
+	 * only, when xEqualPriority is pdTRUE).  Returns pdTRUE if that is the
+	 * calling core, leaving the caller to yield, otherwise interrupts the
+	 * other core with portYIELD_CORE() and returns pdFALSE.  Must be called
+	 * with the kernel lock held.
+	 */
+	static portBASE_TYPE prvYieldForTask( const tskTCB * const pxTCB, portBASE_TYPE xEqualPriority ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Interrupt the core pxTCB is running on, if any other than the calling
+	 * core, so it stops running a task that is no longer able to run or whose
+	 * priority has been lowered.
+	 */
+	static void prvYieldCoreRunningTask( const tskTCB * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configNUM_CORES */
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	/*
+	 * Add the time since ulRunTimeStamp to the total and to the counter being
+	 * charged, then restart the measurement from now.  The difference is taken
+	 * in unsigned long arithmetic so a 32-bit clock may wrap between calls.
+	 * Must be called with interrupts masked.
+	 */
+	static void prvChargeRunTime( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+#if ( configRECORD_SECTION_LATENCY == 1 )
+
+	/*
+	 * Add a section of ulLength clock counts, started from pvCaller, to the
+	 * histogram and longest sections table of pxStats.  Must be called with
+	 * interrupts masked.
+	 */
+	static void prvRecordSectionLatency( xSectionLatencyStats *pxStats, unsigned long ulLength, void *pvCaller ) PRIVILEGED_FUNCTION;
+
+#endif /* configRECORD_SECTION_LATENCY */
+
+#if ( configRECORD_SECTION_LATENCY == 1 ) || ( configRECORD_WAKE_LATENCY == 1 )
+
+	/*
+	 * The log2 histogram bucket a length of ulLength clock counts falls into.
+	 */
+	static unsigned portBASE_TYPE prvLatencyBucket( unsigned long ulLength ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configRECORD_WAKE_LATENCY == 1 )
+
+	/*
+	 * Add the time from the entry of the interrupt that readied pxTCB to now
+	 * to the wake latency statistics of the interrupt.  Called as pxTCB is
+	 * switched in, with interrupts masked.
+	 */
+	static void prvRecordWakeLatency( tskTCB *pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configRECORD_WAKE_LATENCY */
+
+#if ( configUSE_TASK_TIME_SLICES == 1 )
+
+	/*
+	 * Called from the tick interrupt for a task that is running.  Counts the
+	 * tick against the time slice of pxTCB and returns pdTRUE if the slice has
+	 * run out, in which case the task gives way to a ready task of equal
+	 * priority, if there is one.  A slice that has run out stays run out until
+	 * the task is next switched in.
+	 */
+	static portBASE_TYPE prvTimeSliceExpired( tskTCB *pxTCB ) PRIVILEGED_FUNCTION;
+
+	#define taskTIME_SLICE_EXPIRED( pxTCB ) prvTimeSliceExpired( pxTCB )
+
+#else
+
+	/* Without per task time slices every slice is one tick long. */
+	#define taskTIME_SLICE_EXPIRED( pxTCB ) pdTRUE
+
+#endif /* configUSE_TASK_TIME_SLICES */
+
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+
+	/*
+	 * Block the calling task until the high resolution clock reaches
+	 * ulWakeTime.  Whole tick periods are spent in the delayed list as usual,
+	 * and only the remainder of the last period is timed by the high
+	 * resolution alarm.
+	 */
+	static void prvDelayUntilHighRes( unsigned long ulWakeTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Ready every task in xHighResDelayedTaskList whose wake time has passed,
+	 * and set the alarm for the earliest of the rest.  Must be called with
+	 * interrupts masked.  Returns pdTRUE if a task was readied that should
+	 * preempt the running task.
+	 */
+	static portBASE_TYPE prvCheckHighResDelayedTasks( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_HIGH_RES_DELAYS */
 
 /*
  * Allocates memory from the heap for a TCB and associated stack.  Checks the
- * allocation was successful.
+ * allocation was successful.  If pxTaskBuffer is not NULL it is used as the
+ * TCB, and if puxStackBuffer is not NULL it is used as the stack, in place of
+ * heap memory.
+ */
+static tskTCB *prvAllocateTCBAndStack( unsigned short usStackDepth, portSTACK_TYPE *puxStackBuffer, xStaticTask *pxTaskBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Creates a task using the TCB and stack obtained from
+ * prvAllocateTCBAndStack().  Implements both xTaskGenericCreate() and
+ * xTaskCreateStatic().
  */
-static tskTCB *prvAllocateTCBAndStack( unsigned short usStackDepth, portSTACK_TYPE *puxStackBuffer ) PRIVILEGED_FUNCTION;
+static signed portBASE_TYPE prvTaskCreate( pdTASK_CODE pxTaskCode, const signed char * const pcName, unsigned short usStackDepth, void *pvParameters, unsigned portBASE_TYPE uxPriority, xTaskHandle *pxCreatedTask, portSTACK_TYPE *puxStackBuffer, const xMemoryRegion * const xRegions, xStaticTask *pxTaskBuffer ) PRIVILEGED_FUNCTION;
 
 /*
  * Fills an xTaskStatusType structure with information on each task that is
@@ -449,6 +1051,16 @@ static tskTCB *prvAllocateTCBAndStack( unsigned short usStackDepth, portSTACK_TY
 
 #endif
 
+/*
+ * Write one line of the vTaskGetRunTimeStats() table, for a task or for a
+ * registered interrupt, and return the end of the string written.
+ */
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) )
+
+	static signed char *prvWriteRunTimeStatsLine( signed char *pcWriteBuffer, const signed char *pcName, unsigned long long ullRunTime, unsigned long long ullTotalTimeDiv100 ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * When a task is created, the stack of the task is filled with a known value.
  * This function determines the 'high water mark' of the task stack by
@@ -475,17 +1087,82 @@ static tskTCB *prvAllocateTCBAndStack( unsigned short usStackDepth, portSTACK_TY
 
 #endif
 
+/*
+ * Move the calling task out of the Ready state to wait for a notification.
+ * Unlike vTaskPlaceOnEventList() the task is not referenced from any event
+ * list - the notifying task or interrupt finds it through its handle.  Must be
+ * called from within a critical section.
+ */
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	static void prvBlockCurrentTaskOnNotification( portTickType xTicksToWait ) PRIVILEGED_FUNCTION;
+
+#endif
+
 signed portBASE_TYPE xTaskGenericCreate( pdTASK_CODE pxTaskCode, const signed char * const pcName, unsigned short usStackDepth, void *pvParameters, unsigned portBASE_TYPE uxPriority, xTaskHandle *pxCreatedTask, portSTACK_TYPE *puxStackBuffer, const xMemoryRegion * const xRegions )
+{
+	return prvTaskCreate( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, puxStackBuffer, xRegions, NULL );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	xTaskHandle xTaskCreateStatic( pdTASK_CODE pxTaskCode, const signed char * const pcName, unsigned short usStackDepth, void *pvParameters, unsigned portBASE_TYPE uxPriority, portSTACK_TYPE * const puxStackBuffer, xStaticTask * const pxTaskBuffer )
+	{
+	xTaskHandle xReturn = NULL;
+
+		configASSERT( puxStackBuffer != NULL );
+		configASSERT( pxTaskBuffer != NULL );
+
+		/* The xStaticTask structure must be exactly the same size as the TCB
+		it stands in for, otherwise a member has been added to one but not the
+		other. */
+		configASSERT( sizeof( xStaticTask ) == sizeof( tskTCB ) );
+
+		if( ( puxStackBuffer != NULL ) && ( pxTaskBuffer != NULL ) )
+		{
+			( void ) prvTaskCreate( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xReturn, puxStackBuffer, NULL, pxTaskBuffer );
+		}
+
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static signed portBASE_TYPE prvTaskCreate( pdTASK_CODE pxTaskCode, const signed char * const pcName, unsigned short usStackDepth, void *pvParameters, unsigned portBASE_TYPE uxPriority, xTaskHandle *pxCreatedTask, portSTACK_TYPE *puxStackBuffer, const xMemoryRegion * const xRegions, xStaticTask *pxTaskBuffer )
 {
 signed portBASE_TYPE xReturn;
 tskTCB * pxNewTCB;
+#if ( configNUM_CORES > 1 )
+	portBASE_TYPE xYieldRequired = pdFALSE;
+#endif
 
 	configASSERT( pxTaskCode );
 	configASSERT( ( ( uxPriority & ( ~portPRIVILEGE_BIT ) ) < configMAX_PRIORITIES ) );
 
 	/* Allocate the memory required by the TCB and stack for the new task,
-	checking that the allocation was successful. */
-	pxNewTCB = prvAllocateTCBAndStack( usStackDepth, puxStackBuffer );
+	checking that the allocation was successful.  The TCB and stack of a
+	deleted task are reused instead if the application has provided neither. */
+	#if ( configTASK_POOL_SIZE > 0 )
+	{
+		pxNewTCB = NULL;
+
+		if( ( pxTaskBuffer == NULL ) && ( puxStackBuffer == NULL ) )
+		{
+			pxNewTCB = prvTakeFromTaskPool( usStackDepth );
+		}
+
+		if( pxNewTCB == NULL )
+		{
+			pxNewTCB = prvAllocateTCBAndStack( usStackDepth, puxStackBuffer, pxTaskBuffer );
+		}
+	}
+	#else
+	{
+		pxNewTCB = prvAllocateTCBAndStack( usStackDepth, puxStackBuffer, pxTaskBuffer );
+	}
+	#endif /* configTASK_POOL_SIZE */
 
 	if( pxNewTCB != NULL )
 	{
@@ -561,33 +1238,50 @@ tskTCB * pxNewTCB;
 		taskENTER_CRITICAL();
 		{
 			uxCurrentNumberOfTasks++;
-			if( pxCurrentTCB == NULL )
+
+			#if ( configNUM_CORES == 1 )
 			{
-				/* There are no other tasks, or all the other tasks are in
-				the suspended state - make this the current task. */
-				pxCurrentTCB =  pxNewTCB;
+				if( pxCurrentTCB == NULL )
+				{
+					/* There are no other tasks, or all the other tasks are in
+					the suspended state - make this the current task. */
+					pxCurrentTCB =  pxNewTCB;
 
-				if( uxCurrentNumberOfTasks == ( unsigned portBASE_TYPE ) 1 )
+					if( uxCurrentNumberOfTasks == ( unsigned portBASE_TYPE ) 1 )
+					{
+						/* This is the first task to be created so do the preliminary
+						initialisation required.  We will not recover if this call
+						fails, but we will report the failure. */
+						prvInitialiseTaskLists();
+					}
+				}
+				else
 				{
-					/* This is the first task to be created so do the preliminary
-					initialisation required.  We will not recover if this call
-					fails, but we will report the failure. */
-					prvInitialiseTaskLists();
+					/* If the scheduler is not already running, make this task the
+					current task if it is the highest priority task to be created
+					so far. */
+					if( xSchedulerRunning == pdFALSE )
+					{
+						if( pxCurrentTCB->uxPriority <= uxPriority )
+						{
+							pxCurrentTCB = pxNewTCB;
+						}
+					}
 				}
 			}
-			else
+			#else
 			{
-				/* If the scheduler is not already running, make this task the
-				current task if it is the highest priority task to be created
-				so far. */
-				if( xSchedulerRunning == pdFALSE )
+				/* The task each core starts with is chosen by
+				vTaskStartScheduler(), so there is nothing to do here other
+				than initialise the lists on the first call. */
+				pxNewTCB->xTaskRunState = taskTASK_NOT_RUNNING;
+
+				if( uxCurrentNumberOfTasks == ( unsigned portBASE_TYPE ) 1 )
 				{
-					if( pxCurrentTCB->uxPriority <= uxPriority )
-					{
-						pxCurrentTCB = pxNewTCB;
-					}
+					prvInitialiseTaskLists();
 				}
 			}
+			#endif /* configNUM_CORES */
 
 			uxTaskNumber++;
 
@@ -603,6 +1297,18 @@ tskTCB * pxNewTCB;
 
 			xReturn = pdPASS;
 			portSETUP_TCB( pxNewTCB );
+
+			#if ( configNUM_CORES > 1 )
+			{
+				/* The decision has to be made while the kernel lock is held,
+				as the new task can be selected by another core as soon as it
+				is released. */
+				if( xSchedulerRunning != pdFALSE )
+				{
+					xYieldRequired = prvYieldForTask( pxNewTCB, pdFALSE );
+				}
+			}
+			#endif /* configNUM_CORES */
 		}
 		taskEXIT_CRITICAL();
 	}
@@ -614,15 +1320,26 @@ tskTCB * pxNewTCB;
 
 	if( xReturn == pdPASS )
 	{
-		if( xSchedulerRunning != pdFALSE )
+		#if ( configNUM_CORES == 1 )
 		{
-			/* If the created task is of a higher priority than the current task
-			then it should run now. */
-			if( pxCurrentTCB->uxPriority < uxPriority )
+			if( xSchedulerRunning != pdFALSE )
+			{
+				/* If the created task is of a higher priority than the current task
+				then it should run now. */
+				if( pxCurrentTCB->uxPriority < uxPriority )
+				{
+					portYIELD_WITHIN_API();
+				}
+			}
+		}
+		#else
+		{
+			if( xYieldRequired != pdFALSE )
 			{
 				portYIELD_WITHIN_API();
 			}
 		}
+		#endif /* configNUM_CORES */
 	}
 
 	return xReturn;
@@ -634,16 +1351,15 @@ tskTCB * pxNewTCB;
 	void vTaskDelete( xTaskHandle xTaskToDelete )
 	{
 	tskTCB *pxTCB;
+	portBASE_TYPE xDeleteNow;
 
 		taskENTER_CRITICAL();
 		{
 			/* If null is passed in here then we are deleting ourselves. */
 			pxTCB = prvGetTCBFromHandle( xTaskToDelete );
 
-			/* Remove task from the ready list and place in the	termination list.
-			This will stop the task from be scheduled.  The idle task will check
-			the termination list and free up any memory allocated by the
-			scheduler for the TCB and stack. */
+			/* Remove task from the ready list.  This will stop the task from
+			being scheduled. */
 			if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
 			{
 				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
@@ -655,24 +1371,56 @@ tskTCB * pxNewTCB;
 				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
 			}
 
-			vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xGenericListItem ) );
+			/* A task that is not running can be cleaned up by the caller as
+			soon as the critical section is left.  A running task is still
+			using its stack, so it is placed in the termination list for the
+			idle task to clean up once it has been switched out. */
+			#if ( configNUM_CORES > 1 )
+			{
+				xDeleteNow = ( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING ) ? pdTRUE : pdFALSE;
+			}
+			#else
+			{
+				xDeleteNow = ( pxTCB != pxCurrentTCB ) ? pdTRUE : pdFALSE;
+			}
+			#endif /* configNUM_CORES */
+
+			if( xDeleteNow != pdFALSE )
+			{
+				--uxCurrentNumberOfTasks;
+			}
+			else
+			{
+				vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xGenericListItem ) );
 
-			/* Increment the ucTasksDeleted variable so the idle task knows
-			there is a task that has been deleted and that it should therefore
-			check the xTasksWaitingTermination list. */
-			++uxTasksDeleted;
+				/* Increment the ucTasksDeleted variable so the idle task knows
+				there is a task that has been deleted and that it should
+				therefore check the xTasksWaitingTermination list. */
+				++uxTasksDeleted;
+			}
 
 			/* Increment the uxTaskNumberVariable also so kernel aware debuggers
 			can detect that the task lists need re-generating. */
 			uxTaskNumber++;
 
+			#if ( configNUM_CORES > 1 )
+			{
+				/* The task might be running on another core. */
+				prvYieldCoreRunningTask( pxTCB );
+			}
+			#endif /* configNUM_CORES */
+
 			traceTASK_DELETE( pxTCB );
 		}
 		taskEXIT_CRITICAL();
 
-		/* Force a reschedule if we have just deleted the current task. */
-		if( xSchedulerRunning != pdFALSE )
+		if( xDeleteNow != pdFALSE )
 		{
+			prvDeleteTCB( pxTCB );
+		}
+		else if( xSchedulerRunning != pdFALSE )
+		{
+			/* Force a reschedule if we have just deleted the current task. */
 			if( pxTCB == pxCurrentTCB )
 			{
 				portYIELD_WITHIN_API();
@@ -725,6 +1473,33 @@ tskTCB * pxNewTCB;
 				}
 			}
 
+			#if ( configUSE_EDF_SCHEDULING == 1 )
+			{
+				if( pxCurrentTCB->xRelativeDeadline != ( portTickType ) 0 )
+				{
+					/* The job that is ending was released at
+					*pxPreviousWakeTime.  Measuring from there keeps the test
+					correct across a tick count overflow. */
+					if( ( portTickType ) ( xConstTickCount - *pxPreviousWakeTime ) > pxCurrentTCB->xRelativeDeadline )
+					{
+						traceTASK_DEADLINE_MISSED( pxCurrentTCB );
+					}
+
+					/* The next job is released when the task wakes. */
+					pxCurrentTCB->xAbsoluteDeadline = xTimeToWake + pxCurrentTCB->xRelativeDeadline;
+
+					if( xShouldDelay == pdFALSE )
+					{
+						/* The task is late and stays ready, so it has to be
+						moved to its place for the new deadline.  The yield
+						below then lets an earlier deadline run first. */
+						( void ) uxListRemove( &( pxCurrentTCB->xGenericListItem ) );
+						prvAddTaskToReadyList( pxCurrentTCB );
+					}
+				}
+			}
+			#endif /* configUSE_EDF_SCHEDULING */
+
 			/* Update the wake time ready for the next call. */
 			*pxPreviousWakeTime = xTimeToWake;
 
@@ -738,12 +1513,23 @@ tskTCB * pxNewTCB;
 				if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
 				{
 					/* The current task must be in a ready list, so there is
-					no need to check, and the port reset macro can be called
+					no need to check, and the ready priority can be cleared
 					directly. */
-					portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+					taskCLEAR_READY_PRIORITY( pxCurrentTCB->uxPriority );
 				}
 
-				prvAddCurrentTaskToDelayedList( xTimeToWake );
+				#if ( configUSE_64_BIT_TICKS == 1 )
+				{
+					/* The wake time is ahead of the tick count, and the 64
+					bit wake time is the same number of ticks ahead of the 64
+					bit count. */
+					prvAddCurrentTaskToDelayedList( xTickCount + ( portTickType ) ( xTimeToWake - xConstTickCount ) );
+				}
+				#else
+				{
+					prvAddCurrentTaskToDelayedList( xTimeToWake );
+				}
+				#endif /* configUSE_64_BIT_TICKS */
 			}
 		}
 		xAlreadyYielded = xTaskResumeAll();
@@ -763,7 +1549,7 @@ tskTCB * pxNewTCB;
 
 	void vTaskDelay( portTickType xTicksToDelay )
 	{
-	portTickType xTimeToWake;
+	tskTickType xTimeToWake;
 	signed portBASE_TYPE xAlreadyYielded = pdFALSE;
 
 		/* A delay time of zero just forces a reschedule. */
@@ -791,9 +1577,9 @@ tskTCB * pxNewTCB;
 				if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
 				{
 					/* The current task must be in a ready list, so there is
-					no need to check, and the port reset macro can be called
+					no need to check, and the ready priority can be cleared
 					directly. */
-					portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+					taskCLEAR_READY_PRIORITY( pxCurrentTCB->uxPriority );
 				}
 				prvAddCurrentTaskToDelayedList( xTimeToWake );
 			}
@@ -811,6 +1597,197 @@ tskTCB * pxNewTCB;
 #endif /* INCLUDE_vTaskDelay */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+
+	unsigned long ulTaskGetHighResTime( void )
+	{
+		return portGET_HIGH_RES_TIME();
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskDelayHighRes( unsigned long ulMicrosecondsToDelay )
+	{
+		configASSERT( ulMicrosecondsToDelay <= ( tskHIGH_RES_HALF_RANGE / ( unsigned long ) portHIGH_RES_COUNTS_PER_US ) );
+
+		prvDelayUntilHighRes( portGET_HIGH_RES_TIME() + ( ulMicrosecondsToDelay * ( unsigned long ) portHIGH_RES_COUNTS_PER_US ) );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskDelayUntilHighRes( unsigned long * const pulPreviousWakeTime, unsigned long ulMicrosecondIncrement )
+	{
+		configASSERT( pulPreviousWakeTime );
+		configASSERT( ulMicrosecondIncrement <= ( tskHIGH_RES_HALF_RANGE / ( unsigned long ) portHIGH_RES_COUNTS_PER_US ) );
+
+		/* Update the wake time ready for the next call.  If the task is late
+		and the new wake time has already passed it does not block. */
+		*pulPreviousWakeTime += ulMicrosecondIncrement * ( unsigned long ) portHIGH_RES_COUNTS_PER_US;
+		prvDelayUntilHighRes( *pulPreviousWakeTime );
+	}
+	/*-----------------------------------------------------------*/
+
+	portBASE_TYPE xTaskHighResAlarm( void )
+	{
+	portBASE_TYPE xSwitchRequired;
+	unsigned portBASE_TYPE uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			xSwitchRequired = prvCheckHighResDelayedTasks();
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xSwitchRequired;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvDelayUntilHighRes( unsigned long ulWakeTime )
+	{
+	unsigned long ulTimeToWait;
+	portTickType xTicksToDelay;
+	portBASE_TYPE xWaitingForAlarm = pdFALSE, xTimePassed = pdFALSE, xAlreadyYielded;
+
+		while( ( xWaitingForAlarm == pdFALSE ) && ( xTimePassed == pdFALSE ) )
+		{
+			vTaskSuspendAll();
+			{
+				ulTimeToWait = ulWakeTime - portGET_HIGH_RES_TIME();
+
+				if( ( ulTimeToWait == 0UL ) || ( ulTimeToWait > tskHIGH_RES_HALF_RANGE ) )
+				{
+					xTimePassed = pdTRUE;
+				}
+				else
+				{
+					if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
+					{
+						taskCLEAR_READY_PRIORITY( pxCurrentTCB->uxPriority );
+					}
+
+					/* One tick period less than would fit, so the tick wakes
+					the task at least a period early and the alarm always
+					decides the wake time, even if the tick comes late. */
+					ulTimeToWait /= tskHIGH_RES_COUNTS_PER_TICK;
+					if( ulTimeToWait > 0UL )
+					{
+						ulTimeToWait--;
+					}
+					if( ulTimeToWait > ( unsigned long ) ( portMAX_DELAY >> 1 ) )
+					{
+						/* Too far away to reach in one delay.  The loop
+						delays again when the task wakes. */
+						ulTimeToWait = ( unsigned long ) ( portMAX_DELAY >> 1 );
+					}
+					xTicksToDelay = ( portTickType ) ulTimeToWait;
+					traceTASK_DELAY();
+
+					if( xTicksToDelay > ( portTickType ) 0U )
+					{
+						/* The tick that unblocks the task comes at most
+						xTicksToDelay periods from now, so more than a period
+						before the wake time.  The rest of the wait is
+						measured again when the task runs. */
+						prvAddCurrentTaskToDelayedList( xTickCount + xTicksToDelay );
+					}
+					else
+					{
+						/* The list is also used by the alarm interrupt, which
+						runs while the scheduler is suspended. */
+						taskENTER_CRITICAL();
+						{
+							pxCurrentTCB->ulHighResWakeTime = ulWakeTime;
+							vListInsertEnd( &xHighResDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+
+							/* Sets the alarm for this task if it is the first
+							due, or pends it if the wake time has passed in the
+							meantime.  Tasks readied now are not switched to
+							until the scheduler is resumed. */
+							( void ) prvCheckHighResDelayedTasks();
+						}
+						taskEXIT_CRITICAL();
+
+						xWaitingForAlarm = pdTRUE;
+					}
+				}
+			}
+			xAlreadyYielded = xTaskResumeAll();
+
+			/* Force a reschedule if xTaskResumeAll has not already done so,
+			we may have put ourselves to sleep. */
+			if( xAlreadyYielded == pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static portBASE_TYPE prvCheckHighResDelayedTasks( void )
+	{
+	const unsigned long ulNow = portGET_HIGH_RES_TIME();
+	unsigned long ulTimeToWait, ulShortestWait = tskHIGH_RES_HALF_RANGE;
+	xListItem *pxItem, *pxNextItem;
+	tskTCB *pxTCB;
+	portBASE_TYPE xSwitchRequired = pdFALSE, xAlarmNeeded = pdFALSE;
+
+		/* The list only holds tasks that are due within two tick periods, so
+		it is short and is searched in full. */
+		pxItem = ( xListItem * ) xHighResDelayedTaskList.xListEnd.pxNext;
+		while( pxItem != ( xListItem * ) &( xHighResDelayedTaskList.xListEnd ) ) /*lint !e826 !e740 The mini list end is only compared, not dereferenced as a list item. */
+		{
+			pxNextItem = pxItem->pxNext;
+			pxTCB = ( tskTCB * ) listGET_LIST_ITEM_OWNER( pxItem );
+			ulTimeToWait = pxTCB->ulHighResWakeTime - ulNow;
+
+			if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) != pdFALSE )
+			{
+				/* Already readied while the scheduler is suspended.
+				xTaskResumeAll() removes it from this list. */
+			}
+			else if( ( ulTimeToWait == 0UL ) || ( ulTimeToWait > tskHIGH_RES_HALF_RANGE ) )
+			{
+				taskRECORD_WAKE_SOURCE( pxTCB );
+
+				if( uxSchedulerSuspended == ( unsigned portBASE_TYPE ) pdFALSE )
+				{
+					( void ) uxListRemove( pxItem );
+					prvAddTaskToReadyList( pxTCB );
+
+					if( taskYIELD_FOR_TASK( pxTCB, pdTRUE ) != pdFALSE )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+				}
+				else
+				{
+					/* As in xTaskResumeFromISR(), the ready lists cannot be
+					accessed, so the task is held pending until the scheduler
+					is resumed. */
+					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+				}
+			}
+			else
+			{
+				if( ulTimeToWait < ulShortestWait )
+				{
+					ulShortestWait = ulTimeToWait;
+				}
+				xAlarmNeeded = pdTRUE;
+			}
+
+			pxItem = pxNextItem;
+		}
+
+		if( xAlarmNeeded != pdFALSE )
+		{
+			portSET_HIGH_RES_ALARM( ulNow + ulShortestWait );
+		}
+
+		return xSwitchRequired;
+	}
+
+#endif /* configUSE_HIGH_RES_DELAYS */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_eTaskGetState == 1 )
 
 	eTaskState eTaskGetState( xTaskHandle xTask )
@@ -819,11 +1796,19 @@ tskTCB * pxNewTCB;
 	xList *pxStateList;
 	const tskTCB * const pxTCB = ( tskTCB * ) xTask;
 
+		#if ( configNUM_CORES > 1 )
+		if( pxTCB->xTaskRunState != taskTASK_NOT_RUNNING )
+		{
+			/* The task is the calling task, or is running on another core. */
+			eReturn = eRunning;
+		}
+		#else
 		if( pxTCB == pxCurrentTCB )
 		{
 			/* The task calling this function is querying its own state. */
 			eReturn = eRunning;
 		}
+		#endif /* configNUM_CORES */
 		else
 		{
 			taskENTER_CRITICAL();
@@ -832,13 +1817,21 @@ tskTCB * pxNewTCB;
 			}
 			taskEXIT_CRITICAL();
 
-			if( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) )
+			if( taskLIST_IS_DELAYED_LIST( pxStateList ) )
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
 				eReturn = eBlocked;
 			}
 
+			#if ( configUSE_HIGH_RES_DELAYS == 1 )
+				else if( pxStateList == &xHighResDelayedTaskList )
+				{
+					/* The task is waiting for the high resolution alarm. */
+					eReturn = eBlocked;
+				}
+			#endif
+
 			#if ( INCLUDE_vTaskSuspend == 1 )
 				else if( pxStateList == &xSuspendedTaskList )
 				{
@@ -931,6 +1924,25 @@ tskTCB * pxNewTCB;
 			{
 				/* The priority change may have readied a task of higher
 				priority than the calling task. */
+				#if ( configNUM_CORES > 1 )
+				{
+					/* Any task that is running, on whichever core, has to
+					reschedule if its priority is lowered.  A ready task whose
+					priority is raised is checked against every core once it
+					is in its new ready list, below. */
+					if( uxNewPriority < uxCurrentBasePriority )
+					{
+						if( pxTCB->xTaskRunState == portGET_CORE_ID() )
+						{
+							xYieldRequired = pdTRUE;
+						}
+						else
+						{
+							prvYieldCoreRunningTask( pxTCB );
+						}
+					}
+				}
+				#else
 				if( uxNewPriority > uxCurrentBasePriority )
 				{
 					if( pxTCB != pxCurrentTCB )
@@ -963,6 +1975,7 @@ tskTCB * pxNewTCB;
 					require a yield as the running task must be above the
 					new priority of the task being modified. */
 				}
+				#endif /* configNUM_CORES */
 
 				/* Remember the ready list the task might be referenced from
 				before its uxPriority member is changed so the
@@ -971,15 +1984,11 @@ tskTCB * pxNewTCB;
 
 				#if ( configUSE_MUTEXES == 1 )
 				{
-					/* Only change the priority being used if the task is not
-					currently using an inherited priority. */
-					if( pxTCB->uxBasePriority == pxTCB->uxPriority )
-					{
-						pxTCB->uxPriority = uxNewPriority;
-					}
-
-					/* The base priority gets set whatever. */
+					/* The base priority gets set whatever.  The priority in
+					use does not drop below one inherited from the mutexes the
+					task holds. */
 					pxTCB->uxBasePriority = uxNewPriority;
+					pxTCB->uxPriority = prvGetInheritedPriority( pxTCB );
 				}
 				#else
 				{
@@ -987,7 +1996,12 @@ tskTCB * pxNewTCB;
 				}
 				#endif
 
-				listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( portTickType ) configMAX_PRIORITIES - ( portTickType ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				/* Only reset the event list item value if the value is not
+				being used for anything else. */
+				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+				{
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( portTickType ) configMAX_PRIORITIES - ( portTickType ) pxTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				}
 
 				/* If the task is in the blocked or suspended list we need do
 				nothing more than change it's priority variable. However, if
@@ -1001,11 +2015,23 @@ tskTCB * pxNewTCB;
 					if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
 					{
 						/* It is known that the task is in its ready list so
-						there is no need to check again and the port level
-						reset macro can be called directly. */
-						portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+						there is no need to check again and the ready priority
+						can be cleared directly. */
+						taskCLEAR_READY_PRIORITY( uxPriorityUsedOnEntry );
 					}
 					prvAddTaskToReadyList( pxTCB );
+
+					#if ( configNUM_CORES > 1 )
+					{
+						if( uxNewPriority > uxCurrentBasePriority )
+						{
+							if( prvYieldForTask( pxTCB, pdTRUE ) != pdFALSE )
+							{
+								xYieldRequired = pdTRUE;
+							}
+						}
+					}
+					#endif /* configNUM_CORES */
 				}
 
 				if( xYieldRequired == pdTRUE )
@@ -1024,106 +2050,302 @@ tskTCB * pxNewTCB;
 #endif /* INCLUDE_vTaskPrioritySet */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if ( configUSE_EDF_SCHEDULING == 1 )
 
-	void vTaskSuspend( xTaskHandle xTaskToSuspend )
+	void vTaskSetDeadline( xTaskHandle xTask, portTickType xRelativeDeadline )
 	{
 	tskTCB *pxTCB;
+	portBASE_TYPE xYieldRequired = pdFALSE;
+
+		/* Deadlines are compared by the time left until them, which only
+		works for deadlines less than half the tick range away. */
+		configASSERT( xRelativeDeadline <= ( portMAX_DELAY >> 1 ) );
 
 		taskENTER_CRITICAL();
 		{
-			/* If null is passed in here then it is the running task that is
-			being suspended. */
-			pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+			/* If null is passed in here then the deadline of the calling task
+			is being set. */
+			pxTCB = prvGetTCBFromHandle( xTask );
 
-			traceTASK_SUSPEND( pxTCB );
+			/* The current job is taken to have been released now.  Later jobs
+			are released by vTaskDelayUntil(). */
+			pxTCB->xRelativeDeadline = xRelativeDeadline;
+			pxTCB->xAbsoluteDeadline = xTickCount + xRelativeDeadline;
 
-			/* Remove task from the ready/delayed list and place in the	suspended list. */
-			if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
+			/* A ready task has to be moved to its place for the new deadline. */
+			if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
 			{
-				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-			}
+				( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+				prvAddTaskToReadyList( pxTCB );
 
-			/* Is the task waiting on an event also? */
-			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-			{
-				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				if( xSchedulerRunning != pdFALSE )
+				{
+					if( pxTCB == pxCurrentTCB )
+					{
+						/* The calling task's deadline may now be later than
+						that of another ready task. */
+						xYieldRequired = pdTRUE;
+					}
+					else
+					{
+						xYieldRequired = taskYIELD_FOR_TASK( pxTCB, pdFALSE );
+					}
+				}
 			}
 
-			vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xGenericListItem ) );
-		}
-		taskEXIT_CRITICAL();
-
-		if( pxTCB == pxCurrentTCB )
-		{
-			if( xSchedulerRunning != pdFALSE )
+			if( xYieldRequired != pdFALSE )
 			{
-				/* The current task has just been suspended. */
 				portYIELD_WITHIN_API();
 			}
-			else
-			{
-				/* The scheduler is not running, but the task that was pointed
-				to by pxCurrentTCB has just been suspended and pxCurrentTCB
-				must be adjusted to point to a different task. */
-				if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks )
-				{
-					/* No other tasks are ready, so set pxCurrentTCB back to
-					NULL so when the next task is created pxCurrentTCB will
-					be set to point to it no matter what its relative priority
-					is. */
-					pxCurrentTCB = NULL;
-				}
-				else
-				{
-					vTaskSwitchContext();
-				}
-			}
 		}
+		taskEXIT_CRITICAL();
 	}
 
-#endif /* INCLUDE_vTaskSuspend */
+#endif /* configUSE_EDF_SCHEDULING */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if ( configUSE_EDF_SCHEDULING == 1 )
 
-	signed portBASE_TYPE xTaskIsTaskSuspended( xTaskHandle xTask )
+	static void prvInsertByDeadline( xList * const pxList, tskTCB * const pxTCB )
 	{
-	portBASE_TYPE xReturn = pdFALSE;
-	const tskTCB * const pxTCB = ( tskTCB * ) xTask;
+	xListItem * const pxNewListItem = &( pxTCB->xGenericListItem );
+	xListItem *pxIterator;
 
-		/* It does not make sense to check if the calling task is suspended. */
-		configASSERT( xTask );
+		listSET_LIST_ITEM_VALUE( pxNewListItem, taskDEADLINE_KEY( pxTCB ) );
 
-		/* Is the task we are attempting to resume actually in the
-		suspended list? */
-		if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xGenericListItem ) ) != pdFALSE )
+		/* Find the last task that does not come after pxTCB. */
+		pxIterator = ( xListItem * ) &( pxList->xListEnd ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+		while( pxIterator->pxNext != ( xListItem * ) &( pxList->xListEnd ) ) /*lint !e826 !e740 The mini list end is only compared, not dereferenced as a list item. */
 		{
-			/* Has the task already been resumed from within an ISR? */
-			if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
+			if( taskDEADLINE_IS_EARLIER( pxTCB, ( tskTCB * ) listGET_LIST_ITEM_OWNER( pxIterator->pxNext ) ) != pdFALSE )
 			{
-				/* Is it in the suspended list because it is in the
-				Suspended state?  It is possible to be in the suspended
-				list because it is blocked on a task with no timeout
-				specified. */
-				if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE )
-				{
-					xReturn = pdTRUE;
-				}
+				break;
 			}
+
+			pxIterator = pxIterator->pxNext;
 		}
 
-		return xReturn;
-	} /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+		/* Link the item in as vListInsert() does. */
+		pxNewListItem->pxNext = pxIterator->pxNext;
+		pxNewListItem->pxNext->pxPrevious = pxNewListItem;
+		pxNewListItem->pxPrevious = pxIterator;
+		pxIterator->pxNext = pxNewListItem;
+		pxNewListItem->pvContainer = ( void * ) pxList;
+		( pxList->uxNumberOfItems )++;
+	}
 
-#endif /* INCLUDE_vTaskSuspend */
+#endif /* configUSE_EDF_SCHEDULING */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if ( configUSE_EDF_SCHEDULING == 1 )
 
-	void vTaskResume( xTaskHandle xTaskToResume )
+	portTickType xTaskGetDeadline( xTaskHandle xTask )
 	{
-	tskTCB * const pxTCB = ( tskTCB * ) xTaskToResume;
+	tskTCB *pxTCB;
+	portTickType xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( xTask );
+			xReturn = taskDEADLINE_KEY( pxTCB );
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_TIME_SLICES == 1 )
+
+	void vTaskSetTimeSlice( xTaskHandle xTask, portTickType xTimeSliceTicks )
+	{
+	tskTCB *pxTCB;
+
+		configASSERT( xTimeSliceTicks > ( portTickType ) 0 );
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then the time slice of the calling
+			task is being set. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			pxTCB->xTimeSlice = xTimeSliceTicks;
+
+			/* The new length applies from the next time the task is switched
+			in, but a slice already longer than the new one is cut short. */
+			if( pxTCB->xTimeSliceLeft > xTimeSliceTicks )
+			{
+				pxTCB->xTimeSliceLeft = xTimeSliceTicks;
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	portTickType xTaskGetTimeSlice( xTaskHandle xTask )
+	{
+	tskTCB *pxTCB;
+
+		/* The slice length is a single word so no critical section is
+		needed. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+		return pxTCB->xTimeSlice;
+	}
+	/*-----------------------------------------------------------*/
+
+	static portBASE_TYPE prvTimeSliceExpired( tskTCB *pxTCB )
+	{
+	portBASE_TYPE xReturn;
+
+		if( pxTCB->xTimeSliceLeft > ( portTickType ) 1 )
+		{
+			( pxTCB->xTimeSliceLeft )--;
+			xReturn = pdFALSE;
+		}
+		else
+		{
+			xReturn = pdTRUE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_TIME_SLICES */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+	void vTaskSuspend( xTaskHandle xTaskToSuspend )
+	{
+	tskTCB *pxTCB;
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the running task that is
+			being suspended. */
+			pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+
+			traceTASK_SUSPEND( pxTCB );
+
+			/* Remove task from the ready/delayed list and place in the	suspended list. */
+			if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
+			{
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+			}
+
+			/* Is the task waiting on an event also? */
+			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+			{
+				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+			}
+
+			#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+			{
+				/* A task suspended while waiting for a notification is no
+				longer waiting - a later notification must not ready it. */
+				if( pxTCB->eNotifyState == eWaitingNotification )
+				{
+					pxTCB->eNotifyState = eNotWaitingNotification;
+				}
+			}
+			#endif /* configUSE_TASK_NOTIFICATIONS */
+
+			vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xGenericListItem ) );
+
+			#if ( configNUM_CORES > 1 )
+			{
+				/* The task might be running on another core. */
+				prvYieldCoreRunningTask( pxTCB );
+			}
+			#endif /* configNUM_CORES */
+		}
+		taskEXIT_CRITICAL();
+
+		if( pxTCB == pxCurrentTCB )
+		{
+			if( xSchedulerRunning != pdFALSE )
+			{
+				/* The current task has just been suspended. */
+				portYIELD_WITHIN_API();
+			}
+			#if ( configNUM_CORES == 1 )
+			else
+			{
+				/* The scheduler is not running, but the task that was pointed
+				to by pxCurrentTCB has just been suspended and pxCurrentTCB
+				must be adjusted to point to a different task. */
+				if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks )
+				{
+					/* No other tasks are ready, so set pxCurrentTCB back to
+					NULL so when the next task is created pxCurrentTCB will
+					be set to point to it no matter what its relative priority
+					is. */
+					pxCurrentTCB = NULL;
+				}
+				else
+				{
+					vTaskSwitchContext();
+				}
+			}
+			#endif /* configNUM_CORES */
+		}
+	}
+
+#endif /* INCLUDE_vTaskSuspend */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+	signed portBASE_TYPE xTaskIsTaskSuspended( xTaskHandle xTask )
+	{
+	portBASE_TYPE xReturn = pdFALSE;
+	const tskTCB * const pxTCB = ( tskTCB * ) xTask;
+
+		/* It does not make sense to check if the calling task is suspended. */
+		configASSERT( xTask );
+
+		/* Is the task we are attempting to resume actually in the
+		suspended list? */
+		if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xGenericListItem ) ) != pdFALSE )
+		{
+			/* Has the task already been resumed from within an ISR? */
+			if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
+			{
+				/* Is it in the suspended list because it is in the
+				Suspended state?  It is possible to be in the suspended
+				list because it is blocked on a task with no timeout
+				specified. */
+				if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+
+					#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+					{
+						/* A task waiting indefinitely for a notification is
+						held in the suspended list but is not referenced from
+						an event list either. */
+						if( pxTCB->eNotifyState == eWaitingNotification )
+						{
+							xReturn = pdFALSE;
+						}
+					}
+					#endif /* configUSE_TASK_NOTIFICATIONS */
+				}
+			}
+		}
+
+		return xReturn;
+	} /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+
+#endif /* INCLUDE_vTaskSuspend */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+	void vTaskResume( xTaskHandle xTaskToResume )
+	{
+	tskTCB * const pxTCB = ( tskTCB * ) xTaskToResume;
 
 		/* It does not make sense to resume the calling task. */
 		configASSERT( xTaskToResume );
@@ -1137,6 +2359,7 @@ tskTCB * pxNewTCB;
 				if( xTaskIsTaskSuspended( pxTCB ) == pdTRUE )
 				{
 					traceTASK_RESUME( pxTCB );
+					taskRECORD_WAKE_SOURCE( pxTCB );
 
 					/* As we are in a critical section we can access the ready
 					lists even if the scheduler is suspended. */
@@ -1144,7 +2367,7 @@ tskTCB * pxNewTCB;
 					prvAddTaskToReadyList( pxTCB );
 
 					/* We may have just resumed a higher priority task. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskYIELD_FOR_TASK( pxTCB, pdTRUE ) != pdFALSE )
 					{
 						/* This yield may not cause the task just resumed to run, but
 						will leave the lists in the correct state for the next yield. */
@@ -1193,12 +2416,13 @@ tskTCB * pxNewTCB;
 			if( xTaskIsTaskSuspended( pxTCB ) == pdTRUE )
 			{
 				traceTASK_RESUME_FROM_ISR( pxTCB );
+				taskRECORD_WAKE_SOURCE( pxTCB );
 
 				if( uxSchedulerSuspended == ( unsigned portBASE_TYPE ) pdFALSE )
 				{
-					xYieldRequired = ( pxTCB->uxPriority >= pxCurrentTCB->uxPriority );
 					( void ) uxListRemove(  &( pxTCB->xGenericListItem ) );
 					prvAddTaskToReadyList( pxTCB );
+					xYieldRequired = taskYIELD_FOR_TASK( pxTCB, pdTRUE );
 				}
 				else
 				{
@@ -1222,7 +2446,34 @@ void vTaskStartScheduler( void )
 portBASE_TYPE xReturn;
 
 	/* Add the idle task at the lowest priority. */
-	#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+	xStaticTask *pxIdleTaskTCBBuffer = NULL;
+	portSTACK_TYPE *pxIdleTaskStackBuffer = NULL;
+	unsigned short usIdleTaskStackSize = tskIDLE_STACK_SIZE;
+	xTaskHandle xIdleHandle;
+
+		/* The Idle task is created using memory provided by the application,
+		so that an application that only uses static allocation does not need
+		a heap at all. */
+		vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &usIdleTaskStackSize );
+		xIdleHandle = xTaskCreateStatic( prvIdleTask, ( signed char * ) "IDLE", usIdleTaskStackSize, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), pxIdleTaskStackBuffer, pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+		if( xIdleHandle != NULL )
+		{
+			#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+			{
+				xIdleTaskHandle = xIdleHandle;
+			}
+			#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	#elif ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 	{
 		/* Create the idle task, storing its handle in xIdleTaskHandle so it can
 		be returned by the xTaskGetIdleTaskHandle() function. */
@@ -1233,7 +2484,31 @@ portBASE_TYPE xReturn;
 		/* Create the idle task without storing its handle. */
 		xReturn = xTaskCreate( prvIdleTask, ( signed char * ) "IDLE", tskIDLE_STACK_SIZE, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), NULL );  /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
 	}
-	#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+	#if ( configNUM_CORES > 1 )
+	{
+	portBASE_TYPE xCoreID;
+
+		/* Each core must always have a task it can run, so there is one idle
+		task per core.  Any of them can run on any core. */
+		for( xCoreID = 1; ( xCoreID < ( portBASE_TYPE ) configNUM_CORES ) && ( xReturn == pdPASS ); xCoreID++ )
+		{
+			#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				if( xTaskCreateStatic( prvIdleTask, ( signed char * ) "IDLE", tskIDLE_STACK_SIZE, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), uxCoreIdleTaskStacks[ xCoreID - 1 ], &( xCoreIdleTaskTCBs[ xCoreID - 1 ] ) ) == NULL ) /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+				{
+					xReturn = pdFAIL;
+				}
+			}
+			#else
+			{
+				xReturn = xTaskCreate( prvIdleTask, ( signed char * ) "IDLE", tskIDLE_STACK_SIZE, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), NULL ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+		}
+	}
+	#endif /* configNUM_CORES */
 
 	#if ( configUSE_TIMERS == 1 )
 	{
@@ -1257,13 +2532,33 @@ portBASE_TYPE xReturn;
 		portDISABLE_INTERRUPTS();
 
 		xSchedulerRunning = pdTRUE;
-		xTickCount = ( portTickType ) 0U;
+		xTickCount = ( tskTickType ) configINITIAL_TICK_COUNT;
+
+		#if ( configNUM_CORES > 1 )
+		{
+		portBASE_TYPE xCoreID;
+
+			/* Choose the task each core starts with. */
+			for( xCoreID = 0; xCoreID < ( portBASE_TYPE ) configNUM_CORES; xCoreID++ )
+			{
+				prvSelectHighestPriorityTask( xCoreID );
+			}
+		}
+		#endif /* configNUM_CORES */
 
 		/* If configGENERATE_RUN_TIME_STATS is defined then the following
 		macro must be defined to configure the timer/counter used to generate
 		the run time counter time base. */
 		portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
 
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			/* Time is charged to the first task from here. */
+			taskGET_RUN_TIME_COUNTER_VALUE( ulRunTimeStamp );
+			pullRunTimeCounterCharged = &( pxCurrentTCB->ullRunTimeCounter );
+		}
+		#endif /* configGENERATE_RUN_TIME_STATS */
+
 		/* Setting up the timer tick is hardware specific and thus in the
 		portable interface. */
 		if( xPortStartScheduler() != pdFALSE )
@@ -1299,9 +2594,48 @@ void vTaskEndScheduler( void )
 
 void vTaskSuspendAll( void )
 {
-	/* A critical section is not required as the variable is of type
-	portBASE_TYPE. */
-	++uxSchedulerSuspended;
+	#if ( ( configNUM_CORES > 1 ) || ( configRECORD_SECTION_LATENCY == 1 ) )
+	{
+	unsigned portBASE_TYPE uxSavedInterruptStatus;
+
+		/* Interrupts are masked directly, rather than with a critical
+		section, so that they are only masked while the count is changed.
+		With configRECORD_SECTION_LATENCY that also keeps timing the scheduler
+		lock from appearing as a critical section. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			#if ( configNUM_CORES > 1 )
+			{
+				/* Suspending the scheduler only stops the calling core
+				switching tasks.  The other cores are kept out of the kernel
+				by holding the kernel lock until the matching xTaskResumeAll(),
+				but interrupts are unmasked again: an interrupt on this core
+				takes the lock recursively and finds the scheduler suspended,
+				as it would with one core. */
+				portGET_KERNEL_LOCK();
+			}
+			#endif /* configNUM_CORES */
+
+			#if ( configRECORD_SECTION_LATENCY == 1 )
+			{
+				if( ( uxSchedulerSuspended == ( unsigned portBASE_TYPE ) pdFALSE ) && ( xSchedulerRunning != pdFALSE ) )
+				{
+					vTaskSectionLatencyStart( eLatencySchedulerSuspended, portRETURN_ADDRESS() );
+				}
+			}
+			#endif /* configRECORD_SECTION_LATENCY */
+
+			++uxSchedulerSuspended;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	#else
+	{
+		/* A critical section is not required as the variable is of type
+		portBASE_TYPE. */
+		++uxSchedulerSuspended;
+	}
+	#endif /* configNUM_CORES, configRECORD_SECTION_LATENCY */
 }
 /*----------------------------------------------------------*/
 
@@ -1324,7 +2658,32 @@ void vTaskSuspendAll( void )
 		}
 		else
 		{
-			xReturn = xNextTaskUnblockTime - xTickCount;
+			#if ( configUSE_TIMING_WHEEL == 1 )
+			{
+				/* The wheel does not track the next unblock time as tasks
+				expire, so work it out now. */
+				xNextTaskUnblockTime = prvWheelNextUnblockTime();
+			}
+			#endif /* configUSE_TIMING_WHEEL */
+
+			#if ( configUSE_64_BIT_TICKS == 1 )
+			{
+				/* With no task delayed the unblock time is far beyond the
+				range of portTickType. */
+				if( ( xNextTaskUnblockTime - xTickCount ) > ( tskTickType ) portMAX_DELAY )
+				{
+					xReturn = portMAX_DELAY;
+				}
+				else
+				{
+					xReturn = ( portTickType ) ( xNextTaskUnblockTime - xTickCount );
+				}
+			}
+			#else
+			{
+				xReturn = xNextTaskUnblockTime - xTickCount;
+			}
+			#endif /* configUSE_64_BIT_TICKS */
 		}
 
 		return xReturn;
@@ -1352,8 +2711,23 @@ portBASE_TYPE xYieldRequired = pdFALSE;
 	{
 		--uxSchedulerSuspended;
 
+		#if ( configNUM_CORES > 1 )
+		{
+			/* Release the kernel lock taken by vTaskSuspendAll().  The
+			critical section still holds it, and releases it once the pending
+			ready tasks and ticks have been processed. */
+			portRELEASE_KERNEL_LOCK();
+		}
+		#endif /* configNUM_CORES */
+
 		if( uxSchedulerSuspended == ( unsigned portBASE_TYPE ) pdFALSE )
 		{
+			#if ( configRECORD_SECTION_LATENCY == 1 )
+			{
+				vTaskSectionLatencyEnd( eLatencySchedulerSuspended );
+			}
+			#endif /* configRECORD_SECTION_LATENCY */
+
 			if( uxCurrentNumberOfTasks > ( unsigned portBASE_TYPE ) 0U )
 			{
 				/* Move any readied tasks from the pending list into the
@@ -1367,7 +2741,7 @@ portBASE_TYPE xYieldRequired = pdFALSE;
 
 					/* If we have moved a task that has a priority higher than
 					the current task then we should yield. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskYIELD_FOR_TASK( pxTCB, pdTRUE ) != pdFALSE )
 					{
 						xYieldRequired = pdTRUE;
 					}
@@ -1447,32 +2821,70 @@ unsigned portBASE_TYPE uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
-unsigned portBASE_TYPE uxTaskGetNumberOfTasks( void )
-{
-	/* A critical section is not required because the variables are of type
-	portBASE_TYPE. */
-	return uxCurrentNumberOfTasks;
-}
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_pcTaskGetTaskName == 1 )
+#if ( configUSE_64_BIT_TICKS == 1 )
 
-	signed char *pcTaskGetTaskName( xTaskHandle xTaskToQuery )
+	portTick64Type xTaskGetTickCount64( void )
 	{
-	tskTCB *pxTCB;
-
-		/* If null is passed in here then the name of the calling task is being queried. */
-		pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-		configASSERT( pxTCB );
-		return &( pxTCB->pcTaskName[ 0 ] );
-	}
+	portTick64Type xTicks;
 
-#endif /* INCLUDE_pcTaskGetTaskName */
+		/* Critical section required as the count is wider than the word size
+		of the processor. */
+		taskENTER_CRITICAL();
+		{
+			xTicks = xTickCount;
+		}
+		taskEXIT_CRITICAL();
+
+		return xTicks;
+	}
+	/*-----------------------------------------------------------*/
+
+	portTick64Type xTaskGetTickCount64FromISR( void )
+	{
+	portTick64Type xReturn;
+	unsigned portBASE_TYPE uxSavedInterruptStatus;
+
+		/* See the comments in xTaskGetTickCountFromISR(). */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		/* Masking the interrupts that can use the API also masks the tick
+		interrupt, so the count cannot change part way through the read. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		xReturn = xTickCount;
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_64_BIT_TICKS */
+/*-----------------------------------------------------------*/
+
+unsigned portBASE_TYPE uxTaskGetNumberOfTasks( void )
+{
+	/* A critical section is not required because the variables are of type
+	portBASE_TYPE. */
+	return uxCurrentNumberOfTasks;
+}
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_pcTaskGetTaskName == 1 )
+
+	signed char *pcTaskGetTaskName( xTaskHandle xTaskToQuery )
+	{
+	tskTCB *pxTCB;
+
+		/* If null is passed in here then the name of the calling task is being queried. */
+		pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+		configASSERT( pxTCB );
+		return &( pxTCB->pcTaskName[ 0 ] );
+	}
+
+#endif /* INCLUDE_pcTaskGetTaskName */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TRACE_FACILITY == 1 )
 
-	unsigned portBASE_TYPE uxTaskGetSystemState( xTaskStatusType *pxTaskStatusArray, unsigned portBASE_TYPE uxArraySize, unsigned long *pulTotalRunTime )
+	unsigned portBASE_TYPE uxTaskGetSystemState( xTaskStatusType *pxTaskStatusArray, unsigned portBASE_TYPE uxArraySize, unsigned long long *pullTotalRunTime )
 	{
 	unsigned portBASE_TYPE uxTask = 0, uxQueue = configMAX_PRIORITIES;
 
@@ -1492,8 +2904,38 @@ unsigned portBASE_TYPE uxTaskGetNumberOfTasks( void )
 
 				/* Fill in an xTaskStatusType structure with information on each
 				task in the Blocked state. */
-				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( xList * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( xList * ) pxOverflowDelayedTaskList, eBlocked );
+				#if ( configUSE_TIMING_WHEEL == 1 )
+				{
+				unsigned portBASE_TYPE uxLevel;
+				portTickType xSlot;
+
+					for( uxLevel = 0; uxLevel < ( unsigned portBASE_TYPE ) configTIMING_WHEEL_LEVELS; uxLevel++ )
+					{
+						for( xSlot = 0; xSlot < tskWHEEL_SLOTS; xSlot++ )
+						{
+							uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheel[ uxLevel ][ xSlot ] ), eBlocked );
+						}
+					}
+
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xDelayedTaskFarList, eBlocked );
+				}
+				#else
+				{
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( xList * ) pxDelayedTaskList, eBlocked );
+
+					#if ( configUSE_64_BIT_TICKS == 0 )
+					{
+						uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( xList * ) pxOverflowDelayedTaskList, eBlocked );
+					}
+					#endif /* configUSE_64_BIT_TICKS */
+				}
+				#endif /* configUSE_TIMING_WHEEL */
+
+				#if ( configUSE_HIGH_RES_DELAYS == 1 )
+				{
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xHighResDelayedTaskList, eBlocked );
+				}
+				#endif /* configUSE_HIGH_RES_DELAYS */
 
 				#if( INCLUDE_vTaskDelete == 1 )
 				{
@@ -1513,16 +2955,21 @@ unsigned portBASE_TYPE uxTaskGetNumberOfTasks( void )
 
 				#if ( configGENERATE_RUN_TIME_STATS == 1)
 				{
-					if( pulTotalRunTime != NULL )
+					if( pullTotalRunTime != NULL )
 					{
-						*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+						taskENTER_CRITICAL();
+						{
+							prvChargeRunTime();
+							*pullTotalRunTime = ullTotalRunTime;
+						}
+						taskEXIT_CRITICAL();
 					}
 				}
 				#else
 				{
-					if( pulTotalRunTime != NULL )
+					if( pullTotalRunTime != NULL )
 					{
-						*pulTotalRunTime = 0;
+						*pullTotalRunTime = 0;
 					}
 				}
 				#endif
@@ -1570,8 +3017,6 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 
 portBASE_TYPE xTaskIncrementTick( void )
 {
-tskTCB * pxTCB;
-portTickType xItemValue;
 portBASE_TYPE xSwitchRequired = pdFALSE;
 
 	/* Called by the portable layer each time a tick interrupt occurs.
@@ -1587,90 +3032,165 @@ portBASE_TYPE xSwitchRequired = pdFALSE;
 		{
 			/* Minor optimisation.  The tick count cannot change in this
 			block. */
-			const portTickType xConstTickCount = xTickCount;
+			const tskTickType xConstTickCount = xTickCount;
 
-			if( xConstTickCount == ( portTickType ) 0U )
+			#if ( configUSE_TIMING_WHEEL == 1 )
 			{
-				taskSWITCH_DELAYED_LISTS();
-			}
+				if( xConstTickCount == ( portTickType ) 0U )
+				{
+					xNumOfOverflows++;
+				}
+
+				/* Normally this processes one tick, but after vTaskStepTick()
+				the wheel has to catch up with the ticks that were skipped.
+				Those slots are known to be empty of expiring tasks, but tasks
+				in higher levels may still need moving down the wheel. */
+				while( xWheelTickCount != xConstTickCount )
+				{
+					++xWheelTickCount;
 
-			/* See if this tick has made a timeout expire.  Tasks are stored in the
-			queue in the order of their wake time - meaning once one tasks has been
-			found whose block time has not expired there is no need not look any
-			further	down the list. */
-			if( xConstTickCount >= xNextTaskUnblockTime )
+					if( prvWheelProcessTick() != pdFALSE )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+				}
+			}
+			#else
 			{
-				for( ;; )
+			tskTCB * pxTCB;
+			tskTickType xItemValue;
+
+				#if ( configUSE_64_BIT_TICKS == 0 )
 				{
-					if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+					if( xConstTickCount == ( portTickType ) 0U )
 					{
-						/* The delayed list is empty.  Set xNextTaskUnblockTime to
-						the	maximum possible value so it is extremely unlikely that
-						the if( xTickCount >= xNextTaskUnblockTime ) test will pass
-						next time through. */
-						xNextTaskUnblockTime = portMAX_DELAY;
-						break;
+						taskSWITCH_DELAYED_LISTS();
 					}
-					else
+				}
+				#endif /* configUSE_64_BIT_TICKS */
+
+				/* See if this tick has made a timeout expire.  Tasks are stored in the
+				queue in the order of their wake time - meaning once one tasks has been
+				found whose block time has not expired there is no need not look any
+				further	down the list. */
+				if( xConstTickCount >= xNextTaskUnblockTime )
+				{
+					for( ;; )
 					{
-						/* The delayed list is not empty, get the value of the item
-						at the head of the delayed list.  This is the time at which
-						the task at the head of the delayed list must be removed
-						from the Blocked state. */
-						pxTCB = ( tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
-						xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) );
-
-						if( xConstTickCount < xItemValue )
+						if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
 						{
-							/* It is not time to unblock this item yet, but the item
-							value is the time at which the task at the head of the
-							blocked list must be removed from the Blocked state -
-							so record the item value in xNextTaskUnblockTime. */
-							xNextTaskUnblockTime = xItemValue;
+							/* The delayed list is empty.  Set xNextTaskUnblockTime to
+							the	maximum possible value so it is extremely unlikely that
+							the if( xTickCount >= xNextTaskUnblockTime ) test will pass
+							next time through. */
+							xNextTaskUnblockTime = tskMAX_TICK_COUNT;
 							break;
 						}
+						else
+						{
+							/* The delayed list is not empty, get the value of the item
+							at the head of the delayed list.  This is the time at which
+							the task at the head of the delayed list must be removed
+							from the Blocked state. */
+							pxTCB = ( tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+							xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) );
+
+							if( xConstTickCount < xItemValue )
+							{
+								/* It is not time to unblock this item yet, but the item
+								value is the time at which the task at the head of the
+								blocked list must be removed from the Blocked state -
+								so record the item value in xNextTaskUnblockTime. */
+								xNextTaskUnblockTime = xItemValue;
+								break;
+							}
 
-						/* It is time to remove the item from the Blocked state. */
-						( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+							/* It is time to remove the item from the Blocked state. */
+							( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
 
-						/* Is the task waiting on an event also?  If so remove it
-						from the event list. */
-						if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-						{
-							( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-						}
+							/* Is the task waiting on an event also?  If so remove it
+							from the event list. */
+							if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+							{
+								( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+							}
 
-						/* Place the unblocked task into the appropriate ready
-						list. */
-						prvAddTaskToReadyList( pxTCB );
+							/* Place the unblocked task into the appropriate ready
+							list. */
+							taskRECORD_WAKE_SOURCE( pxTCB );
+							prvAddTaskToReadyList( pxTCB );
 
-						/* A task being unblocked cannot cause an immediate context
-						switch if preemption is turned off. */
-						#if (  configUSE_PREEMPTION == 1 )
-						{
-							/* Preemption is on, but a context switch should only
-							be performed if the unblocked task has a priority that
-							is equal to or higher than the currently executing
-							task. */
-							if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+							/* A task being unblocked cannot cause an immediate context
+							switch if preemption is turned off. */
+							#if (  configUSE_PREEMPTION == 1 )
 							{
-								xSwitchRequired = pdTRUE;
+								/* Preemption is on, but a context switch should only
+								be performed if the unblocked task has a priority that
+								is equal to or higher than the currently executing
+								task. */
+								if( taskYIELD_FOR_TASK( pxTCB, pdTRUE ) != pdFALSE )
+								{
+									xSwitchRequired = pdTRUE;
+								}
 							}
+							#endif /* configUSE_PREEMPTION */
 						}
-						#endif /* configUSE_PREEMPTION */
 					}
 				}
 			}
+			#endif /* configUSE_TIMING_WHEEL */
 		}
 
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
 		writer has not explicitly turned time slicing off. */
-		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) && ( configNUM_CORES == 1 ) )
+		{
+			if( taskTIME_SLICE_EXPIRED( pxCurrentTCB ) != pdFALSE )
+			{
+				if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( unsigned portBASE_TYPE ) 1 )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+			}
+		}
+		#elif ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
 		{
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( unsigned portBASE_TYPE ) 1 )
+		portBASE_TYPE xCoreID, xOtherCoreID;
+		unsigned portBASE_TYPE uxPriority, uxRunningAtPriority;
+
+			/* A core only has to switch if there are more ready tasks at the
+			priority it is running than there are cores running that
+			priority. */
+			for( xCoreID = 0; xCoreID < ( portBASE_TYPE ) configNUM_CORES; xCoreID++ )
 			{
-				xSwitchRequired = pdTRUE;
+				if( taskTIME_SLICE_EXPIRED( pxCurrentTCBs[ xCoreID ] ) == pdFALSE )
+				{
+					continue;
+				}
+
+				uxPriority = pxCurrentTCBs[ xCoreID ]->uxPriority;
+				uxRunningAtPriority = 0U;
+
+				for( xOtherCoreID = 0; xOtherCoreID < ( portBASE_TYPE ) configNUM_CORES; xOtherCoreID++ )
+				{
+					if( pxCurrentTCBs[ xOtherCoreID ]->uxPriority == uxPriority )
+					{
+						uxRunningAtPriority++;
+					}
+				}
+
+				if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxPriority ] ) ) > uxRunningAtPriority )
+				{
+					if( xCoreID == portGET_CORE_ID() )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						portYIELD_CORE( xCoreID );
+					}
+				}
 			}
 		}
 		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
@@ -1804,24 +3324,9 @@ void vTaskSwitchContext( void )
 
 		#if ( configGENERATE_RUN_TIME_STATS == 1 )
 		{
-				#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-					portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
-				#else
-					ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-				#endif
-
-				/* Add the amount of time the task has been running to the
-				accumulated	time so far.  The time the task started running was
-				stored in ulTaskSwitchedInTime.  Note that there is no overflow
-				protection here	so count values are only valid until the timer
-				overflows.  The guard against negative values is to protect
-				against suspect run time stat counter implementations - which
-				are provided by the application, not the kernel. */
-				if( ulTotalRunTime > ulTaskSwitchedInTime )
-				{
-					pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
-				}
-				ulTaskSwitchedInTime = ulTotalRunTime;
+			/* Add the time the task has been running since it was switched in,
+			or since an interrupt last charged time to it, to its total. */
+			prvChargeRunTime();
 		}
 		#endif /* configGENERATE_RUN_TIME_STATS */
 
@@ -1832,6 +3337,29 @@ void vTaskSwitchContext( void )
 
 		traceTASK_SWITCHED_IN();
 
+		#if ( configUSE_TASK_TIME_SLICES == 1 )
+		{
+			/* The task starts a new time slice each time it is switched in,
+			including when it is selected again. */
+			pxCurrentTCB->xTimeSliceLeft = pxCurrentTCB->xTimeSlice;
+		}
+		#endif /* configUSE_TASK_TIME_SLICES */
+
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			pullRunTimeCounterCharged = &( pxCurrentTCB->ullRunTimeCounter );
+		}
+		#endif /* configGENERATE_RUN_TIME_STATS */
+
+		#if ( configRECORD_WAKE_LATENCY == 1 )
+		{
+			if( pxCurrentTCB->pxWakeSource != NULL )
+			{
+				prvRecordWakeLatency( pxCurrentTCB );
+			}
+		}
+		#endif /* configRECORD_WAKE_LATENCY */
+
 		#if ( configUSE_NEWLIB_REENTRANT == 1 )
 		{
 			/* Switch Newlib's _impure_ptr variable to point to the _reent
@@ -1843,9 +3371,124 @@ void vTaskSwitchContext( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configNUM_CORES > 1 )
+
+	static void prvSelectHighestPriorityTask( portBASE_TYPE xCoreID )
+	{
+	unsigned portBASE_TYPE uxPriority, uxItemsLeft;
+	xList *pxList;
+	xListItem *pxItem;
+	tskTCB *pxTCB, *pxSelectedTCB = NULL;
+
+		/* Find the highest priority queue that contains ready tasks.  Tasks
+		in it may all be running on other cores, so lower priorities are also
+		searched, but uxTopReadyPriority itself is only lowered past lists
+		that are empty. */
+		while( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopReadyPriority ] ) ) )
+		{
+			configASSERT( uxTopReadyPriority );
+			--uxTopReadyPriority;
+		}
+
+		for( uxPriority = uxTopReadyPriority; pxSelectedTCB == NULL; uxPriority-- )
+		{
+			pxList = &( pxReadyTasksLists[ uxPriority ] );
+
+			/* Start after the task last selected from this list, so tasks of
+			equal priority are taken in turn.  The task already running on
+			this core, if still ready, is only chosen again if no other task
+			at its priority is free. */
+			pxItem = pxList->pxIndex;
+			for( uxItemsLeft = listCURRENT_LIST_LENGTH( pxList ); uxItemsLeft > 0U; )
+			{
+				pxItem = pxItem->pxNext;
+				if( ( void * ) pxItem == ( void * ) &( pxList->xListEnd ) )
+				{
+					continue;
+				}
+				uxItemsLeft--;
+
+				pxTCB = ( tskTCB * ) listGET_LIST_ITEM_OWNER( pxItem );
+				if( ( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING ) || ( pxTCB->xTaskRunState == xCoreID ) )
+				{
+					pxList->pxIndex = pxItem;
+					pxSelectedTCB = pxTCB;
+					break;
+				}
+			}
+
+			/* There is an idle task for every core, so a task is always
+			found by the idle priority. */
+			configASSERT( ( pxSelectedTCB != NULL ) || ( uxPriority > tskIDLE_PRIORITY ) );
+		}
+
+		if( ( pxCurrentTCBs[ xCoreID ] != NULL ) && ( pxCurrentTCBs[ xCoreID ]->xTaskRunState == xCoreID ) )
+		{
+			pxCurrentTCBs[ xCoreID ]->xTaskRunState = taskTASK_NOT_RUNNING;
+		}
+		pxSelectedTCB->xTaskRunState = xCoreID;
+		pxCurrentTCBs[ xCoreID ] = pxSelectedTCB;
+	}
+	/*-----------------------------------------------------------*/
+
+	static portBASE_TYPE prvYieldForTask( const tskTCB * const pxTCB, portBASE_TYPE xEqualPriority )
+	{
+	portBASE_TYPE xCoreID, xLowestCoreID = taskTASK_NOT_RUNNING;
+	const portBASE_TYPE xThisCoreID = portGET_CORE_ID();
+	unsigned portBASE_TYPE uxLowestPriority = pxTCB->uxPriority;
+	portBASE_TYPE xReturn = pdFALSE;
+
+		if( ( xSchedulerRunning != pdFALSE ) && ( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING ) )
+		{
+			/* A task of equal priority is only preempted on the calling core,
+			matching what happens when there is a single core.  Interrupting
+			another core to swap equal priority tasks would gain nothing. */
+			if( ( xEqualPriority != pdFALSE ) && ( pxCurrentTCBs[ xThisCoreID ]->uxPriority == pxTCB->uxPriority ) )
+			{
+				xLowestCoreID = xThisCoreID;
+			}
+
+			/* Otherwise find the core running the lowest priority task.  The
+			calling core is checked first so it wins a tie. */
+			for( xCoreID = 0; xCoreID < ( portBASE_TYPE ) configNUM_CORES; xCoreID++ )
+			{
+				const portBASE_TYPE xCandidate = ( xThisCoreID + xCoreID ) % ( portBASE_TYPE ) configNUM_CORES;
+
+				if( pxCurrentTCBs[ xCandidate ]->uxPriority < uxLowestPriority )
+				{
+					uxLowestPriority = pxCurrentTCBs[ xCandidate ]->uxPriority;
+					xLowestCoreID = xCandidate;
+				}
+			}
+
+			if( xLowestCoreID == xThisCoreID )
+			{
+				xReturn = pdTRUE;
+			}
+			else if( xLowestCoreID != taskTASK_NOT_RUNNING )
+			{
+				portYIELD_CORE( xLowestCoreID );
+			}
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvYieldCoreRunningTask( const tskTCB * const pxTCB )
+	{
+		if( ( xSchedulerRunning != pdFALSE ) && ( pxTCB->xTaskRunState != taskTASK_NOT_RUNNING ) && ( pxTCB->xTaskRunState != portGET_CORE_ID() ) )
+		{
+			portYIELD_CORE( pxTCB->xTaskRunState );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configNUM_CORES */
+
 void vTaskPlaceOnEventList( xList * const pxEventList, portTickType xTicksToWait )
 {
-portTickType xTimeToWake;
+tskTickType xTimeToWake;
 
 	configASSERT( pxEventList );
 
@@ -1863,8 +3506,8 @@ portTickType xTimeToWake;
 	if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
 	{
 		/* The current task must be in a ready list, so there is no need to
-		check, and the port reset macro can be called directly. */
-		portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+		check, and the ready priority can be cleared directly. */
+		taskCLEAR_READY_PRIORITY( pxCurrentTCB->uxPriority );
 	}
 
 	#if ( INCLUDE_vTaskSuspend == 1 )
@@ -1899,7 +3542,7 @@ portTickType xTimeToWake;
 
 	void vTaskPlaceOnEventListRestricted( xList * const pxEventList, portTickType xTicksToWait )
 	{
-	portTickType xTimeToWake;
+	tskTickType xTimeToWake;
 
 		configASSERT( pxEventList );
 
@@ -1921,8 +3564,8 @@ portTickType xTimeToWake;
 		if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
 		{
 			/* The current task must be in a ready list, so there is no need to
-			check, and the port reset macro can be called directly. */
-			portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+			check, and the ready priority can be cleared directly. */
+			taskCLEAR_READY_PRIORITY( pxCurrentTCB->uxPriority );
 		}
 
 		/* Calculate the time at which the task should be woken if the event does
@@ -1957,6 +3600,7 @@ portBASE_TYPE xReturn;
 	pxUnblockedTCB = ( tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
 	configASSERT( pxUnblockedTCB );
 	( void ) uxListRemove( &( pxUnblockedTCB->xEventListItem ) );
+	taskRECORD_WAKE_SOURCE( pxUnblockedTCB );
 
 	if( uxSchedulerSuspended == ( unsigned portBASE_TYPE ) pdFALSE )
 	{
@@ -1970,6 +3614,20 @@ portBASE_TYPE xReturn;
 		vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
 	}
 
+	#if ( configNUM_CORES > 1 )
+	{
+		/* A task held in the pending ready list is checked against the
+		running tasks by xTaskResumeAll() instead. */
+		if( uxSchedulerSuspended == ( unsigned portBASE_TYPE ) pdFALSE )
+		{
+			xReturn = prvYieldForTask( pxUnblockedTCB, pdTRUE );
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+	}
+	#else
 	if( pxUnblockedTCB->uxPriority >= pxCurrentTCB->uxPriority )
 	{
 		/* Return true if the task removed from the event list has
@@ -1982,80 +3640,209 @@ portBASE_TYPE xReturn;
 	{
 		xReturn = pdFALSE;
 	}
+	#endif /* configNUM_CORES */
 
 	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-void vTaskSetTimeOutState( xTimeOutType * const pxTimeOut )
-{
-	configASSERT( pxTimeOut );
-	pxTimeOut->xOverflowCount = xNumOfOverflows;
-	pxTimeOut->xTimeOnEntering = xTickCount;
-}
-/*-----------------------------------------------------------*/
-
-portBASE_TYPE xTaskCheckForTimeOut( xTimeOutType * const pxTimeOut, portTickType * const pxTicksToWait )
+void vTaskPlaceOnUnorderedEventList( xList * pxEventList, const portTickType xItemValue, const portTickType xTicksToWait )
 {
-portBASE_TYPE xReturn;
+tskTickType xTimeToWake;
 
-	configASSERT( pxTimeOut );
-	configASSERT( pxTicksToWait );
+	configASSERT( pxEventList );
 
-	taskENTER_CRITICAL();
+	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+	the event groups implementation. */
+	configASSERT( uxSchedulerSuspended != ( unsigned portBASE_TYPE ) 0 );
+
+	/* Store the item value in the event list item.  It is safe to access the
+	event list item here as interrupts won't access the event list item of a
+	task that is not in the Blocked state. */
+	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+	/* Place the event list item of the TCB at the end of the appropriate event
+	list.  It is safe to access the event list here because it is part of an
+	event group implementation - and interrupts don't access event groups
+	directly (instead they access them indirectly by pending function calls to
+	the task level). */
+	vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+	/* The task must be removed from the ready list before it is added to the
+	blocked list.  Exclusive access can be assured to the ready list as the
+	scheduler is locked. */
+	if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
 	{
-		/* Minor optimisation.  The tick count cannot change in this block. */
-		const portTickType xConstTickCount = xTickCount;
-
-		#if ( INCLUDE_vTaskSuspend == 1 )
-			/* If INCLUDE_vTaskSuspend is set to 1 and the block time specified is
-			the maximum block time then the task should block indefinitely, and
-			therefore never time out. */
-			if( *pxTicksToWait == portMAX_DELAY )
-			{
-				xReturn = pdFALSE;
-			}
-			else /* We are not blocking indefinitely, perform the checks below. */
-		#endif
+		/* The current task must be in a ready list, so there is no need to
+		check, and the ready priority can be cleared directly. */
+		taskCLEAR_READY_PRIORITY( pxCurrentTCB->uxPriority );
+	}
 
-		if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
-		{
-			/* The tick count is greater than the time at which vTaskSetTimeout()
-			was called, but has also overflowed since vTaskSetTimeOut() was called.
-			It must have wrapped all the way around and gone past us again. This
-			passed since vTaskSetTimeout() was called. */
-			xReturn = pdTRUE;
-		}
-		else if( ( xConstTickCount - pxTimeOut->xTimeOnEntering ) < *pxTicksToWait )
+	#if ( INCLUDE_vTaskSuspend == 1 )
+	{
+		if( xTicksToWait == portMAX_DELAY )
 		{
-			/* Not a genuine timeout. Adjust parameters for time remaining. */
-			*pxTicksToWait -= ( xConstTickCount -  pxTimeOut->xTimeOnEntering );
-			vTaskSetTimeOutState( pxTimeOut );
-			xReturn = pdFALSE;
+			/* Add the task to the suspended task list instead of a delayed task
+			list to ensure it is not woken by a timing event.  It will block
+			indefinitely. */
+			vListInsertEnd( &xSuspendedTaskList, &( pxCurrentTCB->xGenericListItem ) );
 		}
 		else
 		{
-			xReturn = pdTRUE;
+			/* Calculate the time at which the task should be woken if the event
+			does not occur.  This may overflow but this doesn't matter, the
+			kernel will manage it correctly. */
+			xTimeToWake = xTickCount + xTicksToWait;
+			prvAddCurrentTaskToDelayedList( xTimeToWake );
 		}
 	}
-	taskEXIT_CRITICAL();
-
-	return xReturn;
+	#else /* INCLUDE_vTaskSuspend */
+	{
+			/* Calculate the time at which the task should be woken if the event
+			does not occur.  This may overflow but this doesn't matter, the
+			kernel will manage it correctly. */
+			xTimeToWake = xTickCount + xTicksToWait;
+			prvAddCurrentTaskToDelayedList( xTimeToWake );
+	}
+	#endif /* INCLUDE_vTaskSuspend */
 }
 /*-----------------------------------------------------------*/
 
-void vTaskMissedYield( void )
+signed portBASE_TYPE xTaskRemoveFromUnorderedEventList( xListItem * pxEventListItem, const portTickType xItemValue )
 {
-	xYieldPending = pdTRUE;
-}
-/*-----------------------------------------------------------*/
+tskTCB *pxUnblockedTCB;
+portBASE_TYPE xReturn;
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+	the event flags implementation. */
+	configASSERT( uxSchedulerSuspended != ( unsigned portBASE_TYPE ) pdFALSE );
 
-	unsigned portBASE_TYPE uxTaskGetTaskNumber( xTaskHandle xTask )
-	{
-	unsigned portBASE_TYPE uxReturn;
-	tskTCB *pxTCB;
+	/* Store the new item value in the event list. */
+	listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+	/* Remove the event list form the event flag.  Interrupts do not access
+	event flags. */
+	pxUnblockedTCB = ( tskTCB * ) listGET_LIST_ITEM_OWNER( pxEventListItem );
+	configASSERT( pxUnblockedTCB );
+	( void ) uxListRemove( pxEventListItem );
+
+	/* Remove the task from the delayed list and add it to the ready list.  The
+	scheduler is suspended so interrupts will not be accessing the ready
+	lists. */
+	( void ) uxListRemove( &( pxUnblockedTCB->xGenericListItem ) );
+	taskRECORD_WAKE_SOURCE( pxUnblockedTCB );
+	prvAddTaskToReadyList( pxUnblockedTCB );
+
+	if( taskYIELD_FOR_TASK( pxUnblockedTCB, pdFALSE ) != pdFALSE )
+	{
+		/* Return true if the task removed from the event list has
+		a higher priority than the calling task.  This allows
+		the calling task to know if it should force a context
+		switch now. */
+		xReturn = pdTRUE;
+
+		/* Mark that a yield is pending in case the user is not using the
+		"xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
+		xYieldPending = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskSetTimeOutState( xTimeOutType * const pxTimeOut )
+{
+	configASSERT( pxTimeOut );
+
+	#if ( configUSE_64_BIT_TICKS == 1 )
+	{
+		/* The count cannot be read in a single access, so must not change
+		part way through. */
+		taskENTER_CRITICAL();
+		{
+			pxTimeOut->xTimeOnEntering = xTickCount;
+		}
+		taskEXIT_CRITICAL();
+	}
+	#else
+	{
+		pxTimeOut->xOverflowCount = xNumOfOverflows;
+		pxTimeOut->xTimeOnEntering = xTickCount;
+	}
+	#endif /* configUSE_64_BIT_TICKS */
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xTaskCheckForTimeOut( xTimeOutType * const pxTimeOut, portTickType * const pxTicksToWait )
+{
+portBASE_TYPE xReturn;
+
+	configASSERT( pxTimeOut );
+	configASSERT( pxTicksToWait );
+
+	taskENTER_CRITICAL();
+	{
+		/* Minor optimisation.  The tick count cannot change in this block. */
+		const tskTickType xConstTickCount = xTickCount;
+
+		#if ( INCLUDE_vTaskSuspend == 1 )
+			/* If INCLUDE_vTaskSuspend is set to 1 and the block time specified is
+			the maximum block time then the task should block indefinitely, and
+			therefore never time out. */
+			if( *pxTicksToWait == portMAX_DELAY )
+			{
+				xReturn = pdFALSE;
+			}
+			else /* We are not blocking indefinitely, perform the checks below. */
+		#endif
+
+		/* A 64 bit count does not wrap, so the subtraction below is all that
+		is needed. */
+		#if ( configUSE_64_BIT_TICKS == 0 )
+		if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
+		{
+			/* The tick count is greater than the time at which vTaskSetTimeout()
+			was called, but has also overflowed since vTaskSetTimeOut() was called.
+			It must have wrapped all the way around and gone past us again. This
+			passed since vTaskSetTimeout() was called. */
+			xReturn = pdTRUE;
+		}
+		else
+		#endif /* configUSE_64_BIT_TICKS */
+		if( ( xConstTickCount - pxTimeOut->xTimeOnEntering ) < *pxTicksToWait )
+		{
+			/* Not a genuine timeout. Adjust parameters for time remaining. */
+			*pxTicksToWait -= ( xConstTickCount -  pxTimeOut->xTimeOnEntering );
+			vTaskSetTimeOutState( pxTimeOut );
+			xReturn = pdFALSE;
+		}
+		else
+		{
+			xReturn = pdTRUE;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskMissedYield( void )
+{
+	xYieldPending = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	unsigned portBASE_TYPE uxTaskGetTaskNumber( xTaskHandle xTask )
+	{
+	unsigned portBASE_TYPE uxReturn;
+	tskTCB *pxTCB;
 
 		if( xTask != NULL )
 		{
@@ -2129,8 +3916,9 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 			A critical region is not required here as we are just reading from
 			the list, and an occasional incorrect value will not matter.  If
 			the ready list at the idle priority contains more than one task
-			then a task other than the idle task is ready to execute. */
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( unsigned portBASE_TYPE ) 1 )
+			per core then a task other than an idle task is ready to
+			execute. */
+			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( unsigned portBASE_TYPE ) configNUM_CORES )
 			{
 				taskYIELD();
 			}
@@ -2172,11 +3960,14 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 					/* Now the scheduler is suspended, the expected idle
 					time can be sampled again, and this time its value can
 					be used. */
-					configASSERT( xNextTaskUnblockTime >= xTickCount );
 					xExpectedIdleTime = prvGetExpectedIdleTime();
 
 					if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
 					{
+						/* Checked here rather than before sampling because
+						the timing wheel only brings xNextTaskUnblockTime up
+						to date inside prvGetExpectedIdleTime(). */
+						configASSERT( xNextTaskUnblockTime >= xTickCount );
 						traceLOW_POWER_IDLE_BEGIN();
 						portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
 						traceLOW_POWER_IDLE_END();
@@ -2206,6 +3997,12 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 			/* A yield was pended while the scheduler was suspended. */
 			eReturn = eAbortSleep;
 		}
+		else if( uxPendedTicks != ( unsigned portBASE_TYPE ) 0U )
+		{
+			/* A tick interrupt ran after the expected idle time was
+			calculated, so the idle time is one or more ticks too long. */
+			eReturn = eAbortSleep;
+		}
 		else
 		{
 			#if configUSE_TIMERS == 0
@@ -2263,9 +4060,17 @@ unsigned portBASE_TYPE x;
 	#if ( configUSE_MUTEXES == 1 )
 	{
 		pxTCB->uxBasePriority = uxPriority;
+		vListInitialise( &( pxTCB->xMutexesHeld ) );
+		pxTCB->pvMutexWaitedOn = NULL;
 	}
 	#endif /* configUSE_MUTEXES */
 
+	#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+	{
+		pxTCB->uxCeilingPriority = tskIDLE_PRIORITY;
+	}
+	#endif /* configUSE_PRIORITY_CEILING_MUTEXES */
+
 	vListInitialiseItem( &( pxTCB->xGenericListItem ) );
 	vListInitialiseItem( &( pxTCB->xEventListItem ) );
 
@@ -2291,10 +4096,39 @@ unsigned portBASE_TYPE x;
 
 	#if ( configGENERATE_RUN_TIME_STATS == 1 )
 	{
-		pxTCB->ulRunTimeCounter = 0UL;
+		pxTCB->ullRunTimeCounter = 0ULL;
 	}
 	#endif /* configGENERATE_RUN_TIME_STATS */
 
+	#if ( configRECORD_WAKE_LATENCY == 1 )
+	{
+		pxTCB->pxWakeSource = NULL;
+	}
+	#endif /* configRECORD_WAKE_LATENCY */
+
+	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+	{
+		pxTCB->ulNotifiedValue = 0UL;
+		pxTCB->eNotifyState = eNotWaitingNotification;
+	}
+	#endif /* configUSE_TASK_NOTIFICATIONS */
+
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+	{
+		/* Tasks are scheduled by priority alone until vTaskSetDeadline() is
+		called. */
+		pxTCB->xRelativeDeadline = ( portTickType ) 0;
+		pxTCB->xAbsoluteDeadline = ( portTickType ) 0;
+	}
+	#endif /* configUSE_EDF_SCHEDULING */
+
+	#if ( configUSE_TASK_TIME_SLICES == 1 )
+	{
+		pxTCB->xTimeSlice = ( portTickType ) configDEFAULT_TIME_SLICE_TICKS;
+		pxTCB->xTimeSliceLeft = ( portTickType ) configDEFAULT_TIME_SLICE_TICKS;
+	}
+	#endif /* configUSE_TASK_TIME_SLICES */
+
 	#if ( portUSING_MPU_WRAPPERS == 1 )
 	{
 		vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, pxTCB->pxStack, usStackDepth );
@@ -2339,13 +4173,43 @@ unsigned portBASE_TYPE uxPriority;
 		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
 	}
 
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
+	#if ( configUSE_TIMING_WHEEL == 1 )
+	{
+	unsigned portBASE_TYPE uxLevel;
+	portTickType xSlot;
+
+		for( uxLevel = 0; uxLevel < ( unsigned portBASE_TYPE ) configTIMING_WHEEL_LEVELS; uxLevel++ )
+		{
+			for( xSlot = 0; xSlot < tskWHEEL_SLOTS; xSlot++ )
+			{
+				vListInitialise( &( xDelayedTaskWheel[ uxLevel ][ xSlot ] ) );
+			}
+		}
+
+		vListInitialise( &xDelayedTaskFarList );
+	}
+	#elif ( configUSE_64_BIT_TICKS == 1 )
+	{
+		vListInitialise( &xDelayedTaskList1 );
+	}
+	#else
+	{
+		vListInitialise( &xDelayedTaskList1 );
+		vListInitialise( &xDelayedTaskList2 );
+	}
+	#endif /* configUSE_TIMING_WHEEL */
+
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
 	{
 		vListInitialise( &xTasksWaitingTermination );
+
+		#if ( configTASK_POOL_SIZE > 0 )
+		{
+			vListInitialise( &xTaskPool );
+		}
+		#endif /* configTASK_POOL_SIZE */
 	}
 	#endif /* INCLUDE_vTaskDelete */
 
@@ -2355,10 +4219,20 @@ unsigned portBASE_TYPE uxPriority;
 	}
 	#endif /* INCLUDE_vTaskSuspend */
 
-	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-	using list2. */
-	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	#if ( configUSE_HIGH_RES_DELAYS == 1 )
+	{
+		vListInitialise( &xHighResDelayedTaskList );
+	}
+	#endif /* configUSE_HIGH_RES_DELAYS */
+
+	#if ( ( configUSE_TIMING_WHEEL == 0 ) && ( configUSE_64_BIT_TICKS == 0 ) )
+	{
+		/* Start with pxDelayedTaskList using list1 and the
+		pxOverflowDelayedTaskList using list2. */
+		pxDelayedTaskList = &xDelayedTaskList1;
+		pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	}
+	#endif /* ( ( configUSE_TIMING_WHEEL == 0 ) && ( configUSE_64_BIT_TICKS == 0 ) ) */
 }
 /*-----------------------------------------------------------*/
 
@@ -2366,29 +4240,48 @@ static void prvCheckTasksWaitingTermination( void )
 {
 	#if ( INCLUDE_vTaskDelete == 1 )
 	{
-		portBASE_TYPE xListIsEmpty;
+	xList xTasksToDelete;
+	tskTCB *pxTCB;
 
-		/* ucTasksDeleted is used to prevent vTaskSuspendAll() being called
-		too often in the idle task. */
-		while( uxTasksDeleted > ( unsigned portBASE_TYPE ) 0U )
+		/* ucTasksDeleted is used to prevent a critical section being entered
+		on every iteration of the idle task. */
+		if( uxTasksDeleted > ( unsigned portBASE_TYPE ) 0U )
 		{
-			vTaskSuspendAll();
-				xListIsEmpty = listLIST_IS_EMPTY( &xTasksWaitingTermination );
-			( void ) xTaskResumeAll();
+			vListInitialise( &xTasksToDelete );
 
-			if( xListIsEmpty == pdFALSE )
+			/* Take every task that can be cleaned up in one go, then free
+			them outside of the critical section. */
+			taskENTER_CRITICAL();
 			{
-				tskTCB *pxTCB;
-
-				taskENTER_CRITICAL();
+				while( listLIST_IS_EMPTY( &xTasksWaitingTermination ) == pdFALSE )
 				{
 					pxTCB = ( tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
+
+					#if ( configNUM_CORES > 1 )
+					{
+						/* A task that deleted itself keeps running until its
+						core switches it out, so its stack cannot be freed yet.
+						Try again next time round the idle loop. */
+						if( pxTCB->xTaskRunState != taskTASK_NOT_RUNNING )
+						{
+							break;
+						}
+					}
+					#endif /* configNUM_CORES */
+
 					( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+					vListInsertEnd( &xTasksToDelete, &( pxTCB->xGenericListItem ) );
 					--uxCurrentNumberOfTasks;
 					--uxTasksDeleted;
 				}
-				taskEXIT_CRITICAL();
+			}
+			taskEXIT_CRITICAL();
 
+			/* The list is local to this function so needs no protection. */
+			while( listLIST_IS_EMPTY( &xTasksToDelete ) == pdFALSE )
+			{
+				pxTCB = ( tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksToDelete ) );
+				( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
 				prvDeleteTCB( pxTCB );
 			}
 		}
@@ -2397,125 +4290,434 @@ static void prvCheckTasksWaitingTermination( void )
 }
 /*-----------------------------------------------------------*/
 
-static void prvAddCurrentTaskToDelayedList( portTickType xTimeToWake )
+static void prvAddCurrentTaskToDelayedList( tskTickType xTimeToWake )
 {
+	#if ( configUSE_TIMING_WHEEL == 1 )
+	{
+		if( xTimeToWake == xWheelTickCount )
+		{
+			/* The slot for the current tick has already been processed, so a
+			zero length block (the timer task blocks like this when it has no
+			active timers) would otherwise last a whole turn of the wheel.  Wake
+			on the next tick instead, as the sorted delayed list does. */
+			xTimeToWake++;
+		}
+	}
+	#endif /* configUSE_TIMING_WHEEL */
+
 	/* The list item will be inserted in wake time order. */
 	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xGenericListItem ), xTimeToWake );
 
-	if( xTimeToWake < xTickCount )
+	#if ( configUSE_TIMING_WHEEL == 1 )
 	{
-		/* Wake time has overflowed.  Place this item in the overflow list. */
-		vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+		/* The wheel slot is chosen from the wake time, so tick overflow needs
+		no special handling. */
+		prvWheelInsert( &( pxCurrentTCB->xGenericListItem ) );
 	}
-	else
+	#elif ( configUSE_64_BIT_TICKS == 1 )
 	{
-		/* The wake time has not overflowed, so we can use the current block list. */
+		/* The wake time cannot overflow, so there is only one list. */
 		vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
 
-		/* If the task entering the blocked state was placed at the head of the
-		list of blocked tasks then xNextTaskUnblockTime needs to be updated
-		too. */
 		if( xTimeToWake < xNextTaskUnblockTime )
 		{
 			xNextTaskUnblockTime = xTimeToWake;
 		}
 	}
+	#else
+	{
+		if( xTimeToWake < xTickCount )
+		{
+			/* Wake time has overflowed.  Place this item in the overflow list. */
+			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+		}
+		else
+		{
+			/* The wake time has not overflowed, so we can use the current block list. */
+			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+
+			/* If the task entering the blocked state was placed at the head of the
+			list of blocked tasks then xNextTaskUnblockTime needs to be updated
+			too. */
+			if( xTimeToWake < xNextTaskUnblockTime )
+			{
+				xNextTaskUnblockTime = xTimeToWake;
+			}
+		}
+	}
+	#endif /* configUSE_TIMING_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
-static tskTCB *prvAllocateTCBAndStack( unsigned short usStackDepth, portSTACK_TYPE *puxStackBuffer )
-{
-tskTCB *pxNewTCB;
-
-	/* Allocate space for the TCB.  Where the memory comes from depends on
-	the implementation of the port malloc function. */
-	pxNewTCB = ( tskTCB * ) pvPortMalloc( sizeof( tskTCB ) );
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	if( pxNewTCB != NULL )
+	static void prvBlockCurrentTaskOnNotification( portTickType xTicksToWait )
 	{
-		/* Allocate space for the stack used by the task being created.
-		The base of the stack memory stored in the TCB so the task can
-		be deleted later if required. */
-		pxNewTCB->pxStack = ( portSTACK_TYPE * ) pvPortMallocAligned( ( ( ( size_t ) usStackDepth ) * sizeof( portSTACK_TYPE ) ), puxStackBuffer ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		/* The task is only referenced from a delayed or suspended list, so the
+		ready list can be manipulated directly from within the critical
+		section the caller holds. */
+		if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
+		{
+			taskCLEAR_READY_PRIORITY( pxCurrentTCB->uxPriority );
+		}
 
-		if( pxNewTCB->pxStack == NULL )
+		#if ( INCLUDE_vTaskSuspend == 1 )
 		{
-			/* Could not allocate the stack.  Delete the allocated TCB. */
-			vPortFree( pxNewTCB );
-			pxNewTCB = NULL;
+			if( xTicksToWait == portMAX_DELAY )
+			{
+				/* No time out, so block indefinitely in the suspended list. */
+				vListInsertEnd( &xSuspendedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+			}
+			else
+			{
+				prvAddCurrentTaskToDelayedList( xTickCount + xTicksToWait );
+			}
 		}
-		else
+		#else /* INCLUDE_vTaskSuspend */
 		{
-			/* Just to help debugging. */
-			( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) usStackDepth * sizeof( portSTACK_TYPE ) );
+			prvAddCurrentTaskToDelayedList( xTickCount + xTicksToWait );
 		}
+		#endif /* INCLUDE_vTaskSuspend */
 	}
 
-	return pxNewTCB;
-}
+#endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_TIMING_WHEEL == 1 )
 
-	static unsigned portBASE_TYPE prvListTaskWithinSingleList( xTaskStatusType *pxTaskStatusArray, xList *pxList, eTaskState eState )
+	static void prvWheelInsert( xListItem *pxListItem )
 	{
-	volatile tskTCB *pxNextTCB, *pxFirstTCB;
-	unsigned portBASE_TYPE uxTask = 0;
-
-		if( listCURRENT_LIST_LENGTH( pxList ) > ( unsigned portBASE_TYPE ) 0 )
+	const portTickType xTimeToWake = listGET_LIST_ITEM_VALUE( pxListItem );
+	const portTickType xTicksToWait = xTimeToWake - xWheelTickCount;
+	unsigned portBASE_TYPE uxLevel;
+	xList *pxList;
+
+		/* Find the lowest level that spans the wait.  A slot in level n is
+		tskWHEEL_SLOTS^n ticks wide and the level covers waits shorter than
+		tskWHEEL_SLOTS^(n+1) ticks.  Arithmetic is modulo the tick type, so
+		this is correct across tick count overflow. */
+		for( uxLevel = 0; uxLevel < ( unsigned portBASE_TYPE ) ( configTIMING_WHEEL_LEVELS - 1 ); uxLevel++ )
 		{
-			listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList );
-
-			/* Populate an xTaskStatusType structure within the
-			pxTaskStatusArray array for each task that is referenced from
-			pxList.  See the definition of xTaskStatusType in task.h for the
-			meaning of each xTaskStatusType structure member. */
-			do
+			if( ( xTicksToWait >> tskWHEEL_LEVEL_SHIFT( uxLevel + 1U ) ) == ( portTickType ) 0U )
 			{
-				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList );
-
-				pxTaskStatusArray[ uxTask ].xHandle = ( xTaskHandle ) pxNextTCB;
-				pxTaskStatusArray[ uxTask ].pcTaskName = ( const signed char * ) &( pxNextTCB->pcTaskName [ 0 ] );
-				pxTaskStatusArray[ uxTask ].xTaskNumber = pxNextTCB->uxTCBNumber;
-				pxTaskStatusArray[ uxTask ].eCurrentState = eState;
-				pxTaskStatusArray[ uxTask ].uxCurrentPriority = pxNextTCB->uxPriority;
+				break;
+			}
+		}
 
-				#if ( configUSE_MUTEXES == 1 )
-				{
-					pxTaskStatusArray[ uxTask ].uxBasePriority = pxNextTCB->uxBasePriority;
-				}
-				#else
-				{
-					pxTaskStatusArray[ uxTask ].uxBasePriority = 0;
-				}
-				#endif
+		pxList = &( xDelayedTaskWheel[ uxLevel ][ ( xTimeToWake >> tskWHEEL_LEVEL_SHIFT( uxLevel ) ) & tskWHEEL_SLOT_MASK ] );
 
-				#if ( configGENERATE_RUN_TIME_STATS == 1 )
-				{
-					pxTaskStatusArray[ uxTask ].ulRunTimeCounter = pxNextTCB->ulRunTimeCounter;
-				}
-				#else
-				{
-					pxTaskStatusArray[ uxTask ].ulRunTimeCounter = 0;
-				}
-				#endif
+		#if ( tskWHEEL_USE_FAR_LIST == 1 )
+		{
+			if( ( xTicksToWait >> tskWHEEL_LEVEL_SHIFT( configTIMING_WHEEL_LEVELS ) ) != ( portTickType ) 0U )
+			{
+				/* Too far in the future for the wheel.  The order of the far
+				list does not matter as it is re-examined as a whole. */
+				pxList = &xDelayedTaskFarList;
+			}
+		}
+		#endif /* tskWHEEL_USE_FAR_LIST */
 
-				#if ( portSTACK_GROWTH > 0 )
-				{
-					ppxTaskStatusArray[ uxTask ].usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( unsigned char * ) pxNextTCB->pxEndOfStack );
-				}
-				#else
-				{
-					pxTaskStatusArray[ uxTask ].usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( unsigned char * ) pxNextTCB->pxStack );
-				}
-				#endif
+		vListInsertEnd( pxList, pxListItem );
+	}
+	/*-----------------------------------------------------------*/
 
-				uxTask++;
+	static void prvWheelCascade( xList *pxList )
+	{
+	tskTCB *pxTCB;
+	unsigned portBASE_TYPE uxItems;
 
-			} while( pxNextTCB != pxFirstTCB );
+		/* Tasks from the far list can be placed straight back into it, so only
+		the items present on entry are moved. */
+		for( uxItems = listCURRENT_LIST_LENGTH( pxList ); uxItems > ( unsigned portBASE_TYPE ) 0U; uxItems-- )
+		{
+			pxTCB = ( tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( pxList );
+			( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+			prvWheelInsert( &( pxTCB->xGenericListItem ) );
 		}
-
-		return uxTask;
+	}
+	/*-----------------------------------------------------------*/
+
+	static portBASE_TYPE prvWheelProcessTick( void )
+	{
+	const portTickType xConstWheelTickCount = xWheelTickCount;
+	unsigned portBASE_TYPE uxLevel;
+	xList *pxSlot;
+	tskTCB *pxTCB;
+	portBASE_TYPE xSwitchRequired = pdFALSE;
+
+		/* When the tick count reaches the start of a level n slot, the tasks in
+		that slot are due within the next tskWHEEL_SLOTS^n ticks so are moved
+		down to the lower levels.  Level n can only be at the start of a slot
+		if level n - 1 is too. */
+		for( uxLevel = 1U; uxLevel < ( unsigned portBASE_TYPE ) configTIMING_WHEEL_LEVELS; uxLevel++ )
+		{
+			if( ( xConstWheelTickCount & ( ( ( portTickType ) 1U << tskWHEEL_LEVEL_SHIFT( uxLevel ) ) - ( portTickType ) 1U ) ) != ( portTickType ) 0U )
+			{
+				break;
+			}
+
+			prvWheelCascade( &( xDelayedTaskWheel[ uxLevel ][ ( xConstWheelTickCount >> tskWHEEL_LEVEL_SHIFT( uxLevel ) ) & tskWHEEL_SLOT_MASK ] ) );
+		}
+
+		#if ( tskWHEEL_USE_FAR_LIST == 1 )
+		{
+			if( ( xConstWheelTickCount & ( ( ( portTickType ) 1U << tskWHEEL_LEVEL_SHIFT( configTIMING_WHEEL_LEVELS ) ) - ( portTickType ) 1U ) ) == ( portTickType ) 0U )
+			{
+				/* The whole wheel has turned, so some of the far tasks may now
+				be in range. */
+				prvWheelCascade( &xDelayedTaskFarList );
+			}
+		}
+		#endif /* tskWHEEL_USE_FAR_LIST */
+
+		/* Every task in the level 0 slot for this tick is due now. */
+		pxSlot = &( xDelayedTaskWheel[ 0 ][ xConstWheelTickCount & tskWHEEL_SLOT_MASK ] );
+
+		while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+		{
+			pxTCB = ( tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+			configASSERT( listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) ) == xConstWheelTickCount );
+
+			/* It is time to remove the item from the Blocked state. */
+			( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+
+			/* Is the task waiting on an event also?  If so remove it from the
+			event list. */
+			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+			{
+				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+			}
+
+			/* Place the unblocked task into the appropriate ready list. */
+			taskRECORD_WAKE_SOURCE( pxTCB );
+			prvAddTaskToReadyList( pxTCB );
+
+			/* A task being unblocked cannot cause an immediate context switch
+			if preemption is turned off. */
+			#if (  configUSE_PREEMPTION == 1 )
+			{
+				if( taskYIELD_FOR_TASK( pxTCB, pdTRUE ) != pdFALSE )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+			}
+			#endif /* configUSE_PREEMPTION */
+		}
+
+		return xSwitchRequired;
+	}
+	/*-----------------------------------------------------------*/
+
+	#if ( configUSE_TICKLESS_IDLE != 0 )
+
+		static portTickType prvWheelNextUnblockTime( void )
+		{
+		const portTickType xConstWheelTickCount = xWheelTickCount;
+		portTickType xTicks, xSlotStart, xBlock, xMinTicks = portMAX_DELAY;
+		unsigned portBASE_TYPE uxLevel;
+
+			/* The first occupied level 0 slot gives an exact wake time. */
+			for( xTicks = ( portTickType ) 1U; xTicks < tskWHEEL_SLOTS; xTicks++ )
+			{
+				if( listLIST_IS_EMPTY( &( xDelayedTaskWheel[ 0 ][ ( xConstWheelTickCount + xTicks ) & tskWHEEL_SLOT_MASK ] ) ) == pdFALSE )
+				{
+					xMinTicks = xTicks;
+					break;
+				}
+			}
+
+			/* Higher level slots only give the earliest time at which any of
+			their tasks could be due - the start of the slot. */
+			for( uxLevel = 1U; uxLevel < ( unsigned portBASE_TYPE ) configTIMING_WHEEL_LEVELS; uxLevel++ )
+			{
+				for( xBlock = ( portTickType ) 1U; xBlock <= tskWHEEL_SLOTS; xBlock++ )
+				{
+					xSlotStart = ( ( xConstWheelTickCount >> tskWHEEL_LEVEL_SHIFT( uxLevel ) ) + xBlock ) << tskWHEEL_LEVEL_SHIFT( uxLevel );
+
+					if( listLIST_IS_EMPTY( &( xDelayedTaskWheel[ uxLevel ][ ( xSlotStart >> tskWHEEL_LEVEL_SHIFT( uxLevel ) ) & tskWHEEL_SLOT_MASK ] ) ) == pdFALSE )
+					{
+						xTicks = xSlotStart - xConstWheelTickCount;
+						if( xTicks < xMinTicks )
+						{
+							xMinTicks = xTicks;
+						}
+						break;
+					}
+				}
+			}
+
+			#if ( tskWHEEL_USE_FAR_LIST == 1 )
+			{
+				if( listLIST_IS_EMPTY( &xDelayedTaskFarList ) == pdFALSE )
+				{
+					xSlotStart = ( ( xConstWheelTickCount >> tskWHEEL_LEVEL_SHIFT( configTIMING_WHEEL_LEVELS ) ) + ( portTickType ) 1U ) << tskWHEEL_LEVEL_SHIFT( configTIMING_WHEEL_LEVELS );
+					xTicks = xSlotStart - xConstWheelTickCount;
+					if( xTicks < xMinTicks )
+					{
+						xMinTicks = xTicks;
+					}
+				}
+			}
+			#endif /* tskWHEEL_USE_FAR_LIST */
+
+			if( ( xMinTicks == portMAX_DELAY ) || ( ( portTickType ) ( xConstWheelTickCount + xMinTicks ) < xConstWheelTickCount ) )
+			{
+				/* Nothing is delayed, or nothing is due before the tick count
+				overflows.  Behave as the sorted delayed lists would. */
+				xSlotStart = portMAX_DELAY;
+			}
+			else
+			{
+				xSlotStart = xConstWheelTickCount + xMinTicks;
+			}
+
+			return xSlotStart;
+		}
+
+	#endif /* configUSE_TICKLESS_IDLE */
+
+#endif /* configUSE_TIMING_WHEEL */
+/*-----------------------------------------------------------*/
+
+static tskTCB *prvAllocateTCBAndStack( unsigned short usStackDepth, portSTACK_TYPE *puxStackBuffer, xStaticTask *pxTaskBuffer )
+{
+tskTCB *pxNewTCB;
+
+	if( pxTaskBuffer != NULL )
+	{
+		/* The application provided the memory for the TCB. */
+		pxNewTCB = ( tskTCB * ) pxTaskBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by xTaskCreateStatic(). */
+	}
+	else
+	{
+		/* Allocate space for the TCB.  Where the memory comes from depends on
+		the implementation of the port malloc function. */
+		pxNewTCB = ( tskTCB * ) pvPortMalloc( sizeof( tskTCB ) );
+	}
+
+	if( pxNewTCB != NULL )
+	{
+		/* Allocate space for the stack used by the task being created.
+		The base of the stack memory stored in the TCB so the task can
+		be deleted later if required. */
+		pxNewTCB->pxStack = ( portSTACK_TYPE * ) pvPortMallocAligned( ( ( ( size_t ) usStackDepth ) * sizeof( portSTACK_TYPE ) ), puxStackBuffer ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+		if( pxNewTCB->pxStack == NULL )
+		{
+			/* Could not allocate the stack.  Delete the allocated TCB, if it
+			was allocated here. */
+			if( pxTaskBuffer == NULL )
+			{
+				vPortFree( pxNewTCB );
+			}
+			pxNewTCB = NULL;
+		}
+		else
+		{
+			/* Just to help debugging. */
+			( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) usStackDepth * sizeof( portSTACK_TYPE ) );
+
+			#if ( configTASK_POOL_SIZE > 0 )
+			{
+				pxNewTCB->usStackDepth = usStackDepth;
+			}
+			#endif /* configTASK_POOL_SIZE */
+
+			#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* Remember what was allocated here so prvDeleteTCB() only
+				frees that. */
+				if( pxTaskBuffer != NULL )
+				{
+					pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+				}
+				else if( puxStackBuffer != NULL )
+				{
+					pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_ONLY;
+				}
+				else
+				{
+					pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
+				}
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+		}
+	}
+
+	return pxNewTCB;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	static unsigned portBASE_TYPE prvListTaskWithinSingleList( xTaskStatusType *pxTaskStatusArray, xList *pxList, eTaskState eState )
+	{
+	volatile tskTCB *pxNextTCB, *pxFirstTCB;
+	unsigned portBASE_TYPE uxTask = 0;
+
+		if( listCURRENT_LIST_LENGTH( pxList ) > ( unsigned portBASE_TYPE ) 0 )
+		{
+			listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList );
+
+			/* Populate an xTaskStatusType structure within the
+			pxTaskStatusArray array for each task that is referenced from
+			pxList.  See the definition of xTaskStatusType in task.h for the
+			meaning of each xTaskStatusType structure member. */
+			do
+			{
+				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList );
+
+				pxTaskStatusArray[ uxTask ].xHandle = ( xTaskHandle ) pxNextTCB;
+				pxTaskStatusArray[ uxTask ].pcTaskName = ( const signed char * ) &( pxNextTCB->pcTaskName [ 0 ] );
+				pxTaskStatusArray[ uxTask ].xTaskNumber = pxNextTCB->uxTCBNumber;
+				pxTaskStatusArray[ uxTask ].eCurrentState = eState;
+				pxTaskStatusArray[ uxTask ].uxCurrentPriority = pxNextTCB->uxPriority;
+
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					pxTaskStatusArray[ uxTask ].uxBasePriority = pxNextTCB->uxBasePriority;
+				}
+				#else
+				{
+					pxTaskStatusArray[ uxTask ].uxBasePriority = 0;
+				}
+				#endif
+
+				#if ( configGENERATE_RUN_TIME_STATS == 1 )
+				{
+					/* The counter is 64 bits wide and a registered interrupt
+					can charge time to it, so it is copied with interrupts
+					masked.  The time since it was last charged is added first
+					so the figure for the running task is current. */
+					taskENTER_CRITICAL();
+					{
+						prvChargeRunTime();
+						pxTaskStatusArray[ uxTask ].ullRunTimeCounter = pxNextTCB->ullRunTimeCounter;
+					}
+					taskEXIT_CRITICAL();
+				}
+				#else
+				{
+					pxTaskStatusArray[ uxTask ].ullRunTimeCounter = 0;
+				}
+				#endif
+
+				#if ( portSTACK_GROWTH > 0 )
+				{
+					ppxTaskStatusArray[ uxTask ].usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( unsigned char * ) pxNextTCB->pxEndOfStack );
+				}
+				#else
+				{
+					pxTaskStatusArray[ uxTask ].usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( unsigned char * ) pxNextTCB->pxStack );
+				}
+				#endif
+
+				uxTask++;
+
+			} while( pxNextTCB != pxFirstTCB );
+		}
+
+		return uxTask;
 	}
 
 #endif /* configUSE_TRACE_FACILITY */
@@ -2573,35 +4775,155 @@ tskTCB *pxNewTCB;
 
 	static void prvDeleteTCB( tskTCB *pxTCB )
 	{
+	portBASE_TYPE xKept = pdFALSE;
+
 		/* This call is required specifically for the TriCore port.  It must be
 		above the vPortFree() calls.  The call is also used by ports/demos that
 		want to allocate and clean RAM statically. */
 		portCLEAN_UP_TCB( pxTCB );
 
+		#if ( configTASK_POOL_SIZE > 0 )
+		{
+			xKept = prvAddToTaskPool( pxTCB );
+		}
+		#endif /* configTASK_POOL_SIZE */
+
 		/* Free up the memory allocated by the scheduler for the task.  It is up to
 		the task to free any memory allocated at the application level. */
-		vPortFreeAligned( pxTCB->pxStack );
-		vPortFree( pxTCB );
+		if( xKept == pdFALSE )
+		{
+			#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* Memory provided by the application is left alone - it can be
+				reused once the task has been cleaned up. */
+				if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+				{
+					vPortFreeAligned( pxTCB->pxStack );
+					vPortFree( pxTCB );
+				}
+				else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+				{
+					vPortFree( pxTCB );
+				}
+				else
+				{
+					configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
+				}
+			}
+			#else /* configSUPPORT_STATIC_ALLOCATION */
+			{
+				vPortFreeAligned( pxTCB->pxStack );
+				vPortFree( pxTCB );
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+		}
 	}
+	/*-----------------------------------------------------------*/
+
+	#if ( configTASK_POOL_SIZE > 0 )
+
+		static portBASE_TYPE prvAddToTaskPool( tskTCB *pxTCB )
+		{
+		portBASE_TYPE xReturn = pdFALSE, xOwned = pdTRUE;
+
+			#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* Only memory the kernel allocated is its own to keep. */
+				if( pxTCB->ucStaticallyAllocated != tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+				{
+					xOwned = pdFALSE;
+				}
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+			taskENTER_CRITICAL();
+			{
+				if( ( xOwned != pdFALSE ) && ( listCURRENT_LIST_LENGTH( &xTaskPool ) < ( unsigned portBASE_TYPE ) configTASK_POOL_SIZE ) )
+				{
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ), ( portTickType ) pxTCB->usStackDepth );
+					vListInsert( &xTaskPool, &( pxTCB->xGenericListItem ) );
+					xReturn = pdTRUE;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			return xReturn;
+		}
+		/*-----------------------------------------------------------*/
+
+		static tskTCB *prvTakeFromTaskPool( unsigned short usStackDepth )
+		{
+		tskTCB *pxTCB = NULL;
+		xListItem *pxItem;
+
+			/* The pool is only initialised with the other lists, when the
+			first task is created, but is empty until a task is deleted. */
+			if( listLIST_IS_EMPTY( &xTaskPool ) == pdFALSE )
+			{
+				taskENTER_CRITICAL();
+				{
+					/* The pool is sorted smallest stack first, and the end
+					marker's value of portMAX_DELAY stops the search, so the
+					first stack found is the smallest that is large enough.
+					The pool holds at most configTASK_POOL_SIZE entries. */
+					for( pxItem = xTaskPool.xListEnd.pxNext; listGET_LIST_ITEM_VALUE( pxItem ) < ( portTickType ) usStackDepth; pxItem = pxItem->pxNext )
+					{
+						/* There is nothing to do here. */
+					}
+
+					if( ( void * ) pxItem != ( void * ) &( xTaskPool.xListEnd ) )
+					{
+						pxTCB = ( tskTCB * ) listGET_LIST_ITEM_OWNER( pxItem );
+						( void ) uxListRemove( pxItem );
+					}
+				}
+				taskEXIT_CRITICAL();
+			}
+
+			if( pxTCB != NULL )
+			{
+				/* Just to help debugging. */
+				( void ) memset( pxTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) usStackDepth * sizeof( portSTACK_TYPE ) );
+			}
+
+			return pxTCB;
+		}
+
+	#endif /* configTASK_POOL_SIZE */
 
 #endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) || ( configNUM_CORES > 1 ) )
 
 	xTaskHandle xTaskGetCurrentTaskHandle( void )
 	{
 	xTaskHandle xReturn;
 
-		/* A critical section is not required as this is not called from
-		an interrupt and the current TCB will always be the same for any
-		individual execution thread. */
-		xReturn = pxCurrentTCB;
+		#if ( configNUM_CORES == 1 )
+		{
+			/* A critical section is not required as this is not called from
+			an interrupt and the current TCB will always be the same for any
+			individual execution thread. */
+			xReturn = pxCurrentTCB;
+		}
+		#else
+		{
+		unsigned portBASE_TYPE uxSavedInterruptStatus;
+
+			/* The calling task must not be switched out, and so possibly
+			moved to another core, between reading the core ID and reading
+			the array.  The kernel lock is not needed to read one entry. */
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+			xReturn = pxCurrentTCBs[ portGET_CORE_ID() ];
+			portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+		}
+		#endif /* configNUM_CORES */
 
 		return xReturn;
 	}
 
-#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) || ( configNUM_CORES > 1 ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
@@ -2609,6 +4931,9 @@ tskTCB *pxNewTCB;
 	portBASE_TYPE xTaskGetSchedulerState( void )
 	{
 	portBASE_TYPE xReturn;
+	#if ( configNUM_CORES > 1 )
+		unsigned portBASE_TYPE uxSavedInterruptStatus;
+	#endif
 
 		if( xSchedulerRunning == pdFALSE )
 		{
@@ -2616,6 +4941,15 @@ tskTCB *pxNewTCB;
 		}
 		else
 		{
+			#if ( configNUM_CORES > 1 )
+			{
+				/* As in xTaskGetCurrentTaskHandle(), the calling task must not
+				be moved to another core between reading the core ID and
+				reading the count. */
+				uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+			}
+			#endif /* configNUM_CORES */
+
 			if( uxSchedulerSuspended == ( unsigned portBASE_TYPE ) pdFALSE )
 			{
 				xReturn = taskSCHEDULER_RUNNING;
@@ -2624,6 +4958,12 @@ tskTCB *pxNewTCB;
 			{
 				xReturn = taskSCHEDULER_SUSPENDED;
 			}
+
+			#if ( configNUM_CORES > 1 )
+			{
+				portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+			}
+			#endif /* configNUM_CORES */
 		}
 
 		return xReturn;
@@ -2634,41 +4974,192 @@ tskTCB *pxNewTCB;
 
 #if ( configUSE_MUTEXES == 1 )
 
-	void vTaskPriorityInherit( xTaskHandle const pxMutexHolder )
+	static unsigned portBASE_TYPE prvGetInheritedPriority( const tskTCB * const pxTCB )
 	{
-	tskTCB * const pxTCB = ( tskTCB * ) pxMutexHolder;
+	unsigned portBASE_TYPE uxPriority = taskPRIORITY_FLOOR( pxTCB ), uxWaiterPriority;
+	const xListItem *pxItem;
+	const xList *pxWaitingTasks;
 
-		/* If the mutex was given back by an interrupt while the queue was
-		locked then the mutex holder might now be NULL. */
-		if( pxMutexHolder != NULL )
+		for( pxItem = ( const xListItem * ) pxTCB->xMutexesHeld.xListEnd.pxNext; pxItem != ( const xListItem * ) &( pxTCB->xMutexesHeld.xListEnd ); pxItem = pxItem->pxNext ) /*lint !e826 !e740 The mini list end is only compared, not dereferenced as a list item. */
 		{
-			if( pxTCB->uxPriority < pxCurrentTCB->uxPriority )
+			/* The owner of each item is the list of tasks blocked on the
+			mutex, which is kept in priority order. */
+			pxWaitingTasks = ( const xList * ) listGET_LIST_ITEM_OWNER( pxItem );
+
+			if( listLIST_IS_EMPTY( pxWaitingTasks ) == pdFALSE )
 			{
-				/* Adjust the mutex holder state to account for its new priority. */
-				listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( portTickType ) configMAX_PRIORITIES - ( portTickType ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				uxWaiterPriority = ( ( tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( pxWaitingTasks ) )->uxPriority;
 
-				/* If the task being modified is in the ready state it will need to
-				be moved into a new list. */
-				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
+				if( uxWaiterPriority > uxPriority )
 				{
-					if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
-					{
-						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-					}
-
-					/* Inherit the priority before being moved into the new list. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
-					prvAddTaskToReadyList( pxTCB );
+					uxPriority = uxWaiterPriority;
+				}
+			}
+		}
+
+		return uxPriority;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	static void prvSetInheritedPriority( tskTCB * const pxTCB, unsigned portBASE_TYPE uxNewPriority )
+	{
+	xList *pxEventList;
+	#if ( configNUM_CORES > 1 )
+		const unsigned portBASE_TYPE uxPriorityUsedOnEntry = pxTCB->uxPriority;
+	#endif
+
+		/* Only reset the event list item value if the value is not being used
+		for anything else. */
+		if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( portTickType ) configMAX_PRIORITIES - ( portTickType ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+			/* A task blocked on a mutex, or on a queue, is moved to its new
+			place in the event list so the highest priority waiter remains
+			at the head. */
+			pxEventList = ( xList * ) listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
+
+			if( ( pxEventList != NULL ) && ( pxEventList != &xPendingReadyList ) )
+			{
+				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				vListInsert( pxEventList, &( pxTCB->xEventListItem ) );
+			}
+		}
+
+		/* If the task being modified is in the ready state it will need to
+		be moved into a new list. */
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
+		{
+			if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
+			{
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+			}
+
+			pxTCB->uxPriority = uxNewPriority;
+			prvAddTaskToReadyList( pxTCB );
+		}
+		else
+		{
+			pxTCB->uxPriority = uxNewPriority;
+		}
+
+		#if ( configNUM_CORES > 1 )
+		{
+			/* Another core may now have to start running the task, or stop
+			running it.  The calling core is either running the task or about
+			to block, so is not asked to yield here. */
+			if( uxNewPriority > uxPriorityUsedOnEntry )
+			{
+				( void ) prvYieldForTask( pxTCB, pdFALSE );
+			}
+			else
+			{
+				prvYieldCoreRunningTask( pxTCB );
+			}
+		}
+		#endif /* configNUM_CORES */
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void *pvTaskMutexTaken( xListItem * const pxMutexItem )
+	{
+		return pvTaskMutexGivenTo( ( xTaskHandle ) pxCurrentTCB, pxMutexItem );
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void *pvTaskMutexGivenTo( xTaskHandle xTask, xListItem * const pxMutexItem )
+	{
+	tskTCB * const pxTCB = ( tskTCB * ) xTask;
+	const xList * const pxWaitingTasks = ( const xList * ) listGET_LIST_ITEM_OWNER( pxMutexItem );
+	const tskTCB *pxWaitingTCB;
+
+		vListInsertEnd( &( pxTCB->xMutexesHeld ), pxMutexItem );
+
+		/* Tasks still blocked on the mutex normally have a lower priority
+		than the task that took it, but on a multicore system, after a
+		priority change, or when the mutex is passed to a task that has not
+		run yet, that need not be so. */
+		if( listLIST_IS_EMPTY( pxWaitingTasks ) == pdFALSE )
+		{
+			pxWaitingTCB = ( const tskTCB * ) listGET_OWNER_OF_HEAD_ENTRY( pxWaitingTasks );
+
+			if( pxWaitingTCB->uxPriority > pxTCB->uxPriority )
+			{
+				traceTASK_PRIORITY_INHERIT( pxTCB, pxWaitingTCB->uxPriority );
+				prvSetInheritedPriority( pxTCB, pxWaitingTCB->uxPriority );
+			}
+		}
+
+		return pxTCB;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskSetMutexWaitedOn( void *pvMutex )
+	{
+		( ( tskTCB * ) pxCurrentTCB )->pvMutexWaitedOn = pvMutex;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void *pvTaskPriorityInherit( xTaskHandle const pxMutexHolder )
+	{
+	tskTCB * const pxTCB = ( tskTCB * ) pxMutexHolder;
+	unsigned portBASE_TYPE uxNewPriority;
+	const void *pvContainer;
+	void *pvReturn = NULL;
+
+		/* If the mutex was given back by an interrupt while the queue was
+		locked then the mutex holder might now be NULL. */
+		if( pxMutexHolder != NULL )
+		{
+			uxNewPriority = prvGetInheritedPriority( pxTCB );
+
+			if( uxNewPriority != pxTCB->uxPriority )
+			{
+				if( uxNewPriority > pxTCB->uxPriority )
+				{
+					traceTASK_PRIORITY_INHERIT( pxTCB, uxNewPriority );
 				}
 				else
 				{
-					/* Just inherit the priority. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
+					traceTASK_PRIORITY_DISINHERIT( pxTCB, uxNewPriority );
 				}
 
-				traceTASK_PRIORITY_INHERIT( pxTCB, pxCurrentTCB->uxPriority );
+				prvSetInheritedPriority( pxTCB, uxNewPriority );
+
+				/* If the holder is itself blocked on a mutex then the holder
+				of that mutex has to be brought into line too.
+				pvMutexWaitedOn is only cleared once the task runs again, so
+				check the task is still in an event list. */
+				pvContainer = listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
+
+				if( ( pvContainer != NULL ) && ( pvContainer != ( void * ) &xPendingReadyList ) )
+				{
+					pvReturn = pxTCB->pvMutexWaitedOn;
+				}
 			}
 		}
+
+		return pvReturn;
 	}
 
 #endif /* configUSE_MUTEXES */
@@ -2676,34 +5167,101 @@ tskTCB *pxNewTCB;
 
 #if ( configUSE_MUTEXES == 1 )
 
-	void vTaskPriorityDisinherit( xTaskHandle const pxMutexHolder )
+	portBASE_TYPE xTaskPriorityDisinherit( xTaskHandle const pxMutexHolder, xListItem * const pxMutexItem )
 	{
 	tskTCB * const pxTCB = ( tskTCB * ) pxMutexHolder;
+	unsigned portBASE_TYPE uxNewPriority, uxPriorityUsedOnEntry, uxPriority;
+	portBASE_TYPE xYieldRequired = pdFALSE;
 
 		if( pxMutexHolder != NULL )
 		{
-			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
+			if( listLIST_ITEM_CONTAINER( pxMutexItem ) != NULL )
 			{
-				/* We must be the running task to be able to give the mutex back.
-				Remove ourselves from the ready list we currently appear in. */
-				if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( unsigned portBASE_TYPE ) 0 )
+				( void ) uxListRemove( pxMutexItem );
+			}
+
+			/* The task keeps any priority inherited through the other
+			mutexes it holds. */
+			uxNewPriority = prvGetInheritedPriority( pxTCB );
+			uxPriorityUsedOnEntry = pxTCB->uxPriority;
+
+			if( uxNewPriority != uxPriorityUsedOnEntry )
+			{
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, uxNewPriority );
+				prvSetInheritedPriority( pxTCB, uxNewPriority );
+
+				/* Tasks readied while the priority was raised have a priority
+				no higher than it, so only the priorities the task has just
+				dropped below need to be checked. */
+				if( pxTCB == pxCurrentTCB )
 				{
-					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+					for( uxPriority = uxNewPriority + ( unsigned portBASE_TYPE ) 1U; uxPriority <= uxPriorityUsedOnEntry; uxPriority++ )
+					{
+						if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxPriority ] ) ) > ( unsigned portBASE_TYPE ) 0U )
+						{
+							xYieldRequired = pdTRUE;
+						}
+					}
 				}
-
-				/* Disinherit the priority before adding the task into the new
-				ready list. */
-				traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
-				pxTCB->uxPriority = pxTCB->uxBasePriority;
-				listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( portTickType ) configMAX_PRIORITIES - ( portTickType ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-				prvAddTaskToReadyList( pxTCB );
 			}
 		}
+
+		return xYieldRequired;
 	}
 
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+
+	unsigned portBASE_TYPE uxTaskPriorityRaiseToCeiling( unsigned portBASE_TYPE uxCeilingPriority )
+	{
+	tskTCB * const pxTCB = ( tskTCB * ) pxCurrentTCB;
+	unsigned portBASE_TYPE uxPreviousCeiling;
+
+		/* The ceiling must be at least the priority of every task that takes
+		the mutex, otherwise a higher priority task can still block on it. */
+		configASSERT( uxCeilingPriority < ( unsigned portBASE_TYPE ) configMAX_PRIORITIES );
+		configASSERT( pxTCB->uxBasePriority <= uxCeilingPriority );
+
+		uxPreviousCeiling = pxTCB->uxCeilingPriority;
+
+		if( uxCeilingPriority > uxPreviousCeiling )
+		{
+			pxTCB->uxCeilingPriority = uxCeilingPriority;
+		}
+
+		/* The running task was already the highest priority task able to
+		run, so raising it further cannot require a yield. */
+		if( pxTCB->uxPriority < uxCeilingPriority )
+		{
+			traceTASK_PRIORITY_INHERIT( pxTCB, uxCeilingPriority );
+			prvSetInheritedPriority( pxTCB, uxCeilingPriority );
+		}
+
+		return uxPreviousCeiling;
+	}
+
+#endif /* configUSE_PRIORITY_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+
+	void vTaskPriorityRestoreCeiling( xTaskHandle const pxMutexHolder, unsigned portBASE_TYPE uxPreviousCeiling )
+	{
+		/* Each mutex restores the ceiling that was in force when it was
+		taken, so ceiling mutexes must be given back in the reverse order to
+		that in which they were taken.  The priority itself is dropped by
+		xTaskPriorityDisinherit(). */
+		if( pxMutexHolder != NULL )
+		{
+			( ( tskTCB * ) pxMutexHolder )->uxCeilingPriority = uxPreviousCeiling;
+		}
+	}
+
+#endif /* configUSE_PRIORITY_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( portCRITICAL_NESTING_IN_TCB == 1 )
 
 	void vTaskEnterCritical( void )
@@ -2828,8 +5386,9 @@ tskTCB *pxNewTCB;
 	void vTaskGetRunTimeStats( signed char *pcWriteBuffer )
 	{
 	xTaskStatusType *pxTaskStatusArray;
+	xISRStatusType *pxISRStatusArray;
 	volatile unsigned portBASE_TYPE uxArraySize, x;
-	unsigned long ulTotalTime, ulStatsAsPercentage;
+	unsigned long long ullTotalTime;
 
 		/*
 		 * PLEASE NOTE:
@@ -2869,54 +5428,38 @@ tskTCB *pxNewTCB;
 		if( pxTaskStatusArray != NULL )
 		{
 			/* Generate the (binary) data. */
-			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ullTotalTime );
 
 			/* For percentage calculations. */
-			ulTotalTime /= 100UL;
+			ullTotalTime /= 100ULL;
 
 			/* Avoid divide by zero errors. */
-			if( ulTotalTime > 0 )
+			if( ullTotalTime > 0ULL )
 			{
 				/* Create a human readable table from the binary data. */
 				for( x = 0; x < uxArraySize; x++ )
 				{
-					/* What percentage of the total run time has the task used?
-					This will always be rounded down to the nearest integer.
-					ulTotalRunTimeDiv100 has already been divided by 100. */
-					ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
+					pcWriteBuffer = prvWriteRunTimeStatsLine( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ullRunTimeCounter, ullTotalTime );
+				}
 
-					if( ulStatsAsPercentage > 0UL )
-					{
-						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-						{
-							sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
-						}
-						#else
-						{
-							/* sizeof( int ) == sizeof( long ) so a smaller
-							printf() library can be used. */
-							sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%u\t\t%u%%\r\n", pxTaskStatusArray[ x ].pcTaskName, ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage );
-						}
-						#endif
-					}
-					else
+				/* Then the same for each registered interrupt.  Interrupts
+				registered after this point are left out. */
+				uxArraySize = uxISRRunTimeStatsCount;
+				if( uxArraySize > ( unsigned portBASE_TYPE ) 0U )
+				{
+					pxISRStatusArray = pvPortMalloc( uxArraySize * sizeof( xISRStatusType ) );
+
+					if( pxISRStatusArray != NULL )
 					{
-						/* If the percentage is zero here then the task has
-						consumed less than 1% of the total run time. */
-						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-						{
-							sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter );
-						}
-						#else
+						uxArraySize = uxTaskGetISRSystemState( pxISRStatusArray, uxArraySize );
+
+						for( x = 0; x < uxArraySize; x++ )
 						{
-							/* sizeof( int ) == sizeof( long ) so a smaller
-							printf() library can be used. */
-							sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%u\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter );
+							pcWriteBuffer = prvWriteRunTimeStatsLine( pcWriteBuffer, pxISRStatusArray[ x ].pcISRName, pxISRStatusArray[ x ].ullRunTimeCounter, ullTotalTime );
 						}
-						#endif
-					}
 
-					pcWriteBuffer += strlen( ( char * ) pcWriteBuffer );
+						vPortFree( pxISRStatusArray );
+					}
 				}
 			}
 
@@ -2924,8 +5467,749 @@ tskTCB *pxNewTCB;
 			vPortFree( pxTaskStatusArray );
 		}
 	}
+	/*-----------------------------------------------------------*/
+
+	static signed char *prvWriteRunTimeStatsLine( signed char *pcWriteBuffer, const signed char *pcName, unsigned long long ullRunTime, unsigned long long ullTotalTimeDiv100 )
+	{
+	char cRunTime[ 21 ];
+	unsigned portBASE_TYPE uxDigit = sizeof( cRunTime ) - 1U;
+	unsigned long ulStatsAsPercentage;
+
+		/* What percentage of the total run time has been used?  This will
+		always be rounded down to the nearest integer. */
+		ulStatsAsPercentage = ( unsigned long ) ( ullRunTime / ullTotalTimeDiv100 );
+
+		/* The run time is converted to decimal here rather than passed to
+		sprintf(), as the smaller printf() libraries cannot format 64-bit
+		values. */
+		cRunTime[ uxDigit ] = 0x00;
+		do
+		{
+			uxDigit--;
+			cRunTime[ uxDigit ] = ( char ) ( '0' + ( char ) ( ullRunTime % 10ULL ) );
+			ullRunTime /= 10ULL;
+		} while( ullRunTime > 0ULL );
+
+		if( ulStatsAsPercentage > 0UL )
+		{
+			#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
+			{
+				sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%s\t\t%lu%%\r\n", pcName, &( cRunTime[ uxDigit ] ), ulStatsAsPercentage );
+			}
+			#else
+			{
+				/* sizeof( int ) == sizeof( long ) so a smaller
+				printf() library can be used. */
+				sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%s\t\t%u%%\r\n", pcName, &( cRunTime[ uxDigit ] ), ( unsigned int ) ulStatsAsPercentage );
+			}
+			#endif
+		}
+		else
+		{
+			/* If the percentage is zero here then less than 1% of the total
+			run time has been used. */
+			sprintf( ( char * ) pcWriteBuffer, ( char * ) "%s\t\t%s\t\t<1%%\r\n", pcName, &( cRunTime[ uxDigit ] ) );
+		}
+
+		return pcWriteBuffer + strlen( ( char * ) pcWriteBuffer );
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	static void prvChargeRunTime( void )
+	{
+	unsigned long ulNow, ulElapsed;
+
+		taskGET_RUN_TIME_COUNTER_VALUE( ulNow );
+		ulElapsed = ulNow - ulRunTimeStamp;
+		ulRunTimeStamp = ulNow;
+
+		/* Nothing is charged before the scheduler has started. */
+		if( pullRunTimeCounterCharged != NULL )
+		{
+			*pullRunTimeCounterCharged += ulElapsed;
+			ullTotalRunTime += ulElapsed;
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskRegisterISRRunTimeStats( xISRRunTimeStats *pxISRStats, const signed char *pcISRName )
+	{
+		configASSERT( pxISRStats );
+
+		pxISRStats->pcISRName = pcISRName;
+		pxISRStats->ullRunTimeCounter = 0ULL;
+		pxISRStats->ulEntryCount = 0UL;
+
+		#if ( configRECORD_WAKE_LATENCY == 1 )
+		{
+			memset( ( void * ) &( pxISRStats->xWakeLatency ), 0x00, sizeof( xWakeLatencyStats ) );
+		}
+		#endif /* configRECORD_WAKE_LATENCY */
+
+		taskENTER_CRITICAL();
+		{
+			pxISRStats->pxNext = pxISRRunTimeStatsList;
+			pxISRRunTimeStatsList = pxISRStats;
+			uxISRRunTimeStatsCount++;
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	unsigned long long *pullTaskEnterISRRunTime( xISRRunTimeStats *pxISRStats )
+	{
+	unsigned long long *pullInterruptedRunTime;
+	unsigned portBASE_TYPE uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			/* Charge the time up to now to whatever was interrupted, a task or
+			another registered interrupt, then charge from now to this one. */
+			prvChargeRunTime();
+			pullInterruptedRunTime = pullRunTimeCounterCharged;
+			pullRunTimeCounterCharged = &( pxISRStats->ullRunTimeCounter );
+			( pxISRStats->ulEntryCount )++;
+
+			#if ( configRECORD_WAKE_LATENCY == 1 )
+			{
+				/* prvChargeRunTime() has just read the clock. */
+				pxISRStats->ulEntryTime = ulRunTimeStamp;
+				pxISRStats->pxInterruptedISR = pxWakeSource;
+				pxWakeSource = pxISRStats;
+			}
+			#endif /* configRECORD_WAKE_LATENCY */
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return pullInterruptedRunTime;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskExitISRRunTime( unsigned long long *pullInterruptedRunTime )
+	{
+	unsigned portBASE_TYPE uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			prvChargeRunTime();
+			pullRunTimeCounterCharged = pullInterruptedRunTime;
+
+			#if ( configRECORD_WAKE_LATENCY == 1 )
+			{
+				/* Registered interrupts exit in the reverse order they were
+				entered, so the one exiting is the innermost. */
+				configASSERT( pxWakeSource );
+				pxWakeSource = pxWakeSource->pxInterruptedISR;
+			}
+			#endif /* configRECORD_WAKE_LATENCY */
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	/*-----------------------------------------------------------*/
+
+	unsigned portBASE_TYPE uxTaskGetISRSystemState( xISRStatusType *pxISRStatusArray, unsigned portBASE_TYPE uxArraySize )
+	{
+	unsigned portBASE_TYPE uxISR = 0U;
+	xISRRunTimeStats *pxISRStats;
+
+		/* Interrupts are only ever added to the front of the list, so it can
+		be walked without holding a critical section throughout. */
+		pxISRStats = pxISRRunTimeStatsList;
+
+		while( ( pxISRStats != NULL ) && ( uxISR < uxArraySize ) )
+		{
+			pxISRStatusArray[ uxISR ].pcISRName = pxISRStats->pcISRName;
+
+			taskENTER_CRITICAL();
+			{
+				prvChargeRunTime();
+				pxISRStatusArray[ uxISR ].ullRunTimeCounter = pxISRStats->ullRunTimeCounter;
+				pxISRStatusArray[ uxISR ].ulEntryCount = pxISRStats->ulEntryCount;
+			}
+			taskEXIT_CRITICAL();
+
+			uxISR++;
+			pxISRStats = pxISRStats->pxNext;
+		}
+
+		return uxISR;
+	}
 
 #endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( configRECORD_SECTION_LATENCY == 1 )
+
+	void vTaskSectionLatencyStart( eLatencySection eSection, void *pvCaller )
+	{
+		/* On the POSIX port a task can yield inside a critical section and
+		the next task enter one of its own.  Only the first start is timed. */
+		if( pvSectionCaller[ eSection ] == NULL )
+		{
+			pvSectionCaller[ eSection ] = pvCaller;
+			taskGET_RUN_TIME_COUNTER_VALUE( ulSectionStartTime[ eSection ] );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskSectionLatencyEnd( eLatencySection eSection )
+	{
+	unsigned long ulNow;
+
+		if( pvSectionCaller[ eSection ] != NULL )
+		{
+			taskGET_RUN_TIME_COUNTER_VALUE( ulNow );
+			prvRecordSectionLatency( &( xSectionLatency[ eSection ] ), ulNow - ulSectionStartTime[ eSection ], pvSectionCaller[ eSection ] );
+			pvSectionCaller[ eSection ] = NULL;
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvRecordSectionLatency( xSectionLatencyStats *pxStats, unsigned long ulLength, void *pvCaller )
+	{
+	unsigned portBASE_TYPE uxEntry;
+
+		( pxStats->ulCount )++;
+		( pxStats->ulHistogram[ prvLatencyBucket( ulLength ) ] )++;
+
+		/* Each call site has at most one entry, its longest section.  If this
+		call site has no entry it can only displace the shortest, which is
+		always the last as the table is kept longest first. */
+		for( uxEntry = 0U; uxEntry < ( unsigned portBASE_TYPE ) ( configSECTION_LATENCY_TOP_N - 1 ); uxEntry++ )
+		{
+			if( pxStats->xLongest[ uxEntry ].pvCaller == pvCaller )
+			{
+				break;
+			}
+		}
+
+		if( ( ulLength > pxStats->xLongest[ uxEntry ].ulLength ) || ( pxStats->xLongest[ uxEntry ].pvCaller == NULL ) )
+		{
+			/* Move the entry up past any that are now shorter. */
+			while( ( uxEntry > 0U ) && ( pxStats->xLongest[ uxEntry - 1U ].ulLength < ulLength ) )
+			{
+				pxStats->xLongest[ uxEntry ] = pxStats->xLongest[ uxEntry - 1U ];
+				uxEntry--;
+			}
+
+			pxStats->xLongest[ uxEntry ].ulLength = ulLength;
+			pxStats->xLongest[ uxEntry ].pvCaller = pvCaller;
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskGetSectionLatencyStats( eLatencySection eSection, xSectionLatencyStats *pxStats )
+	{
+		taskENTER_CRITICAL();
+		{
+			*pxStats = xSectionLatency[ eSection ];
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskResetSectionLatencyStats( eLatencySection eSection )
+	{
+		taskENTER_CRITICAL();
+		{
+			memset( ( void * ) &( xSectionLatency[ eSection ] ), 0x00, sizeof( xSectionLatencyStats ) );
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configRECORD_SECTION_LATENCY */
+/*-----------------------------------------------------------*/
+
+#if ( configRECORD_SECTION_LATENCY == 1 ) || ( configRECORD_WAKE_LATENCY == 1 )
+
+	static unsigned portBASE_TYPE prvLatencyBucket( unsigned long ulLength )
+	{
+	unsigned portBASE_TYPE uxBucket = 0U, uxShift;
+
+		/* The bucket is the position of the most significant bit set, found
+		by halving the range still to be searched. */
+		for( uxShift = 16U; uxShift > 0U; uxShift >>= 1U )
+		{
+			if( ( ulLength >> uxShift ) != 0UL )
+			{
+				ulLength >>= uxShift;
+				uxBucket += uxShift;
+			}
+		}
+
+		return uxBucket;
+	}
+
+#endif
+/*-----------------------------------------------------------*/
+
+#if ( configRECORD_WAKE_LATENCY == 1 )
+
+	static void prvRecordWakeLatency( tskTCB *pxTCB )
+	{
+	xWakeLatencyStats * const pxStats = &( pxTCB->pxWakeSource->xWakeLatency );
+	unsigned long ulNow, ulLatency;
+
+		taskGET_RUN_TIME_COUNTER_VALUE( ulNow );
+		ulLatency = ulNow - pxTCB->ulWakeTime;
+		pxTCB->pxWakeSource = NULL;
+
+		if( ( pxStats->ulCount == 0UL ) || ( ulLatency < pxStats->ulMin ) )
+		{
+			pxStats->ulMin = ulLatency;
+		}
+
+		if( ( pxStats->ulCount == 0UL ) || ( ulLatency > pxStats->ulMax ) )
+		{
+			pxStats->ulMax = ulLatency;
+			pxStats->xMaxTask = ( xTaskHandle ) pxTCB;
+		}
+
+		( pxStats->ulCount )++;
+		pxStats->ullTotal += ulLatency;
+		( pxStats->ulHistogram[ prvLatencyBucket( ulLatency ) ] )++;
+	}
+	/*-----------------------------------------------------------*/
+
+	unsigned portBASE_TYPE uxTaskGetWakeLatencyStats( xWakeLatencyStatus *pxWakeLatencyArray, unsigned portBASE_TYPE uxArraySize )
+	{
+	unsigned portBASE_TYPE uxISR = 0U;
+	xISRRunTimeStats *pxISRStats;
+
+		/* As in uxTaskGetISRSystemState(), the list only grows at the front. */
+		pxISRStats = pxISRRunTimeStatsList;
+
+		while( ( pxISRStats != NULL ) && ( uxISR < uxArraySize ) )
+		{
+			pxWakeLatencyArray[ uxISR ].pcISRName = pxISRStats->pcISRName;
+
+			taskENTER_CRITICAL();
+			{
+				pxWakeLatencyArray[ uxISR ].xStats = pxISRStats->xWakeLatency;
+			}
+			taskEXIT_CRITICAL();
+
+			uxISR++;
+			pxISRStats = pxISRStats->pxNext;
+		}
+
+		return uxISR;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskResetWakeLatencyStats( void )
+	{
+	xISRRunTimeStats *pxISRStats;
+
+		for( pxISRStats = pxISRRunTimeStatsList; pxISRStats != NULL; pxISRStats = pxISRStats->pxNext )
+		{
+			taskENTER_CRITICAL();
+			{
+				memset( ( void * ) &( pxISRStats->xWakeLatency ), 0x00, sizeof( xWakeLatencyStats ) );
+			}
+			taskEXIT_CRITICAL();
+		}
+	}
+
+#endif /* configRECORD_WAKE_LATENCY */
+/*-----------------------------------------------------------*/
+
+portTickType uxTaskResetEventItemValue( void )
+{
+portTickType uxReturn;
+
+	uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+
+	/* Reset the event list item to its normal value - so it can be used with
+	queues and semaphores. */
+	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( portTickType ) configMAX_PRIORITIES - ( portTickType ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	unsigned long ulTaskNotifyTake( portBASE_TYPE xClearCountOnExit, portTickType xTicksToWait )
+	{
+	unsigned long ulReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* Only block if the notification count is not already non-zero. */
+			if( pxCurrentTCB->ulNotifiedValue == 0UL )
+			{
+				/* Mark this task as waiting for a notification. */
+				pxCurrentTCB->eNotifyState = eWaitingNotification;
+
+				if( xTicksToWait > ( portTickType ) 0 )
+				{
+					prvBlockCurrentTaskOnNotification( xTicksToWait );
+					traceTASK_NOTIFY_TAKE_BLOCK();
+
+					/* All ports are written to allow a yield in a critical
+					section (some will yield immediately, others wait until the
+					critical section exits) - but it is not something that
+					application code should ever do. */
+					portYIELD_WITHIN_API();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		taskENTER_CRITICAL();
+		{
+			traceTASK_NOTIFY_TAKE();
+
+			/* The count, not eNotifyState, says whether a notification was
+			received.  A task whose wait was cancelled by vTaskSuspend() and
+			that has since been resumed still finds the count at zero. */
+			ulReturn = pxCurrentTCB->ulNotifiedValue;
+
+			if( ulReturn != 0UL )
+			{
+				if( xClearCountOnExit != pdFALSE )
+				{
+					pxCurrentTCB->ulNotifiedValue = 0UL;
+				}
+				else
+				{
+					( pxCurrentTCB->ulNotifiedValue )--;
+				}
+			}
+
+			pxCurrentTCB->eNotifyState = eNotWaitingNotification;
+		}
+		taskEXIT_CRITICAL();
+
+		return ulReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	portBASE_TYPE xTaskNotifyWait( unsigned long ulBitsToClearOnEntry, unsigned long ulBitsToClearOnExit, unsigned long *pulNotificationValue, portTickType xTicksToWait )
+	{
+	portBASE_TYPE xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* Only block if a notification is not already pending. */
+			if( pxCurrentTCB->eNotifyState != eNotified )
+			{
+				/* Clear bits in the task's notification value as bits may get
+				set by the notifying task or interrupt.  This can be used to
+				clear the value to zero. */
+				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnEntry;
+
+				/* Mark this task as waiting for a notification. */
+				pxCurrentTCB->eNotifyState = eWaitingNotification;
+
+				if( xTicksToWait > ( portTickType ) 0 )
+				{
+					prvBlockCurrentTaskOnNotification( xTicksToWait );
+					traceTASK_NOTIFY_WAIT_BLOCK();
+
+					/* See the comment in ulTaskNotifyTake() regarding yielding
+					from within a critical section. */
+					portYIELD_WITHIN_API();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		taskENTER_CRITICAL();
+		{
+			traceTASK_NOTIFY_WAIT();
+
+			if( pulNotificationValue != NULL )
+			{
+				/* Output the current notification value, which may or may not
+				have changed. */
+				*pulNotificationValue = pxCurrentTCB->ulNotifiedValue;
+			}
+
+			/* If eNotifyState is eNotified then either the task never entered
+			the blocked state (because a notification was already pending) or
+			the task unblocked because of a notification.  Otherwise the task
+			unblocked because of a timeout, or because vTaskSuspend() cancelled
+			the wait and it has since been resumed. */
+			if( pxCurrentTCB->eNotifyState != eNotified )
+			{
+				/* A notification was not received. */
+				xReturn = pdFALSE;
+			}
+			else
+			{
+				/* A notification was already pending or a notification was
+				received while the task was waiting. */
+				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnExit;
+				xReturn = pdTRUE;
+			}
+
+			pxCurrentTCB->eNotifyState = eNotWaitingNotification;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	portBASE_TYPE xTaskGenericNotify( xTaskHandle xTaskToNotify, unsigned long ulValue, eNotifyAction eAction, unsigned long *pulPreviousNotificationValue )
+	{
+	tskTCB * pxTCB;
+	eNotifyValue eOriginalNotifyState;
+	portBASE_TYPE xReturn = pdPASS;
+
+		configASSERT( xTaskToNotify );
+		pxTCB = ( tskTCB * ) xTaskToNotify;
+
+		taskENTER_CRITICAL();
+		{
+			if( pulPreviousNotificationValue != NULL )
+			{
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+			}
+
+			eOriginalNotifyState = pxTCB->eNotifyState;
+
+			pxTCB->eNotifyState = eNotified;
+
+			switch( eAction )
+			{
+				case eSetBits	:
+					pxTCB->ulNotifiedValue |= ulValue;
+					break;
+
+				case eIncrement	:
+					( pxTCB->ulNotifiedValue )++;
+					break;
+
+				case eSetValueWithOverwrite	:
+					pxTCB->ulNotifiedValue = ulValue;
+					break;
+
+				case eSetValueWithoutOverwrite :
+					if( eOriginalNotifyState != eNotified )
+					{
+						pxTCB->ulNotifiedValue = ulValue;
+					}
+					else
+					{
+						/* The value could not be written to the task. */
+						xReturn = pdFAIL;
+					}
+					break;
+
+				case eNoAction:
+				default:
+					/* The task is being notified without its notify value being
+					updated. */
+					break;
+			}
+
+			traceTASK_NOTIFY();
+
+			/* If the task is in the blocked state specifically to wait for a
+			notification then unblock it now. */
+			if( eOriginalNotifyState == eWaitingNotification )
+			{
+				taskRECORD_WAKE_SOURCE( pxTCB );
+				( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+				prvAddTaskToReadyList( pxTCB );
+
+				/* The task should not have been on an event list. */
+				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+
+				if( taskYIELD_FOR_TASK( pxTCB, pdFALSE ) != pdFALSE )
+				{
+					/* The notified task has a priority above the currently
+					executing task so a yield is required. */
+					portYIELD_WITHIN_API();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	portBASE_TYPE xTaskGenericNotifyFromISR( xTaskHandle xTaskToNotify, unsigned long ulValue, eNotifyAction eAction, unsigned long *pulPreviousNotificationValue, portBASE_TYPE *pxHigherPriorityTaskWoken )
+	{
+	tskTCB * pxTCB;
+	eNotifyValue eOriginalNotifyState;
+	portBASE_TYPE xReturn = pdPASS;
+	unsigned portBASE_TYPE uxSavedInterruptStatus;
+
+		configASSERT( xTaskToNotify );
+
+		/* See the comment in xTaskResumeFromISR() regarding the maximum system
+		call interrupt priority. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		pxTCB = ( tskTCB * ) xTaskToNotify;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pulPreviousNotificationValue != NULL )
+			{
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+			}
+
+			eOriginalNotifyState = pxTCB->eNotifyState;
+			pxTCB->eNotifyState = eNotified;
+
+			switch( eAction )
+			{
+				case eSetBits	:
+					pxTCB->ulNotifiedValue |= ulValue;
+					break;
+
+				case eIncrement	:
+					( pxTCB->ulNotifiedValue )++;
+					break;
+
+				case eSetValueWithOverwrite	:
+					pxTCB->ulNotifiedValue = ulValue;
+					break;
+
+				case eSetValueWithoutOverwrite :
+					if( eOriginalNotifyState != eNotified )
+					{
+						pxTCB->ulNotifiedValue = ulValue;
+					}
+					else
+					{
+						/* The value could not be written to the task. */
+						xReturn = pdFAIL;
+					}
+					break;
+
+				case eNoAction :
+				default:
+					/* The task is being notified without its notify value being
+					updated. */
+					break;
+			}
+
+			traceTASK_NOTIFY_FROM_ISR();
+
+			/* If the task is in the blocked state specifically to wait for a
+			notification then unblock it now. */
+			if( eOriginalNotifyState == eWaitingNotification )
+			{
+				/* The task should not have been on an event list. */
+				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+				taskRECORD_WAKE_SOURCE( pxTCB );
+
+				if( uxSchedulerSuspended == ( unsigned portBASE_TYPE ) pdFALSE )
+				{
+					( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					/* The delayed and ready lists cannot be accessed, so hold
+					this task pending until the scheduler is resumed. */
+					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+				}
+
+				if( taskYIELD_FOR_TASK( pxTCB, pdFALSE ) != pdFALSE )
+				{
+					/* The notified task has a priority above the currently
+					executing task so a yield is required. */
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+				}
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	void vTaskNotifyGiveFromISR( xTaskHandle xTaskToNotify, portBASE_TYPE *pxHigherPriorityTaskWoken )
+	{
+	tskTCB * pxTCB;
+	eNotifyValue eOriginalNotifyState;
+	unsigned portBASE_TYPE uxSavedInterruptStatus;
+
+		configASSERT( xTaskToNotify );
+
+		/* See the comment in xTaskResumeFromISR() regarding the maximum system
+		call interrupt priority. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		pxTCB = ( tskTCB * ) xTaskToNotify;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			eOriginalNotifyState = pxTCB->eNotifyState;
+			pxTCB->eNotifyState = eNotified;
+
+			/* 'Giving' is equivalent to incrementing a count in a counting
+			semaphore. */
+			( pxTCB->ulNotifiedValue )++;
+
+			traceTASK_NOTIFY_GIVE_FROM_ISR();
+
+			/* If the task is in the blocked state specifically to wait for a
+			notification then unblock it now. */
+			if( eOriginalNotifyState == eWaitingNotification )
+			{
+				/* The task should not have been on an event list. */
+				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+				taskRECORD_WAKE_SOURCE( pxTCB );
+
+				if( uxSchedulerSuspended == ( unsigned portBASE_TYPE ) pdFALSE )
+				{
+					( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					/* The delayed and ready lists cannot be accessed, so hold
+					this task pending until the scheduler is resumed. */
+					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+				}
+
+				if( taskYIELD_FOR_TASK( pxTCB, pdFALSE ) != pdFALSE )
+				{
+					/* The notified task has a priority above the currently
+					executing task so a yield is required. */
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+				}
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
 
 
 
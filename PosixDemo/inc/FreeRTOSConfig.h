@@ -0,0 +1,169 @@
+/*
+    FreeRTOS V6.0.0 - Copyright (C) 2009 Real Time Engineers Ltd.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation AND MODIFIED BY the FreeRTOS exception.
+    ***NOTE*** The exception to the GPL is included to allow you to distribute
+    a combined work that includes FreeRTOS without being obliged to provide the
+    source code for proprietary components outside of the FreeRTOS kernel.
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+    more details. You should have received a copy of the GNU General Public
+    License and the FreeRTOS license exception along with FreeRTOS; if not it
+    can be viewed here: http://www.freertos.org/a00114.html and also obtained
+    by writing to Richard Barry, contact details for whom are available on the
+    FreeRTOS WEB site.
+
+    1 tab == 4 spaces!
+
+    http://www.FreeRTOS.org - Documentation, latest information, license and
+    contact details.
+
+    http://www.SafeRTOS.com - A version that is certified for use in safety
+    critical systems.
+
+    http://www.OpenRTOS.com - Commercial support, development, porting,
+    licensing and training services.
+*/
+
+
+/******************************************************************************
+	See http://www.freertos.org/a00110.html for an explanation of the
+	definitions contained in this file.
+******************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Application specific definitions for the POSIX host port.
+ *
+ * These mirror SimpleDemo/inc/FreeRTOSConfig.h as closely as possible so
+ * kernel behaviour observed on the host carries over to the LPC1768 build.
+ * Task stacks only hold the port's thread bookkeeping on this port (the task
+ * code runs on a stack owned by the host thread), and the trace recorder is
+ * target specific so it is left out.
+ *----------------------------------------------------------*/
+
+#define configUSE_PREEMPTION		1
+/* With more than one core the idle hook gives the host CPU away, see
+vApplicationIdleHook() in main.c. */
+#define configUSE_IDLE_HOOK			( configNUM_CORES > 1 )
+#define configMAX_PRIORITIES		( 5 )
+#define configUSE_TICK_HOOK			0
+#define configCPU_CLOCK_HZ			( ( unsigned long ) 1000000000UL )
+#define configTICK_RATE_HZ			( ( portTickType ) 1000 )
+#define configMINIMAL_STACK_SIZE	( ( unsigned short ) 64 )
+#define configTOTAL_HEAP_SIZE		( ( size_t ) ( 1024 * 1024 ) )
+#define configMAX_TASK_NAME_LEN		( 12 )
+#define configUSE_TRACE_FACILITY	0
+#define configUSE_16_BIT_TICKS		0
+#define configIDLE_SHOULD_YIELD		1
+#define configUSE_CO_ROUTINES 		0
+#define configUSE_MUTEXES			1
+#define configUSE_PRIORITY_CEILING_MUTEXES	1
+#define configUSE_READ_WRITE_LOCKS		1
+#define configMAX_CO_ROUTINE_PRIORITIES ( 3 )
+#define configUSE_COUNTING_SEMAPHORES 	1
+#define configUSE_ALTERNATIVE_API 		0
+#define configCHECK_FOR_STACK_OVERFLOW	0
+#define configUSE_RECURSIVE_MUTEXES		0
+#define configQUEUE_REGISTRY_SIZE		0
+#define configUSE_MALLOC_FAILED_HOOK	0
+#define configSUPPORT_STATIC_ALLOCATION	1
+#define configUSE_TASK_TIME_SLICES		1
+#define configUSE_HIGH_RES_DELAYS		1
+
+/* Number of simulated cores.  Build with -DconfigNUM_CORES=2 (or more) to
+run the scheduler in multicore mode, one task thread per core. */
+#ifndef configNUM_CORES
+	#define configNUM_CORES				1
+#endif
+
+/* Ready priorities are kept in bit maps searched with __builtin_clz(), which
+needs configMAX_PRIORITIES to be usable in #if.  Task selection has to search
+the lists when there is more than one core. */
+#if ( configNUM_CORES == 1 )
+	#define configUSE_PORT_OPTIMISED_TASK_SELECTION	1
+#else
+	#define configUSE_PORT_OPTIMISED_TASK_SELECTION	0
+#endif
+
+/* The tick is suppressed while every task is blocked, see
+vPortSuppressTicksAndSleep() in the Posix port.  Tickless idle is single core
+only. */
+#if ( configNUM_CORES == 1 )
+	#define configUSE_TICKLESS_IDLE		1
+#else
+	#define configUSE_TICKLESS_IDLE		0
+#endif
+
+/* Build with -DconfigUSE_EDF_SCHEDULING=1 to schedule tasks that have a
+deadline earliest deadline first.  Single core only. */
+#ifndef configUSE_EDF_SCHEDULING
+	#define configUSE_EDF_SCHEDULING	0
+#endif
+
+/* Build with -DconfigINITIAL_TICK_COUNT=0xFFFFFF00 to start the tick count
+close to its overflow, as "./posix_demo edf" needs. */
+#ifndef configINITIAL_TICK_COUNT
+	#define configINITIAL_TICK_COUNT	0
+#endif
+
+/* Build with -DconfigGENERATE_RUN_TIME_STATS=1 to count run time in host
+nanoseconds, and add -DconfigRECORD_WAKE_LATENCY=1 for the interrupt to task
+latencies the benchmark reports, or -DconfigRECORD_SECTION_LATENCY=1 for the
+critical section and scheduler lock lengths.  Single core only. */
+#ifndef configGENERATE_RUN_TIME_STATS
+	#define configGENERATE_RUN_TIME_STATS	0
+#endif
+
+#ifndef configRECORD_WAKE_LATENCY
+	#define configRECORD_WAKE_LATENCY		0
+#endif
+
+#ifndef configRECORD_SECTION_LATENCY
+	#define configRECORD_SECTION_LATENCY	0
+#endif
+
+/* Build with -DconfigTASK_POOL_SIZE=N to keep the memory of up to N deleted
+tasks for reuse by the next tasks created. */
+#ifndef configTASK_POOL_SIZE
+	#define configTASK_POOL_SIZE			0
+#endif
+
+/* Build with -DconfigUSE_64_BIT_TICKS=1 to count ticks in 64 bits, so the
+kernel and the timer service task need no tick overflow lists. */
+#ifndef configUSE_64_BIT_TICKS
+	#define configUSE_64_BIT_TICKS			0
+#endif
+
+/* Software timer definitions.  The daemon task also runs the event group
+operations that interrupts (signal handlers on this port) defer to it. */
+#define configUSE_TIMERS				1
+#define configTIMER_TASK_PRIORITY		( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH		10
+#define configTIMER_TASK_STACK_DEPTH	( configMINIMAL_STACK_SIZE * 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+
+#define INCLUDE_vTaskPrioritySet			1
+#define INCLUDE_uxTaskPriorityGet			1
+#define INCLUDE_vTaskDelete					1
+#define INCLUDE_vTaskCleanUpResources		0
+#define INCLUDE_vTaskSuspend				1
+#define INCLUDE_vTaskDelayUntil				1
+#define INCLUDE_vTaskDelay					1
+#define INCLUDE_uxTaskGetStackHighWaterMark	0
+#define INCLUDE_xTaskResumeFromISR			1
+#define INCLUDE_xTimerPendFunctionCall		1
+
+#define configASSERT( x ) if( ( x ) == 0 ) { vAssertCalled( __FILE__, __LINE__ ); }
+extern void vAssertCalled( const char *pcFile, unsigned long ulLine );
+
+#endif /* FREERTOS_CONFIG_H */
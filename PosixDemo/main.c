@@ -0,0 +1,355 @@
+/*
+ * @file main.c
+ * @brief Host build of the Parte_2 producer/consumer demo on the POSIX port.
+ */
+
+/* Runs the kernel as an ordinary Linux process so scheduler and queue
+ * behaviour can be checked without the LPC1768 board.  Build from the
+ * repository root with:
+ *
+ *   gcc -O2 -pthread -IPosixDemo/inc -IFreeRTOS_Library/include \
+ *       -IFreeRTOS_Library/portable/Posix \
+ *       PosixDemo/main.c SimpleDemo/Benchmark.c \
+ *       FreeRTOS_Library/tasks.c FreeRTOS_Library/queue.c \
+ *       FreeRTOS_Library/list.c FreeRTOS_Library/timers.c \
+ *       FreeRTOS_Library/event_groups.c FreeRTOS_Library/stream_buffer.c \
+ *       FreeRTOS_Library/buffer_pool.c \
+ *       FreeRTOS_Library/portable/heap_2.c \
+ *       FreeRTOS_Library/portable/Posix/port.c -o posix_demo
+ *
+ * "./posix_demo bench" runs the kernel micro-benchmarks of SimpleDemo/Benchmark.c
+ * instead of the demo.  Adding -DconfigNUM_CORES=2 (or more) builds the
+ * multicore scheduler, with one task thread running per simulated core.
+ *
+ * "./posix_demo edf", built with -DconfigUSE_EDF_SCHEDULING=1, runs two tasks
+ * of the same priority whose deadlines fall either side of the tick count
+ * overflow, and prints the order they run in.
+ *
+ * "./posix_demo slices" runs two tasks of the same priority, one with a time
+ * slice of 10 ticks and the other of 1 tick, and prints the slices each one
+ * got.  Single core only.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+//Prioridades (en función de IDLE que está seteada en 0).
+#define mainQUEUE_RECEIVE_TASK_PRIORITY		(tskIDLE_PRIORITY + 2)
+#define	mainQUEUE_SEND_TASK_PRIORITY		(tskIDLE_PRIORITY + 1)
+
+//Frecuencia con que se envían datos (200 ms).
+#define mainQUEUE_SEND_FREQUENCY_MS			(200 / portTICK_RATE_MS)
+
+//Manejadores de tareas
+static void prvQueueReceiveTask( void *pvParameters );
+static void prvQueueSendTask( void *pvParameters );
+
+//Punto de entrada de SimpleDemo/Benchmark.c
+extern int main_bench(void);
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+//Plazos de la prueba EDF, en ticks antes y después del desborde del tick.
+#define mainDEADLINE_MARGIN					(10)
+
+static int prvStartDeadlineDemo(void);
+static void prvDeadlineTask(void *pvParameters);
+
+static volatile unsigned portBASE_TYPE uxDeadlineTasksRun = 0;
+
+#endif
+
+#if ( configUSE_TASK_TIME_SLICES == 1 ) && ( configNUM_CORES == 1 )
+
+//Rebanadas de cada tarea de la prueba, cuantas se registran y cuanto dura.
+#define mainLONG_SLICE_TICKS				(10)
+#define mainSHORT_SLICE_TICKS				(1)
+#define mainSLICES_RECORDED					(6)
+#define mainSLICE_DEMO_TICKS				(200 / portTICK_RATE_MS)
+
+//Ticks que se espera a que la tarea del timer termine de arrancar. Hasta
+//entonces puede cortar la primera rebanada.
+#define mainSLICE_SETTLE_TICKS				(2)
+
+static int prvStartSliceDemo(void);
+static void prvSliceTask(void *pvParameters);
+static void prvSliceReportTask(void *pvParameters);
+
+static xTaskHandle xSliceTasks[2];
+static portTickType xObservedSlices[2][mainSLICES_RECORDED];
+static volatile unsigned portBASE_TYPE uxObservedSlices[2];
+static volatile unsigned portBASE_TYPE uxLastSliceTask = 2;
+static volatile portTickType xSliceStart;
+
+#endif
+
+static xQueueHandle xQueue = NULL;
+
+//Memoria estática de la cola, de las tareas y de las tareas del kernel.
+static xStaticQueue xQueueBuffer;
+static unsigned char ucQueueStorage[sizeof(unsigned long)];
+static xStaticTask xReceiveTaskTCB, xSendTaskTCB, xIdleTaskTCB, xTimerTaskTCB;
+static portSTACK_TYPE uxReceiveTaskStack[configMINIMAL_STACK_SIZE];
+static portSTACK_TYPE uxSendTaskStack[configMINIMAL_STACK_SIZE];
+static portSTACK_TYPE uxIdleTaskStack[configMINIMAL_STACK_SIZE];
+static portSTACK_TYPE uxTimerTaskStack[configTIMER_TASK_STACK_DEPTH];
+
+//--------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+	if((argc > 1) && (strcmp(argv[1], "bench") == 0))
+	{
+		return main_bench();
+	}
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+	if((argc > 1) && (strcmp(argv[1], "edf") == 0))
+	{
+		return prvStartDeadlineDemo();
+	}
+#endif
+
+#if ( configUSE_TASK_TIME_SLICES == 1 ) && ( configNUM_CORES == 1 )
+	if((argc > 1) && (strcmp(argv[1], "slices") == 0))
+	{
+		return prvStartSliceDemo();
+	}
+#endif
+
+	//Se crea la cola indicando la cantidad de elementos maximos.
+	xQueue = xQueueCreateStatic(1, sizeof(unsigned long), ucQueueStorage, &xQueueBuffer);
+
+	if(xQueue != NULL)
+	{
+		//Se crean las tareas
+		xTaskCreateStatic(prvQueueReceiveTask, (signed char*) "Rcv_Task", configMINIMAL_STACK_SIZE, NULL, mainQUEUE_RECEIVE_TASK_PRIORITY, uxReceiveTaskStack, &xReceiveTaskTCB);
+		xTaskCreateStatic(prvQueueSendTask, (signed char*) "Snd_Task", configMINIMAL_STACK_SIZE, NULL, mainQUEUE_SEND_TASK_PRIORITY, uxSendTaskStack, &xSendTaskTCB);
+
+		//lanzo el scheduler
+		vTaskStartScheduler();
+	}
+
+	return 0;
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Agrega un valor a la cola cada 200 ms.
+ */
+static void prvQueueSendTask(void *pvParameters)
+{
+	unsigned long ulValueToSend = 0UL;
+	portTickType xNextWakeTime = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		vTaskDelayUntil(&xNextWakeTime, mainQUEUE_SEND_FREQUENCY_MS);
+		xQueueSend(xQueue, &ulValueToSend, 0);
+		ulValueToSend++;
+	}
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Imprime cada valor recibido junto con el tick en que llegó y la deriva del
+ * tick respecto del reloj del host, que con tickless idle debe mantenerse
+ * acotada aunque casi todos los ticks se supriman.
+ */
+static void prvQueueReceiveTask(void *pvParameters)
+{
+	unsigned long ulReceivedValue;
+	portTickType xStartTick = xTaskGetTickCount(), xElapsedTicks;
+	struct timespec xStart, xNow;
+	long lElapsedMs;
+
+	clock_gettime(CLOCK_MONOTONIC, &xStart);
+
+	for( ;; )
+	{
+		xQueueReceive(xQueue, &ulReceivedValue, portMAX_DELAY);
+
+		clock_gettime(CLOCK_MONOTONIC, &xNow);
+		lElapsedMs = ((xNow.tv_sec - xStart.tv_sec) * 1000L) + ((xNow.tv_nsec - xStart.tv_nsec) / 1000000L);
+		xElapsedTicks = xTaskGetTickCount() - xStartTick;
+
+		printf("tick %lu: recibido %lu (deriva %ld ms)\n", (unsigned long) xTaskGetTickCount(), ulReceivedValue,
+				((long) xElapsedTicks * (long) portTICK_RATE_MS) - lElapsedMs);
+		fflush(stdout);
+	}
+}
+//--------------------------------------------------------------------------------
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/*
+ * Crea dos tareas de igual prioridad, primero la de plazo posterior al
+ * desborde del tick y luego la de plazo anterior.  Comparando los plazos como
+ * números la posterior parece la más temprana; EDF debe ejecutar primero la
+ * anterior.
+ */
+static int prvStartDeadlineDemo(void)
+{
+	xTaskHandle xAfterWrap, xBeforeWrap;
+	portTickType xTicksToWrap = (portTickType) (0U - xTaskGetTickCount());
+
+	if((xTicksToWrap <= mainDEADLINE_MARGIN) || (xTicksToWrap > (portMAX_DELAY >> 1)))
+	{
+		printf("compilar con -DconfigINITIAL_TICK_COUNT=0xFFFFFF00 para empezar cerca del desborde\n");
+		return 1;
+	}
+
+	xTaskCreate(prvDeadlineTask, (signed char*) "Despues", configMINIMAL_STACK_SIZE, "despues del desborde", mainQUEUE_SEND_TASK_PRIORITY, &xAfterWrap);
+	xTaskCreate(prvDeadlineTask, (signed char*) "Antes", configMINIMAL_STACK_SIZE, "antes del desborde", mainQUEUE_SEND_TASK_PRIORITY, &xBeforeWrap);
+
+	vTaskSetDeadline(xAfterWrap, xTicksToWrap + mainDEADLINE_MARGIN);
+	vTaskSetDeadline(xBeforeWrap, xTicksToWrap - mainDEADLINE_MARGIN);
+
+	vTaskStartScheduler();
+
+	return 1;
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Informa el orden en que corre cada tarea y termina cuando corrieron las dos.
+ */
+static void prvDeadlineTask(void *pvParameters)
+{
+	printf("tick %lu: tarea con plazo %s (%lu)\n", (unsigned long) xTaskGetTickCount(), (const char *) pvParameters,
+			(unsigned long) xTaskGetDeadline(NULL));
+	fflush(stdout);
+
+	if(++uxDeadlineTasksRun == 2)
+	{
+		exit(0);
+	}
+
+	vTaskDelete(NULL);
+}
+//--------------------------------------------------------------------------------
+
+#endif
+
+#if ( configUSE_TASK_TIME_SLICES == 1 ) && ( configNUM_CORES == 1 )
+
+/*
+ * Crea la tarea que lanza la prueba de rebanadas e informa el resultado.
+ */
+static int prvStartSliceDemo(void)
+{
+	xTaskCreate(prvSliceReportTask, (signed char*) "Informe", configMINIMAL_STACK_SIZE, NULL, mainQUEUE_RECEIVE_TASK_PRIORITY, NULL);
+
+	vTaskStartScheduler();
+
+	return 1;
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Gira hasta que la otra tarea le cede el procesador. Al empezar cada rebanada
+ * registra la que acaba de terminar la otra tarea, desde el tick en que esta
+ * empezo.
+ */
+static void prvSliceTask(void *pvParameters)
+{
+	unsigned portBASE_TYPE uxTask = (unsigned portBASE_TYPE) (unsigned long) pvParameters, uxOther;
+	portTickType xNow;
+
+	for( ;; )
+	{
+		if(uxLastSliceTask != uxTask)
+		{
+			xNow = xTaskGetTickCount();
+			uxOther = uxLastSliceTask;
+			if((uxOther < 2) && (uxObservedSlices[uxOther] < mainSLICES_RECORDED))
+			{
+				xObservedSlices[uxOther][uxObservedSlices[uxOther]] = xNow - xSliceStart;
+				uxObservedSlices[uxOther]++;
+			}
+			xSliceStart = xNow;
+			uxLastSliceTask = uxTask;
+		}
+	}
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Crea dos tareas de igual prioridad que nunca se bloquean, con rebanadas de
+ * mainLONG_SLICE_TICKS y mainSHORT_SLICE_TICKS. Las deja correr
+ * mainSLICE_DEMO_TICKS, informa las rebanadas de cada una y termina.
+ */
+static void prvSliceReportTask(void *pvParameters)
+{
+	unsigned portBASE_TYPE uxTask, uxSlice;
+
+	vTaskDelay(mainSLICE_SETTLE_TICKS);
+
+	xTaskCreate(prvSliceTask, (signed char*) "Larga", configMINIMAL_STACK_SIZE, (void *) 0, mainQUEUE_SEND_TASK_PRIORITY, &xSliceTasks[0]);
+	xTaskCreate(prvSliceTask, (signed char*) "Corta", configMINIMAL_STACK_SIZE, (void *) 1, mainQUEUE_SEND_TASK_PRIORITY, &xSliceTasks[1]);
+	vTaskSetTimeSlice(xSliceTasks[0], mainLONG_SLICE_TICKS);
+	vTaskSetTimeSlice(xSliceTasks[1], mainSHORT_SLICE_TICKS);
+
+	vTaskDelay(mainSLICE_DEMO_TICKS);
+
+	for(uxTask = 0; uxTask < 2; uxTask++)
+	{
+		printf("rebanada de %lu ticks, observadas:", (unsigned long) xTaskGetTimeSlice(xSliceTasks[uxTask]));
+		for(uxSlice = 0; uxSlice < uxObservedSlices[uxTask]; uxSlice++)
+		{
+			printf(" %lu", (unsigned long) xObservedSlices[uxTask][uxSlice]);
+		}
+		printf("\n");
+	}
+	fflush(stdout);
+
+	exit(0);
+}
+//--------------------------------------------------------------------------------
+
+#endif
+
+void vAssertCalled( const char *pcFile, unsigned long ulLine )
+{
+	fprintf(stderr, "configASSERT fallo en %s:%lu\n", pcFile, ulLine);
+	abort();
+}
+//--------------------------------------------------------------------------------
+
+#if ( configUSE_IDLE_HOOK == 1 )
+
+/*
+ * Con varios núcleos simulados hay una tarea IDLE girando en cada uno.  Si el
+ * host tiene menos CPUs que núcleos, cederla evita que el hilo que debe
+ * atender el tick espere a que se le acabe el turno a las tareas IDLE.
+ */
+void vApplicationIdleHook(void)
+{
+	sched_yield();
+}
+//--------------------------------------------------------------------------------
+
+#endif
+
+void vApplicationGetIdleTaskMemory(xStaticTask **ppxIdleTaskTCBBuffer, portSTACK_TYPE **ppxIdleTaskStackBuffer, unsigned short *pusIdleTaskStackSize)
+{
+	*ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+	*ppxIdleTaskStackBuffer = uxIdleTaskStack;
+	*pusIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+//--------------------------------------------------------------------------------
+
+void vApplicationGetTimerTaskMemory(xStaticTask **ppxTimerTaskTCBBuffer, portSTACK_TYPE **ppxTimerTaskStackBuffer, unsigned short *pusTimerTaskStackSize)
+{
+	*ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+	*ppxTimerTaskStackBuffer = uxTimerTaskStack;
+	*pusTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+//--------------------------------------------------------------------------------
@@ -0,0 +1,1381 @@
+/*
+ * @file Benchmark.c
+ * @author Asson Leandro <leoasson@gmail.com>
+ */
+
+/*Micro-benchmarks of the kernel primitives, modeled on the Parte_2.c
+ *  producer/consumer pair.  Each test repeats one primitive benchSAMPLES times
+ *  and reports min/avg/p99/max.
+ *  On the LPC1768 the samples are DWT CYCCNT cycles and the results are sent
+ *  through UART3 at 115200 baud.  On the POSIX host port the samples are
+ *  nanoseconds from clock_gettime() and the results are printed to stdout
+ *  (see PosixDemo/main.c).
+ *  The "overhead" line is the cost of two back-to-back timestamps; it is
+ *  included in every other figure.
+ *  The "record by copy" lines send a record of the size shown through a
+ *  queue and receive it again, which copies it twice.  The "record by
+ *  pointer" lines pass the same record through a buffer channel instead: they
+ *  take a block from a buffer pool, send and receive its address and release
+ *  it, so their cost does not depend on the size of the record but is that of
+ *  four queue operations instead of two.  Copying wins up to the size at
+ *  which the two copies cost more than the two extra queue operations; on the
+ *  host that is between 16K and 32K (min columns: 857 against 1530 ns at 16K,
+ *  2150 against 1530 ns at 32K).  On the board the larger sizes are left out
+ *  if the heap cannot hold a queue and a pool of them.
+ *  The "queue drain" lines empty a queue holding benchBATCH_SIZE items, once
+ *  with one xQueueReceive() per item and once with a single
+ *  xQueueReceiveMultiple().
+ *  The "notify" lines wake the same helper with a direct-to-task notification
+ *  and can be compared with "queue send, waiter" and "resume from ISR".
+ *  The "mutex chain, waiter" line is how long a high priority task waits for a
+ *  mutex held by a task that is itself blocked on a mutex held by the control
+ *  task, while a medium priority task is ready to spin for
+ *  benchINTERFERENCE_SPIN.  The inherited priority has to reach the end of
+ *  the chain for the wait not to include the spin.
+ *  The "mutex read" and "rwlock read" lines have N tasks read a shared table
+ *  under the mutex and under a read write lock, and give the reads per
+ *  second of all N together over benchREAD_WINDOW_TICKS.  Each read holds the
+ *  lock for benchREAD_US, going over the table again and again, so the lock
+ *  itself is a small part of it.  The mutex lets one reader in at a time, so
+ *  its line stays near 1000000 / benchREAD_US whatever N is; the read write
+ *  lock lets them all in, so its line should grow with N.  That takes
+ *  readers running in parallel: run the host build with -DconfigNUM_CORES=4
+ *  on a host with at least 4 CPUs.  On one core, or with fewer CPUs than
+ *  cores, both lines stay flat.
+ *  The "rwlock write, readers" line is how long a writer waits for the read
+ *  write lock while benchSTREAM_READERS higher priority tasks keep it taken
+ *  for reading.  Each reader holds it across a one tick delay and takes it
+ *  again as soon as it gives it back, so the lock is never free.  The wait
+ *  should be about a tick; a writer the readers kept out would show as
+ *  benchWRITER_TIMEOUT.
+ *  The "task create+delete" line creates a task that does not get to run and
+ *  deletes it again.  configTASK_POOL_SIZE set to 1 removes the heap calls
+ *  from it; on the host the cost is mostly the port creating a thread.
+ *  The "interrupt in sched lock" line raises the interrupt on the control
+ *  task's own core while it holds the scheduler suspended for
+ *  benchSECTION_US, and is how long the interrupt takes to run.  Suspending
+ *  the scheduler does not mask interrupts, so it should be the same with
+ *  -DconfigNUM_CORES=N as with one core (on the host about 1.1 us either
+ *  way); an interrupt held off until xTaskResumeAll() would show as
+ *  benchSECTION_US.
+ *  The "delayed insert" lines block a task behind N tasks that are already
+ *  delayed, which is the worst case for the sorted delayed list.  Running the
+ *  host build once with and once without -DconfigUSE_TIMING_WHEEL=1 shows the
+ *  N at which the timing wheel starts to pay off.  Compare the min columns,
+ *  the others are mostly host noise: on the host the sorted list grows by
+ *  about 3 ns per delayed task from N=32 on, while the wheel stays flat, so
+ *  they part between N=16 and N=32.
+ *  The "high res delay" line is how late a task wakes from
+ *  vTaskDelayHighRes(), which does not round the delay to a tick period.
+ *  On the host the "absolute-timer overshoot" line below it sets the same
+ *  kind of host timer as the port's alarm and waits for it without the
+ *  kernel.  The difference between the two lines is the kernel's part, about
+ *  7 us on the host, mostly the switch to the woken task's thread; the tails
+ *  of both, up to a few hundred us, are the host scheduling the process late
+ *  and are there with or without the kernel.  With -DconfigNUM_CORES=N the
+ *  timer's signal could be taken by another core's thread, so the
+ *  "absolute-timer overshoot" line is left out.
+ *  With configRECORD_SECTION_LATENCY the "critical section" and "scheduler
+ *  lock" lines hold each kind of section for benchSECTION_US and read back
+ *  the length the kernel recorded for it, which should be just over
+ *  benchSECTION_US (on the host: -DconfigGENERATE_RUN_TIME_STATS=1
+ *  -DconfigRECORD_SECTION_LATENCY=1).
+ *  With configRECORD_WAKE_LATENCY the kernel's own interrupt to task latency
+ *  distributions are printed last, one line per registered interrupt (on the
+ *  host: -DconfigGENERATE_RUN_TIME_STATS=1 -DconfigRECORD_WAKE_LATENCY=1).
+ *  The p99 shown there is the upper bound of its histogram bucket.
+ *  The wake up lines ("waiter", "from ISR", "mutex chain" and "delayed
+ *  insert") compare a timestamp taken by a helper task with one taken by the
+ *  control task.  With -DconfigNUM_CORES=N on the host the helper runs on
+ *  another core, in parallel with the control task, so those lines are left
+ *  out.
+ *  To run it on the board, call main_bench() instead of main().
+*/
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "buffer_pool.h"
+
+#if defined( __linux__ )
+	#include <stdio.h>
+	#include <stdlib.h>
+	#include <string.h>
+	#include <signal.h>
+	#include <time.h>
+#else
+	#include <string.h>
+	#include "LPC17xx.h"
+	#include "serial.h"
+#endif
+
+//Cantidad de muestras por prueba.
+#define benchSAMPLES						(200)
+
+//Percentil reportado.
+#define benchPERCENTILE						(99)
+
+//Prioridades. Las tareas auxiliares que deben despertar tienen mas prioridad
+//que la tarea de control para que la ejecuten inmediatamente.
+#define benchCONTROL_TASK_PRIORITY			(tskIDLE_PRIORITY + 1)
+#define benchHELPER_TASK_PRIORITY			(tskIDLE_PRIORITY + 2)
+#define benchINTERFERENCE_TASK_PRIORITY		(tskIDLE_PRIORITY + 3)
+#define benchCHAIN_WAITER_PRIORITY			(tskIDLE_PRIORITY + 4)
+
+//Tiempo que gira la tarea de prioridad media en la prueba de la cadena de
+//mutex, en las mismas unidades que las muestras.
+#define benchINTERFERENCE_SPIN				(50000UL)
+
+#define benchSTACK_SIZE						(configMINIMAL_STACK_SIZE * 2)
+
+//Ticks que se deja correr a IDLE tras eliminar una tarea auxiliar. Con varios
+//nucleos la tarea puede seguir ejecutando y es IDLE quien libera su memoria.
+#define benchSETTLE_TICKS					(2)
+
+//Bloqueos usados por la prueba de insercion en la lista de demorados. La tarea
+//medida siempre queda detras de todas las tareas de fondo.
+#define benchBACKGROUND_DELAY				(60000 / portTICK_RATE_MS)
+#define benchMEASURED_DELAY					(120000 / portTICK_RATE_MS)
+
+//Demora de la prueba de alta resolucion, en microsegundos. No es multiplo del
+//periodo del tick.
+#define benchHIGH_RES_DELAY_US				(1250UL)
+
+//Duracion de las secciones criticas y de los bloqueos del scheduler cuya
+//longitud registrada por el kernel se lee, en microsegundos.
+#define benchSECTION_US						(20UL)
+
+//Cantidad maxima de interrupciones registradas que se informan.
+#define benchMAX_WAKE_SOURCES				(4)
+
+//Cantidad de elementos que se reciben de una vez en la prueba de lotes.
+#define benchBATCH_SIZE						(8)
+
+#if defined( __linux__ )
+
+	#define benchUNITS						"ns"
+	#define benchUS_TO_UNITS( x )			( ( x ) * 1000UL )
+
+	//La interrupcion se simula con una senal enviada al hilo en ejecucion.
+	#define benchINTERRUPT_SIGNAL			SIGUSR1
+
+	//Timer del host que usa la linea "absolute-timer overshoot". El port usa
+	//SIGRTMIN para su alarma.
+	#define benchHOST_ALARM_SIGNAL			(SIGRTMIN + 1)
+
+#else
+
+	#define benchUNITS						"cycles"
+	#define benchUS_TO_UNITS( x )			( ( x ) * ( SystemCoreClock / 1000000UL ) )
+
+	//Registros del DWT y del CoreDebug (no estan definidos en CMSIS v1.30).
+	#define benchDEMCR_REG					( * ( ( volatile unsigned long * ) 0xe000edfc ) )
+	#define benchDWT_CTRL_REG				( * ( ( volatile unsigned long * ) 0xe0001000 ) )
+	#define benchDWT_CYCCNT_REG				( * ( ( volatile unsigned long * ) 0xe0001004 ) )
+	#define benchDEMCR_TRCENA_BIT			( 1UL << 24UL )
+	#define benchDWT_CYCCNTENA_BIT			( 1UL << 0UL )
+
+	//EINT1 no se usa en la placa; se dispara por software.
+	#define benchINTERRUPT_IRQn				EINT1_IRQn
+	#define benchINTERRUPT_PRIORITY			(6)
+
+	#define benchUART						(3)
+
+#endif
+
+//Cantidad de tareas demoradas de fondo en cada corrida de la prueba de
+//insercion. En la placa el heap solo alcanza para unas pocas.
+typedef struct BLOCKED_RUN{
+	unsigned portBASE_TYPE uxBlockedTasks;
+	const char *pcName;
+} xBlockedRun;
+
+//Cantidad de tareas lectoras en cada corrida de la prueba de lectura.
+typedef struct READER_RUN{
+	unsigned portBASE_TYPE uxReaders;
+	const char *pcMutexName;
+	const char *pcLockName;
+} xReaderRun;
+
+static const xReaderRun xReaderRuns[] = {
+	{ 1, "mutex read, N=1", "rwlock read, N=1" }, { 2, "mutex read, N=2", "rwlock read, N=2" },
+	{ 4, "mutex read, N=4", "rwlock read, N=4" }
+};
+#define benchMAX_READERS					(4)
+
+//Tiempo que dura cada lectura de la tabla, ventana durante la que se cuentan
+//las lecturas, y tamano de la tabla.
+#define benchREAD_US						(50UL)
+#define benchREAD_WINDOW_TICKS				(500 / portTICK_RATE_MS)
+#define benchTABLE_SIZE						(256)
+
+//Lectoras que leen sin parar en la prueba de la escritora, y cuanto espera la
+//escritora como maximo.
+#define benchSTREAM_READERS					(2)
+#define benchWRITER_TIMEOUT					(100 / portTICK_RATE_MS)
+
+//Tamano del registro en cada corrida de la prueba de registros. En la placa
+//el heap no alcanza para una cola y un pool de registros grandes.
+typedef struct RECORD_RUN{
+	size_t xRecordSize;
+	const char *pcCopyName;
+	const char *pcPointerName;
+} xRecordRun;
+
+#if defined( __linux__ )
+	static const xRecordRun xRecordRuns[] = {
+		{ 64, "record by copy, 64", "record by pointer, 64" }, { 1024, "record by copy, 1K", "record by pointer, 1K" },
+		{ 4096, "record by copy, 4K", "record by pointer, 4K" }, { 16384, "record by copy, 16K", "record by pointer, 16K" },
+		{ 32768, "record by copy, 32K", "record by pointer, 32K" }, { 65536, "record by copy, 64K", "record by pointer, 64K" }
+	};
+	#define benchMAX_RECORD_SIZE			(65536)
+#else
+	static const xRecordRun xRecordRuns[] = {
+		{ 64, "record by copy, 64", "record by pointer, 64" }, { 256, "record by copy, 256", "record by pointer, 256" },
+		{ 1024, "record by copy, 1K", "record by pointer, 1K" }
+	};
+	#define benchMAX_RECORD_SIZE			(1024)
+#endif
+
+#if ( configNUM_CORES > 1 )
+	//Las pruebas de insercion no se ejecutan con varios nucleos.
+#elif defined( __linux__ )
+	static const xBlockedRun xBlockedRuns[] = {
+		{ 0, "delayed insert, N=0" }, { 8, "delayed insert, N=8" }, { 16, "delayed insert, N=16" },
+		{ 32, "delayed insert, N=32" }, { 64, "delayed insert, N=64" }, { 128, "delayed insert, N=128" },
+		{ 256, "delayed insert, N=256" }, { 512, "delayed insert, N=512" }, { 1024, "delayed insert, N=1024" }
+	};
+	#define benchMAX_BLOCKED_TASKS			(1024)
+#else
+	static const xBlockedRun xBlockedRuns[] = {
+		{ 0, "delayed insert, N=0" }, { 2, "delayed insert, N=2" }, { 4, "delayed insert, N=4" },
+		{ 8, "delayed insert, N=8" }
+	};
+	#define benchMAX_BLOCKED_TASKS			(8)
+#endif
+
+//Funciones de las tareas.
+static void prvBenchTask( void *pvParameters );
+static void prvYieldTask( void *pvParameters );
+#if ( configNUM_CORES == 1 )
+static void prvReceiveTask( void *pvParameters );
+static void prvSendTask( void *pvParameters );
+static void prvResumedTask( void *pvParameters );
+static void prvNotifiedTask( void *pvParameters );
+static void prvBackgroundTask( void *pvParameters );
+static void prvDelayedReceiveTask( void *pvParameters );
+static void prvChainHolderTask( void *pvParameters );
+static void prvChainWaiterTask( void *pvParameters );
+static void prvInterferenceTask( void *pvParameters );
+#endif
+static void prvReaderTask( void *pvParameters );
+static void prvStreamReaderTask( void *pvParameters );
+
+//Funciones de soporte.
+static void prvDeleteHelper( xTaskHandle xHelper );
+static void prvInitTimestamp( void );
+static unsigned long prvTimestamp( void );
+static void prvInitInterrupt( void );
+static void prvTriggerInterrupt( void );
+#if defined( __linux__ ) && ( configUSE_HIGH_RES_DELAYS == 1 ) && ( configNUM_CORES == 1 )
+static void prvHostAlarmOvershoot( void );
+#endif
+static void prvReport( const char *pcName );
+#if ( configRECORD_WAKE_LATENCY == 1 )
+static void prvReportWakeLatency( void );
+#endif
+static void prvPrintLine( const char *pcName, unsigned long ulMin, unsigned long ulAvg, unsigned long ulP99, unsigned long ulMax );
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+static void prvPrintRate( const char *pcName, unsigned long ulPerSecond );
+#endif
+
+static unsigned long aulSamples[ benchSAMPLES ];
+#if ( configNUM_CORES == 1 )
+static volatile unsigned long ulHelperStamp = 0UL;
+#endif
+static xQueueHandle xQueue = NULL;
+static xQueueHandle xRecordQueue = NULL;
+static xQueueHandle xRecordChannel = NULL;
+static xBufferPoolHandle xRecordPool = NULL;
+static unsigned char ucRecord[ benchMAX_RECORD_SIZE ];
+static xQueueHandle xBatchQueue = NULL;
+static unsigned long ulBatch[ benchBATCH_SIZE ];
+static xSemaphoreHandle xSemaphore = NULL;
+static xSemaphoreHandle xMutex = NULL;
+static xSemaphoreHandle xChainMutex = NULL;
+static xSemaphoreHandle xReadWriteLock = NULL;
+static volatile portBASE_TYPE xReadWithLock = pdFALSE;
+static volatile portBASE_TYPE xStopReaders = pdFALSE;
+static unsigned long ulTable[benchTABLE_SIZE];
+static volatile unsigned long ulTableSum = 0UL;
+static volatile unsigned long ulReaderReads[benchMAX_READERS];
+static xTaskHandle xResumedTask = NULL;
+static xTaskHandle xNotifiedTask = NULL;
+static volatile unsigned long ulInterruptStamp = 0UL;
+#if ( configNUM_CORES == 1 )
+static xTaskHandle xBlockedTasks[ benchMAX_BLOCKED_TASKS ];
+#endif
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+static xISRRunTimeStats xInterruptRunTime;
+#endif
+#if ( configRECORD_WAKE_LATENCY == 1 )
+static xWakeLatencyStatus xWakeLatency[ benchMAX_WAKE_SOURCES ];
+#endif
+#if ( configRECORD_SECTION_LATENCY == 1 )
+static xSectionLatencyStats xSectionLatency;
+#endif
+
+//--------------------------------------------------------------------------------
+
+int main_bench(void)
+{
+#if !defined( __linux__ )
+	//Se inicializa el UART3 de la placa a 115200 baudios.
+	Serial_begin(benchUART, 115200);
+#endif
+
+	prvInitTimestamp();
+	prvInitInterrupt();
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	vTaskRegisterISRRunTimeStats(&xInterruptRunTime, (const signed char *) "Bench IRQ");
+#endif
+
+	xQueue = xQueueCreate(1, sizeof(unsigned long));
+	vSemaphoreCreateBinary(xSemaphore);
+	xMutex = xSemaphoreCreateMutex();
+	xChainMutex = xSemaphoreCreateMutex();
+	xRecordChannel = xBufferChannelCreate(1);
+	xBatchQueue = xQueueCreate(benchBATCH_SIZE, sizeof(unsigned long));
+
+	if((xQueue != NULL) && (xSemaphore != NULL) && (xMutex != NULL) && (xChainMutex != NULL) &&
+	   (xRecordChannel != NULL) && (xBatchQueue != NULL))
+	{
+		xTaskCreate(prvBenchTask, (signed char*) "Bench", benchSTACK_SIZE, NULL, benchCONTROL_TASK_PRIORITY, NULL);
+
+		//lanzo el scheduler
+		vTaskStartScheduler();
+	}
+
+	return 0;
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Ejecuta todas las pruebas en secuencia. Cada tarea auxiliar se crea antes de
+ * su prueba y se elimina al terminar, para que no interfiera con las demas.
+ */
+static void prvBenchTask(void *pvParameters)
+{
+	unsigned long ulValue = 0UL;
+	unsigned long ulStart;
+	void *pvRecord;
+	xTaskHandle xHelper;
+	unsigned portBASE_TYPE uxRun, uxTask, uxItem;
+#if ( configNUM_CORES == 1 )
+	xTaskHandle xChainHolder, xInterference;
+#endif
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+	xSemaphoreHandle xCeilingMutex;
+#endif
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+	xQueueHandle xStartQueue;
+	xTaskHandle xReaders[benchMAX_READERS];
+	unsigned portBASE_TYPE uxMode;
+	portBASE_TYPE xTaken;
+	unsigned long ulReads;
+#endif
+	int i;
+
+	//Costo de tomar dos marcas de tiempo seguidas.
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		aulSamples[i] = prvTimestamp() - ulStart;
+	}
+	prvReport("overhead");
+
+	//Ida y vuelta de vTaskSwitchContext: dos cambios de contexto entre tareas
+	//de igual prioridad.
+	xTaskCreate(prvYieldTask, (signed char*) "Yield", benchSTACK_SIZE, NULL, benchCONTROL_TASK_PRIORITY, &xHelper);
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		taskYIELD();
+		aulSamples[i] = prvTimestamp() - ulStart;
+	}
+	prvDeleteHelper(xHelper);
+	prvReport("yield round trip");
+
+	//Cola sin tareas bloqueadas.
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		xQueueSend(xQueue, &ulValue, 0);
+		aulSamples[i] = prvTimestamp() - ulStart;
+		xQueueReceive(xQueue, &ulValue, 0);
+	}
+	prvReport("queue send");
+
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		xQueueSend(xQueue, &ulValue, 0);
+		ulStart = prvTimestamp();
+		xQueueReceive(xQueue, &ulValue, 0);
+		aulSamples[i] = prvTimestamp() - ulStart;
+	}
+	prvReport("queue receive");
+
+	//Registro copiado a la cola y de vuelta, contra el mismo registro pasado
+	//por direccion con un canal y un pool. La cola y el pool se crean para
+	//cada tamano y se borran al terminar.
+	for(uxRun = 0; uxRun < (sizeof(xRecordRuns) / sizeof(xRecordRuns[0])); uxRun++)
+	{
+		xRecordQueue = xQueueCreate(1, xRecordRuns[uxRun].xRecordSize);
+		xRecordPool = xBufferPoolCreate(1, xRecordRuns[uxRun].xRecordSize);
+		if((xRecordQueue == NULL) || (xRecordPool == NULL))
+		{
+			if(xRecordQueue != NULL)
+			{
+				vQueueDelete(xRecordQueue);
+			}
+			if(xRecordPool != NULL)
+			{
+				vBufferPoolDelete(xRecordPool);
+			}
+			break;
+		}
+
+		for(i = 0; i < benchSAMPLES; i++)
+		{
+			ulStart = prvTimestamp();
+			xQueueSend(xRecordQueue, ucRecord, 0);
+			xQueueReceive(xRecordQueue, ucRecord, 0);
+			aulSamples[i] = prvTimestamp() - ulStart;
+		}
+		prvReport(xRecordRuns[uxRun].pcCopyName);
+
+		for(i = 0; i < benchSAMPLES; i++)
+		{
+			ulStart = prvTimestamp();
+			pvRecord = pvBufferPoolAcquire(xRecordPool, 0);
+			xBufferChannelSend(xRecordChannel, pvRecord, 0);
+			pvRecord = pvBufferChannelReceive(xRecordChannel, 0);
+			vBufferPoolRelease(xRecordPool, pvRecord);
+			aulSamples[i] = prvTimestamp() - ulStart;
+		}
+		prvReport(xRecordRuns[uxRun].pcPointerName);
+
+		vQueueDelete(xRecordQueue);
+		vBufferPoolDelete(xRecordPool);
+	}
+
+	//Vaciado de una cola llena, elemento por elemento y en un solo lote.
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		xQueueSendMultiple(xBatchQueue, ulBatch, benchBATCH_SIZE, 0);
+		ulStart = prvTimestamp();
+		for(uxItem = 0; uxItem < benchBATCH_SIZE; uxItem++)
+		{
+			xQueueReceive(xBatchQueue, &ulBatch[uxItem], 0);
+		}
+		aulSamples[i] = prvTimestamp() - ulStart;
+	}
+	prvReport("queue drain, one by one");
+
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		xQueueSendMultiple(xBatchQueue, ulBatch, benchBATCH_SIZE, 0);
+		ulStart = prvTimestamp();
+		xQueueReceiveMultiple(xBatchQueue, ulBatch, benchBATCH_SIZE, 0);
+		aulSamples[i] = prvTimestamp() - ulStart;
+	}
+	prvReport("queue drain, batch");
+
+#if ( configNUM_CORES == 1 )
+	//Envio que despierta a un receptor bloqueado de mayor prioridad. Se mide
+	//hasta que el receptor ya esta ejecutando. Con varios nucleos el receptor
+	//ejecuta en otro nucleo y su marca de tiempo no se puede comparar con la
+	//de esta tarea; lo mismo vale para el resto de las pruebas con
+	//ulHelperStamp.
+	xTaskCreate(prvReceiveTask, (signed char*) "Rcv_Task", benchSTACK_SIZE, NULL, benchHELPER_TASK_PRIORITY, &xHelper);
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		xQueueSend(xQueue, &ulValue, 0);
+		aulSamples[i] = ulHelperStamp - ulStart;
+	}
+	prvDeleteHelper(xHelper);
+	prvReport("queue send, waiter");
+
+	//Recepcion que despierta a un emisor bloqueado (cola llena) de mayor
+	//prioridad.
+	xTaskCreate(prvSendTask, (signed char*) "Snd_Task", benchSTACK_SIZE, NULL, benchHELPER_TASK_PRIORITY, &xHelper);
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		xQueueReceive(xQueue, &ulValue, 0);
+		aulSamples[i] = ulHelperStamp - ulStart;
+	}
+	prvDeleteHelper(xHelper);
+	xQueueReceive(xQueue, &ulValue, 0);
+	prvReport("queue receive, waiter");
+#endif
+
+	//Semaforo binario sin contencion.
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		xSemaphoreGive(xSemaphore);
+		aulSamples[i] = prvTimestamp() - ulStart;
+		xSemaphoreTake(xSemaphore, 0);
+	}
+	prvReport("semaphore give");
+
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		xSemaphoreGive(xSemaphore);
+		ulStart = prvTimestamp();
+		xSemaphoreTake(xSemaphore, 0);
+		aulSamples[i] = prvTimestamp() - ulStart;
+	}
+	prvReport("semaphore take");
+
+	//Mutex sin contencion, con herencia de prioridad y con techo de prioridad.
+	//El techo sube la prioridad de esta tarea al tomarlo y la baja al
+	//devolverlo.
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		xSemaphoreTake(xMutex, 0);
+		xSemaphoreGive(xMutex);
+		aulSamples[i] = prvTimestamp() - ulStart;
+	}
+	prvReport("mutex take+give");
+
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+	xCeilingMutex = xSemaphoreCreateMutexWithCeiling(benchHELPER_TASK_PRIORITY);
+	if(xCeilingMutex != NULL)
+	{
+		for(i = 0; i < benchSAMPLES; i++)
+		{
+			ulStart = prvTimestamp();
+			xSemaphoreTake(xCeilingMutex, 0);
+			xSemaphoreGive(xCeilingMutex);
+			aulSamples[i] = prvTimestamp() - ulStart;
+		}
+		vSemaphoreDelete(xCeilingMutex);
+		prvReport("ceiling take+give");
+	}
+#endif
+
+#if ( configNUM_CORES == 1 )
+	//Cadena de mutex: esta tarea tiene xMutex, la tarea intermedia tiene
+	//xChainMutex y espera xMutex, y la tarea de mayor prioridad espera
+	//xChainMutex. La tarea de prioridad media queda lista antes de devolver
+	//xMutex; solo ejecuta antes que la de mayor prioridad si la herencia no
+	//llego hasta esta tarea. Se mide la espera de la tarea de mayor prioridad.
+	xTaskCreate(prvChainHolderTask, (signed char*) "Chain", benchSTACK_SIZE, NULL, benchHELPER_TASK_PRIORITY, &xChainHolder);
+	xTaskCreate(prvInterferenceTask, (signed char*) "Spin", benchSTACK_SIZE, NULL, benchINTERFERENCE_TASK_PRIORITY, &xInterference);
+	xTaskCreate(prvChainWaiterTask, (signed char*) "Waiter", benchSTACK_SIZE, NULL, benchCHAIN_WAITER_PRIORITY, &xHelper);
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		xSemaphoreTake(xMutex, 0);
+		vTaskResume(xChainHolder);
+		vTaskResume(xHelper);
+		ulStart = ulHelperStamp;
+		vTaskResume(xInterference);
+		xSemaphoreGive(xMutex);
+		aulSamples[i] = ulHelperStamp - ulStart;
+	}
+	vTaskDelete(xChainHolder);
+	vTaskDelete(xInterference);
+	prvDeleteHelper(xHelper);
+	prvReport("mutex chain, waiter");
+#endif
+
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+	//Lectoras de una tabla compartida, primero con el mutex y despues con el
+	//lock de lectura/escritura. Cada lectora toma de xStartQueue el numero de
+	//su contador, lee hasta que se activa xStopReaders y avisa por xQueue. La
+	//tarea de control sube por encima de las lectoras para poder cortar la
+	//ventana aunque ellas no se bloqueen nunca.
+	xReadWriteLock = xSemaphoreCreateReadWriteLock();
+	xStartQueue = xQueueCreate(benchMAX_READERS, sizeof(unsigned long));
+	if((xReadWriteLock != NULL) && (xStartQueue != NULL))
+	{
+		for(uxTask = 0; uxTask < benchMAX_READERS; uxTask++)
+		{
+			xTaskCreate(prvReaderTask, (signed char*) "Reader", benchSTACK_SIZE, (void *) xStartQueue, benchCONTROL_TASK_PRIORITY, &xReaders[uxTask]);
+		}
+		vTaskPrioritySet(NULL, benchHELPER_TASK_PRIORITY);
+
+		for(uxRun = 0; uxRun < (sizeof(xReaderRuns) / sizeof(xReaderRuns[0])); uxRun++)
+		{
+			for(uxMode = 0; uxMode < 2; uxMode++)
+			{
+				xReadWithLock = (uxMode != 0) ? pdTRUE : pdFALSE;
+				xStopReaders = pdFALSE;
+				for(uxTask = 0; uxTask < xReaderRuns[uxRun].uxReaders; uxTask++)
+				{
+					ulReaderReads[uxTask] = 0UL;
+					ulValue = (unsigned long) uxTask;
+					xQueueSend(xStartQueue, &ulValue, 0);
+				}
+
+				//Un tick para que arranquen todas, y despues la ventana.
+				vTaskDelay(1);
+				ulReads = 0UL;
+				for(uxTask = 0; uxTask < xReaderRuns[uxRun].uxReaders; uxTask++)
+				{
+					ulReads -= ulReaderReads[uxTask];
+				}
+				ulStart = prvTimestamp();
+				vTaskDelay(benchREAD_WINDOW_TICKS);
+				for(uxTask = 0; uxTask < xReaderRuns[uxRun].uxReaders; uxTask++)
+				{
+					ulReads += ulReaderReads[uxTask];
+				}
+				ulStart = prvTimestamp() - ulStart;
+
+				xStopReaders = pdTRUE;
+				for(uxTask = 0; uxTask < xReaderRuns[uxRun].uxReaders; uxTask++)
+				{
+					xQueueReceive(xQueue, &ulValue, portMAX_DELAY);
+				}
+				prvPrintRate((uxMode != 0) ? xReaderRuns[uxRun].pcLockName : xReaderRuns[uxRun].pcMutexName,
+					(unsigned long) (((unsigned long long) ulReads * benchUS_TO_UNITS(1000000ULL)) / ulStart));
+			}
+		}
+
+		vTaskPrioritySet(NULL, benchCONTROL_TASK_PRIORITY);
+		for(uxTask = 0; uxTask < benchMAX_READERS; uxTask++)
+		{
+			vTaskDelete(xReaders[uxTask]);
+		}
+		vTaskDelay(benchSETTLE_TICKS);
+
+		//Escritora contra lectoras de mayor prioridad que vuelven a tomar el
+		//lock apenas lo devuelven. Antes de cada muestra se deja correr a las
+		//lectoras para que el lock ya este tomado para lectura.
+		xStopReaders = pdFALSE;
+		for(uxTask = 0; uxTask < benchSTREAM_READERS; uxTask++)
+		{
+			xTaskCreate(prvStreamReaderTask, (signed char*) "Stream", benchSTACK_SIZE, NULL, benchHELPER_TASK_PRIORITY, &xReaders[uxTask]);
+		}
+		for(i = 0; i < benchSAMPLES; i++)
+		{
+			vTaskDelay(1);
+			ulStart = prvTimestamp();
+			xTaken = xSemaphoreTakeWrite(xReadWriteLock, benchWRITER_TIMEOUT);
+			aulSamples[i] = prvTimestamp() - ulStart;
+			if(xTaken == pdTRUE)
+			{
+				xSemaphoreGiveWrite(xReadWriteLock);
+			}
+		}
+		xStopReaders = pdTRUE;
+		vTaskDelay(benchSETTLE_TICKS);
+		for(uxTask = 0; uxTask < benchSTREAM_READERS; uxTask++)
+		{
+			vTaskDelete(xReaders[uxTask]);
+		}
+		vTaskDelay(benchSETTLE_TICKS);
+		prvReport("rwlock write, readers");
+	}
+
+	if(xStartQueue != NULL)
+	{
+		vQueueDelete(xStartQueue);
+	}
+	if(xReadWriteLock != NULL)
+	{
+		vSemaphoreDelete(xReadWriteLock);
+	}
+#endif
+
+	//Crear y eliminar una tarea de menor prioridad, que nunca llega a ejecutar.
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		xTaskCreate(prvYieldTask, (signed char*) "Churn", benchSTACK_SIZE, NULL, tskIDLE_PRIORITY, &xHelper);
+		vTaskDelete(xHelper);
+		aulSamples[i] = prvTimestamp() - ulStart;
+	}
+	prvReport("task create+delete");
+
+	//Latencia de una interrupcion disparada mientras la misma tarea tiene el
+	//scheduler suspendido durante benchSECTION_US. Suspender el scheduler no
+	//debe enmascarar las interrupciones del nucleo que lo suspende.
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		vTaskSuspendAll();
+		ulStart = prvTimestamp();
+		prvTriggerInterrupt();
+		while((prvTimestamp() - ulStart) < benchUS_TO_UNITS(benchSECTION_US))
+		{
+		}
+		xTaskResumeAll();
+		aulSamples[i] = ulInterruptStamp - ulStart;
+	}
+	prvReport("interrupt in sched lock");
+
+#if ( configNUM_CORES == 1 )
+	//Latencia desde que se dispara la interrupcion hasta que ejecuta la tarea
+	//reanudada con xTaskResumeFromISR.
+	xTaskCreate(prvResumedTask, (signed char*) "Resumed", benchSTACK_SIZE, NULL, benchHELPER_TASK_PRIORITY, &xResumedTask);
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		prvTriggerInterrupt();
+		aulSamples[i] = ulHelperStamp - ulStart;
+	}
+	prvDeleteHelper(xResumedTask);
+	xResumedTask = NULL;
+	prvReport("resume from ISR");
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+	//Notificacion directa a una tarea bloqueada de mayor prioridad, desde una
+	//tarea y desde la interrupcion.
+	xTaskCreate(prvNotifiedTask, (signed char*) "Notified", benchSTACK_SIZE, NULL, benchHELPER_TASK_PRIORITY, &xNotifiedTask);
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		xTaskNotifyGive(xNotifiedTask);
+		aulSamples[i] = ulHelperStamp - ulStart;
+	}
+	prvReport("notify give, waiter");
+
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		prvTriggerInterrupt();
+		aulSamples[i] = ulHelperStamp - ulStart;
+	}
+	prvDeleteHelper(xNotifiedTask);
+	xNotifiedTask = NULL;
+	prvReport("notify give from ISR");
+#endif
+
+	//Costo de bloquearse con timeout cuando ya hay N tareas demoradas. Incluye
+	//el camino de xQueueReceive y el cambio de contexto de vuelta.
+	for(uxRun = 0; uxRun < (sizeof(xBlockedRuns) / sizeof(xBlockedRuns[0])); uxRun++)
+	{
+		for(uxTask = 0; uxTask < xBlockedRuns[uxRun].uxBlockedTasks; uxTask++)
+		{
+			xTaskCreate(prvBackgroundTask, (signed char*) "Delayed", configMINIMAL_STACK_SIZE, NULL, benchHELPER_TASK_PRIORITY, &xBlockedTasks[uxTask]);
+		}
+
+		xTaskCreate(prvDelayedReceiveTask, (signed char*) "Rcv_Task", benchSTACK_SIZE, NULL, benchHELPER_TASK_PRIORITY, &xHelper);
+		for(i = 0; i < benchSAMPLES; i++)
+		{
+			xQueueSend(xQueue, &ulValue, 0);
+			aulSamples[i] = prvTimestamp() - ulHelperStamp;
+		}
+		prvDeleteHelper(xHelper);
+
+		for(uxTask = 0; uxTask < xBlockedRuns[uxRun].uxBlockedTasks; uxTask++)
+		{
+			vTaskDelete(xBlockedTasks[uxTask]);
+		}
+		vTaskDelay(benchSETTLE_TICKS);
+
+		prvReport(xBlockedRuns[uxRun].pcName);
+	}
+#endif
+
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+	//Retraso con que despierta una tarea demorada benchHIGH_RES_DELAY_US. La
+	//alarma del reloj de alta resolucion la despierta entre dos ticks; con
+	//vTaskDelay() el error seria de hasta un tick.
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ulStart = prvTimestamp();
+		vTaskDelayHighRes(benchHIGH_RES_DELAY_US);
+		aulSamples[i] = prvTimestamp() - ulStart - benchUS_TO_UNITS(benchHIGH_RES_DELAY_US);
+	}
+	prvReport("high res delay, late by");
+
+#if defined( __linux__ ) && ( configNUM_CORES == 1 )
+	//Lo mismo sin el kernel: un timer del host a un instante absoluto, como la
+	//alarma del port, esperado con sigwaitinfo() por la misma tarea. Es el
+	//retraso que pone el host por si solo.
+	prvHostAlarmOvershoot();
+	prvReport("absolute-timer overshoot");
+#endif
+#endif
+
+#if ( configRECORD_SECTION_LATENCY == 1 )
+	//Longitud que registra el kernel para una seccion critica y para un
+	//bloqueo del scheduler de benchSECTION_US. Antes de cada muestra se borran
+	//los registros; la seccion medida es la mas larga de las que quedan.
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		vTaskResetSectionLatencyStats(eLatencyCriticalSection);
+		taskENTER_CRITICAL();
+		ulStart = prvTimestamp();
+		while((prvTimestamp() - ulStart) < benchUS_TO_UNITS(benchSECTION_US))
+		{
+		}
+		taskEXIT_CRITICAL();
+		vTaskGetSectionLatencyStats(eLatencyCriticalSection, &xSectionLatency);
+		aulSamples[i] = xSectionLatency.xLongest[0].ulLength;
+	}
+	prvReport("critical section, 20us");
+
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		vTaskResetSectionLatencyStats(eLatencySchedulerSuspended);
+		vTaskSuspendAll();
+		ulStart = prvTimestamp();
+		while((prvTimestamp() - ulStart) < benchUS_TO_UNITS(benchSECTION_US))
+		{
+		}
+		xTaskResumeAll();
+		vTaskGetSectionLatencyStats(eLatencySchedulerSuspended, &xSectionLatency);
+		aulSamples[i] = xSectionLatency.xLongest[0].ulLength;
+	}
+	prvReport("scheduler lock, 20us");
+#endif
+
+#if ( configRECORD_WAKE_LATENCY == 1 )
+	prvReportWakeLatency();
+#endif
+
+#if defined( __linux__ )
+	exit(0);
+#else
+	vTaskSuspend(NULL);
+#endif
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Devuelve el procesador inmediatamente a la tarea de control.
+ */
+static void prvYieldTask(void *pvParameters)
+{
+	for( ;; )
+	{
+		taskYIELD();
+	}
+}
+//--------------------------------------------------------------------------------
+
+#if ( configNUM_CORES == 1 )
+
+/*
+ * Se bloquea en la cola y registra el instante en que despierta.
+ */
+static void prvReceiveTask(void *pvParameters)
+{
+	unsigned long ulReceivedValue;
+
+	for( ;; )
+	{
+		xQueueReceive(xQueue, &ulReceivedValue, portMAX_DELAY);
+		ulHelperStamp = prvTimestamp();
+	}
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Mantiene la cola llena, por lo que queda bloqueada en cada envio.
+ */
+static void prvSendTask(void *pvParameters)
+{
+	const unsigned long ulValueToSend = 2UL;
+
+	for( ;; )
+	{
+		xQueueSend(xQueue, &ulValueToSend, portMAX_DELAY);
+		ulHelperStamp = prvTimestamp();
+	}
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Se suspende a si misma hasta que la interrupcion la reanuda.
+ */
+static void prvResumedTask(void *pvParameters)
+{
+	for( ;; )
+	{
+		vTaskSuspend(NULL);
+		ulHelperStamp = prvTimestamp();
+	}
+}
+//--------------------------------------------------------------------------------
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+/*
+ * Espera una notificacion y registra el instante en que despierta.
+ */
+static void prvNotifiedTask(void *pvParameters)
+{
+	for( ;; )
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		ulHelperStamp = prvTimestamp();
+	}
+}
+
+#endif
+//--------------------------------------------------------------------------------
+
+/*
+ * Queda demorada durante toda la prueba de insercion.
+ */
+static void prvBackgroundTask(void *pvParameters)
+{
+	for( ;; )
+	{
+		vTaskDelay(benchBACKGROUND_DELAY);
+	}
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Registra el instante justo antes de bloquearse con un timeout mayor que el
+ * de todas las tareas de fondo.
+ */
+static void prvDelayedReceiveTask(void *pvParameters)
+{
+	unsigned long ulReceivedValue;
+
+	for( ;; )
+	{
+		ulHelperStamp = prvTimestamp();
+		xQueueReceive(xQueue, &ulReceivedValue, benchMEASURED_DELAY);
+	}
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Toma xChainMutex y se bloquea en xMutex, que tiene la tarea de control.
+ */
+static void prvChainHolderTask(void *pvParameters)
+{
+	for( ;; )
+	{
+		vTaskSuspend(NULL);
+		xSemaphoreTake(xChainMutex, portMAX_DELAY);
+		xSemaphoreTake(xMutex, portMAX_DELAY);
+		xSemaphoreGive(xMutex);
+		xSemaphoreGive(xChainMutex);
+	}
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Registra el instante antes de bloquearse en xChainMutex y el instante en que
+ * lo obtiene.
+ */
+static void prvChainWaiterTask(void *pvParameters)
+{
+	for( ;; )
+	{
+		vTaskSuspend(NULL);
+		ulHelperStamp = prvTimestamp();
+		xSemaphoreTake(xChainMutex, portMAX_DELAY);
+		ulHelperStamp = prvTimestamp();
+		xSemaphoreGive(xChainMutex);
+	}
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Ocupa el procesador durante benchINTERFERENCE_SPIN cada vez que se reanuda.
+ */
+static void prvInterferenceTask(void *pvParameters)
+{
+	unsigned long ulSpinStart;
+
+	for( ;; )
+	{
+		vTaskSuspend(NULL);
+		ulSpinStart = prvTimestamp();
+		while((prvTimestamp() - ulSpinStart) < benchINTERFERENCE_SPIN)
+		{
+		}
+	}
+}
+
+#endif
+//--------------------------------------------------------------------------------
+
+/*
+ * Por cada permiso recibido lee la tabla, con el mutex o con el lock de
+ * lectura/escritura segun xReadWithLock, hasta que se activa xStopReaders.
+ * Cada lectura recorre la tabla una y otra vez durante benchREAD_US y cuenta
+ * en el contador que indica el permiso.
+ */
+static void prvReaderTask(void *pvParameters)
+{
+	xQueueHandle xStartQueue = (xQueueHandle) pvParameters;
+	unsigned long ulSum = 0UL, ulReader, ulReadStart;
+	int j;
+
+	for( ;; )
+	{
+		xQueueReceive(xStartQueue, &ulReader, portMAX_DELAY);
+		while(xStopReaders == pdFALSE)
+		{
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+			if(xReadWithLock != pdFALSE)
+			{
+				xSemaphoreTakeRead(xReadWriteLock, portMAX_DELAY);
+			}
+			else
+#endif
+			{
+				xSemaphoreTake(xMutex, portMAX_DELAY);
+			}
+
+			ulReadStart = prvTimestamp();
+			do
+			{
+				ulSum = 0UL;
+				for(j = 0; j < benchTABLE_SIZE; j++)
+				{
+					ulSum += ulTable[j];
+				}
+				ulTableSum = ulSum;
+			} while((prvTimestamp() - ulReadStart) < benchUS_TO_UNITS(benchREAD_US));
+
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+			if(xReadWithLock != pdFALSE)
+			{
+				xSemaphoreGiveRead(xReadWriteLock);
+			}
+			else
+#endif
+			{
+				xSemaphoreGive(xMutex);
+			}
+			ulReaderReads[ulReader]++;
+		}
+		xQueueSend(xQueue, &ulSum, portMAX_DELAY);
+	}
+}
+//--------------------------------------------------------------------------------
+
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+
+/*
+ * Toma el lock para lectura, lo mantiene durante un tick y lo devuelve, hasta
+ * que se activa xStopReaders. Con varias lectoras asi el lock nunca queda
+ * libre salvo que una escritora haga esperar a las lectoras nuevas.
+ */
+static void prvStreamReaderTask(void *pvParameters)
+{
+	while(xStopReaders == pdFALSE)
+	{
+		if(xSemaphoreTakeRead(xReadWriteLock, benchWRITER_TIMEOUT) == pdTRUE)
+		{
+			vTaskDelay(1);
+			xSemaphoreGiveRead(xReadWriteLock);
+		}
+	}
+	vTaskSuspend(NULL);
+}
+
+#endif
+//--------------------------------------------------------------------------------
+
+/*
+ * Elimina una tarea auxiliar y deja correr a IDLE para liberar su memoria
+ * antes de la proxima prueba.
+ */
+static void prvDeleteHelper(xTaskHandle xHelper)
+{
+	vTaskDelete(xHelper);
+	vTaskDelay(benchSETTLE_TICKS);
+}
+//--------------------------------------------------------------------------------
+
+/*
+ * Ordena las muestras e informa min/avg/p99/max.
+ */
+static void prvReport(const char *pcName)
+{
+	unsigned long long ullTotal = 0ULL;
+	unsigned long ulValue;
+	int i, j;
+
+	//Insercion directa: benchSAMPLES es chico y no hace falta memoria extra.
+	for(i = 1; i < benchSAMPLES; i++)
+	{
+		ulValue = aulSamples[i];
+		for(j = i; (j > 0) && (aulSamples[j - 1] > ulValue); j--)
+		{
+			aulSamples[j] = aulSamples[j - 1];
+		}
+		aulSamples[j] = ulValue;
+	}
+
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		ullTotal += aulSamples[i];
+	}
+
+	prvPrintLine(pcName, aulSamples[0], (unsigned long) (ullTotal / benchSAMPLES),
+				 aulSamples[(benchSAMPLES * benchPERCENTILE) / 100], aulSamples[benchSAMPLES - 1]);
+}
+//--------------------------------------------------------------------------------
+
+#if ( configRECORD_WAKE_LATENCY == 1 )
+
+/*
+ * Informa la latencia medida por el kernel desde la entrada de cada
+ * interrupcion registrada hasta que ejecuta la tarea que desperto.
+ */
+static void prvReportWakeLatency(void)
+{
+	char cName[32];
+	unsigned portBASE_TYPE uxSources, uxSource, uxBucket;
+	unsigned long ulCount, ulBelow, ulP99;
+
+	uxSources = uxTaskGetWakeLatencyStats(xWakeLatency, benchMAX_WAKE_SOURCES);
+	for(uxSource = 0; uxSource < uxSources; uxSource++)
+	{
+		ulCount = xWakeLatency[uxSource].xStats.ulCount;
+		if(ulCount == 0UL)
+		{
+			continue;
+		}
+
+		//Solo se conoce el intervalo [2^n, 2^(n+1)) de cada latencia, se
+		//informa el limite superior del intervalo del percentil.
+		ulBelow = 0UL;
+		for(uxBucket = 0; uxBucket < 31; uxBucket++)
+		{
+			ulBelow += xWakeLatency[uxSource].xStats.ulHistogram[uxBucket];
+			if((unsigned long long) ulBelow * 100ULL >= (unsigned long long) ulCount * benchPERCENTILE)
+			{
+				break;
+			}
+		}
+		ulP99 = (uxBucket < 31) ? ((2UL << uxBucket) - 1UL) : 0xffffffffUL;
+		if(ulP99 > xWakeLatency[uxSource].xStats.ulMax)
+		{
+			ulP99 = xWakeLatency[uxSource].xStats.ulMax;
+		}
+
+		strcpy(cName, "wake from ");
+		strncat(cName, (const char *) xWakeLatency[uxSource].pcISRName, sizeof(cName) - strlen(cName) - 1);
+		prvPrintLine(cName, xWakeLatency[uxSource].xStats.ulMin,
+					 (unsigned long) (xWakeLatency[uxSource].xStats.ullTotal / ulCount),
+					 ulP99, xWakeLatency[uxSource].xStats.ulMax);
+	}
+}
+
+#endif
+//--------------------------------------------------------------------------------
+
+#if defined( __linux__ )
+
+static void prvInterruptHandler(int iSignal)
+{
+	portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+	taskENTER_ISR_RUN_TIME(xInterruptRunTime);
+
+	(void) iSignal;
+	ulInterruptStamp = prvTimestamp();
+	if(xResumedTask != NULL)
+	{
+		xHigherPriorityTaskWoken = xTaskResumeFromISR(xResumedTask);
+	}
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+	else if(xNotifiedTask != NULL)
+	{
+		vTaskNotifyGiveFromISR(xNotifiedTask, &xHigherPriorityTaskWoken);
+	}
+#endif
+	taskEXIT_ISR_RUN_TIME();
+	portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
+}
+//--------------------------------------------------------------------------------
+
+static void prvInitTimestamp(void)
+{
+}
+//--------------------------------------------------------------------------------
+
+static unsigned long prvTimestamp(void)
+{
+	struct timespec xNow;
+
+	clock_gettime(CLOCK_MONOTONIC, &xNow);
+	return (unsigned long) xNow.tv_sec * 1000000000UL + (unsigned long) xNow.tv_nsec;
+}
+//--------------------------------------------------------------------------------
+
+static void prvInitInterrupt(void)
+{
+	struct sigaction xAction;
+
+	//Igual que el tick del port: todas las senales bloqueadas en el handler.
+	memset(&xAction, 0, sizeof(xAction));
+	xAction.sa_handler = prvInterruptHandler;
+	sigfillset(&xAction.sa_mask);
+	sigaction(benchINTERRUPT_SIGNAL, &xAction, NULL);
+}
+//--------------------------------------------------------------------------------
+
+static void prvTriggerInterrupt(void)
+{
+	//Con varios nucleos raise() tambien va al hilo que la llama, es decir al
+	//nucleo de la tarea de control.
+	raise(benchINTERRUPT_SIGNAL);
+}
+//--------------------------------------------------------------------------------
+
+#if ( configUSE_HIGH_RES_DELAYS == 1 ) && ( configNUM_CORES == 1 )
+
+static void prvHostAlarmOvershoot(void)
+{
+	struct sigevent xEvent;
+	struct itimerspec xAlarm;
+	timer_t xTimer;
+	sigset_t xAlarmSignal;
+	unsigned long ulTarget;
+	int i;
+
+	//La senal va al proceso. Con un solo nucleo los demas hilos del port la
+	//tienen bloqueada y este tambien, dentro de la seccion critica, asi que
+	//solo sigwaitinfo() la recibe.
+	memset(&xEvent, 0, sizeof(xEvent));
+	xEvent.sigev_notify = SIGEV_SIGNAL;
+	xEvent.sigev_signo = benchHOST_ALARM_SIGNAL;
+	timer_create(CLOCK_MONOTONIC, &xEvent, &xTimer);
+	sigemptyset(&xAlarmSignal);
+	sigaddset(&xAlarmSignal, benchHOST_ALARM_SIGNAL);
+	memset(&xAlarm, 0, sizeof(xAlarm));
+
+	for(i = 0; i < benchSAMPLES; i++)
+	{
+		taskENTER_CRITICAL();
+		ulTarget = prvTimestamp() + benchUS_TO_UNITS(benchHIGH_RES_DELAY_US);
+		xAlarm.it_value.tv_sec = (time_t) (ulTarget / 1000000000UL);
+		xAlarm.it_value.tv_nsec = (long) (ulTarget % 1000000000UL);
+		timer_settime(xTimer, TIMER_ABSTIME, &xAlarm, NULL);
+		while(sigwaitinfo(&xAlarmSignal, NULL) < 0)
+		{
+		}
+		aulSamples[i] = prvTimestamp() - ulTarget;
+		taskEXIT_CRITICAL();
+	}
+
+	timer_delete(xTimer);
+}
+
+#endif
+//--------------------------------------------------------------------------------
+
+static void prvPrintLine(const char *pcName, unsigned long ulMin, unsigned long ulAvg, unsigned long ulP99, unsigned long ulMax)
+{
+	printf("%-24s min %6lu  avg %6lu  p99 %6lu  max %6lu %s\n", pcName, ulMin, ulAvg, ulP99, ulMax, benchUNITS);
+	fflush(stdout);
+}
+//--------------------------------------------------------------------------------
+
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+
+static void prvPrintRate(const char *pcName, unsigned long ulPerSecond)
+{
+	printf("%-24s %8lu reads/s\n", pcName, ulPerSecond);
+	fflush(stdout);
+}
+
+#endif
+//--------------------------------------------------------------------------------
+
+#else
+
+void EINT1_IRQHandler(void)
+{
+	portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+	taskENTER_ISR_RUN_TIME(xInterruptRunTime);
+
+	NVIC_ClearPendingIRQ(benchINTERRUPT_IRQn);
+	ulInterruptStamp = prvTimestamp();
+	if(xResumedTask != NULL)
+	{
+		xHigherPriorityTaskWoken = xTaskResumeFromISR(xResumedTask);
+	}
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+	else if(xNotifiedTask != NULL)
+	{
+		vTaskNotifyGiveFromISR(xNotifiedTask, &xHigherPriorityTaskWoken);
+	}
+#endif
+	taskEXIT_ISR_RUN_TIME();
+	portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
+}
+//--------------------------------------------------------------------------------
+
+static void prvInitTimestamp(void)
+{
+	//No se pone a cero: las muestras son diferencias, y el kernel lo usa
+	//para las estadísticas de tiempo de ejecución.
+	benchDEMCR_REG |= benchDEMCR_TRCENA_BIT;
+	benchDWT_CTRL_REG |= benchDWT_CYCCNTENA_BIT;
+}
+//--------------------------------------------------------------------------------
+
+static unsigned long prvTimestamp(void)
+{
+	return benchDWT_CYCCNT_REG;
+}
+//--------------------------------------------------------------------------------
+
+static void prvInitInterrupt(void)
+{
+	//La prioridad debe ser igual o menos urgente que
+	//configMAX_SYSCALL_INTERRUPT_PRIORITY para poder usar la API FromISR.
+	NVIC_SetPriority(benchINTERRUPT_IRQn, benchINTERRUPT_PRIORITY);
+	NVIC_EnableIRQ(benchINTERRUPT_IRQn);
+}
+//--------------------------------------------------------------------------------
+
+static void prvTriggerInterrupt(void)
+{
+	NVIC_SetPendingIRQ(benchINTERRUPT_IRQn);
+	__DSB();
+	__ISB();
+}
+//--------------------------------------------------------------------------------
+
+static void prvPrintLine(const char *pcName, unsigned long ulMin, unsigned long ulAvg, unsigned long ulP99, unsigned long ulMax)
+{
+	Serial_printString(benchUART, (char *) pcName);
+	Serial_printString(benchUART, ": min ");
+	Serial_printNumber(benchUART, ulMin, DEC);
+	Serial_printString(benchUART, " avg ");
+	Serial_printNumber(benchUART, ulAvg, DEC);
+	Serial_printString(benchUART, " p99 ");
+	Serial_printNumber(benchUART, ulP99, DEC);
+	Serial_printString(benchUART, " max ");
+	Serial_printNumber(benchUART, ulMax, DEC);
+	Serial_printString(benchUART, " " benchUNITS);
+	Serial_println(benchUART);
+}
+//--------------------------------------------------------------------------------
+
+#if ( configUSE_READ_WRITE_LOCKS == 1 )
+
+static void prvPrintRate(const char *pcName, unsigned long ulPerSecond)
+{
+	Serial_printString(benchUART, (char *) pcName);
+	Serial_printString(benchUART, ": ");
+	Serial_printNumber(benchUART, ulPerSecond, DEC);
+	Serial_printString(benchUART, " reads/s");
+	Serial_println(benchUART);
+}
+
+#endif
+//--------------------------------------------------------------------------------
+
+#endif
@@ -12,6 +12,10 @@
  *  The second task is to generate an aperiodic character string, then it is added to the same queue.
  *  The last task, of higher priority than the previous ones, obtains the elements of the queue
  *  and sends them to the PC via serial port.
+ *  The "queue" is a buffer channel paired with a buffer pool: a producer takes a free
+ *  record from the pool, fills it in and sends only its address, and the receiver
+ *  gives the record back to the pool once it has been transmitted. A record therefore
+ *  belongs to one task at a time and is never copied or overwritten while in use.
  *  The Tracealyzer tool made it possible to appreciate the moments in which the tasks
  *  were suspended and resumed, the periodicity of the tasks, the execution times,
  *  among other characteristics. Being able to fulfill the objective of the project.
@@ -21,9 +25,11 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
+#include "buffer_pool.h"
 #include "serial.h"
 #include <time.h>
 #include <stdlib.h>
+#include <string.h>
 
 /*
  * Prioridades (en función de IDLE que está seteada en 0).
@@ -35,6 +41,10 @@
 //Frecuencia con que se envían datos (1000 ms).
 #define mainQUEUE_SEND_FREQUENCY_MS			(1000 / portTICK_RATE_MS)
 
+//Cantidad de registros del pool y máximo de datos por registro.
+#define mainPOOL_BLOCKS						4
+#define mainMAX_DATA_LENGTH					20
+
 //Funciones manejadoras de las tareas.
 static void prvQueueReceiveTask( void *pvParameters );
 static void prvQueueSendTask( void *pvParameters );
@@ -45,13 +55,26 @@ typedef enum INFO_TYPE{
 	TempType_t,
 	UserType_t
 } eInfoType_t;
+//Cada registro lleva el tipo, la cantidad de datos y los datos.
 typedef struct TASK_INFO{
 	eInfoType_t eInfoType;
-	void* pvData;
+	size_t xLength;
+	char cData[mainMAX_DATA_LENGTH];
 } xTaskInfo;
 
-//Definición de la cola.
-static xQueueHandle xQueue = NULL;
+static void prvSendInfo(eInfoType_t eInfoType, const void *pvData, size_t xDataLength);
+
+//Pool de registros y canal por el que se pasan sus direcciones.
+static xBufferPoolHandle xPool = NULL;
+static xQueueHandle xChannel = NULL;
+
+//TCB y stack de cada tarea (y de la tarea IDLE), reservados en tiempo de
+//compilación para que el mapa del linker muestre el uso real de RAM.
+static xStaticTask xReceiveTaskTCB, xSendTaskTCB, xUARTTaskTCB, xIdleTaskTCB;
+static portSTACK_TYPE uxReceiveTaskStack[configMINIMAL_STACK_SIZE];
+static portSTACK_TYPE uxSendTaskStack[configMINIMAL_STACK_SIZE];
+static portSTACK_TYPE uxUARTTaskStack[configMINIMAL_STACK_SIZE];
+static portSTACK_TYPE uxIdleTaskStack[configMINIMAL_STACK_SIZE];
 
 //--------------------------------------------------------------------------------
 
@@ -63,18 +86,23 @@ int main(void)
 	//Inicia el traicing de la memoria mediante TraceAnalizer
 	vTraceEnable(TRC_START);
 
-	//Se crea la cola indicando la cantidad de elementos maximos.
-	xQueue = xQueueCreate(1, sizeof(struct xTaskInfo *));
+	//Se crea el pool de registros y un canal con lugar para todos ellos,
+	//de modo que enviar un registro nunca tenga que esperar.
+	xPool = xBufferPoolCreate(mainPOOL_BLOCKS, sizeof(xTaskInfo));
+	xChannel = xBufferChannelCreate(mainPOOL_BLOCKS);
 
-	if(xQueue != NULL)
+	if((xPool != NULL) && (xChannel != NULL))
 	{
-		//Se inician las tareas
-		xTaskCreate(prvQueueReceiveTask, (signed char*) "Rcv_Task",
-				    configMINIMAL_STACK_SIZE, NULL, mainQUEUE_RECEIVE_TASK_PRIORITY, NULL);
-		xTaskCreate(prvQueueSendTask, (signed char*) "Snd_Task",
-				    configMINIMAL_STACK_SIZE, NULL, mainQUEUE_SEND_TASK_PRIORITY, NULL);
-		xTaskCreate(prvUARTTask, (signed char*) "UART_Task",
-				    configMINIMAL_STACK_SIZE, NULL, mainQUEUE_UART_TASK_PRIORITY, NULL);
+		//Se inician las tareas sobre sus buffers estáticos (no usan el heap).
+		xTaskCreateStatic(prvQueueReceiveTask, (signed char*) "Rcv_Task",
+				    configMINIMAL_STACK_SIZE, NULL, mainQUEUE_RECEIVE_TASK_PRIORITY,
+				    uxReceiveTaskStack, &xReceiveTaskTCB);
+		xTaskCreateStatic(prvQueueSendTask, (signed char*) "Snd_Task",
+				    configMINIMAL_STACK_SIZE, NULL, mainQUEUE_SEND_TASK_PRIORITY,
+				    uxSendTaskStack, &xSendTaskTCB);
+		xTaskCreateStatic(prvUARTTask, (signed char*) "UART_Task",
+				    configMINIMAL_STACK_SIZE, NULL, mainQUEUE_UART_TASK_PRIORITY,
+				    uxUARTTaskStack, &xUARTTaskTCB);
 
 		//Se lanza el scheduler.
 		vTaskStartScheduler();
@@ -88,26 +116,30 @@ int main(void)
 static void prvQueueReceiveTask(void *pvParameters)
 {
 	static unsigned short usReceivedValue;
-	static char* cReceivedValue;
-	static xTaskInfo* Data;
+	xTaskInfo *pxData;
+	size_t i;
 	for( ;; ){
-	// Se bloquea la tarea hasta que haya elemento en la cola
+	// Se bloquea la tarea hasta que llegue un registro por el canal
 	// Luego se comprueba que tipo de dato es y realiza el envio.
-		xQueueReceive(xQueue, &Data, portMAX_DELAY);
+		pxData = (xTaskInfo *) pvBufferChannelReceive(xChannel, portMAX_DELAY);
+		if(pxData == NULL)
+			continue;
 
-		if(Data->eInfoType == TempType_t)
+		if(pxData->eInfoType == TempType_t)
 		{
-			usReceivedValue = *((unsigned short*) Data->pvData);
+			memcpy(&usReceivedValue, pxData->cData, sizeof(usReceivedValue));
 			Serial_write(3, usReceivedValue);
 		}
-		else if (Data->eInfoType == UserType_t)
+		else if (pxData->eInfoType == UserType_t)
 		{
-			cReceivedValue = ((char*) Data->pvData);
 			//Si es de tipo UserType envia caracter por caracter.
-			while(*cReceivedValue != '\0'){
-				Serial_write(3, *cReceivedValue);
-				cReceivedValue++;}
-		}}
+			for(i = 0; i < pxData->xLength; i++)
+				Serial_write(3, pxData->cData[i]);
+		}
+
+		//El registro ya se transmitió, se devuelve al pool.
+		vBufferPoolRelease(xPool, pxData);
+	}
 }
 //--------------------------------------------------------------------------------
 
@@ -132,18 +164,16 @@ static void prvUARTTask(void *pvParameters)
 		// se carga la estructura con los datos
 		if(lss != 0 && lss != -1)
 		{
-		static xTaskInfo Data;
-		static xTaskInfo* ptr = &Data;
-		ptr->eInfoType = UserType_t;
+		const char *pcText = "";
 		int r = rand() % 3;
 		if(r == 0)
-			ptr->pvData = "tp4";
+			pcText = "tp4";
 		else if(r == 1)
-			ptr->pvData = "Sistemas";
+			pcText = "Sistemas";
 		else if (r == 2)
-			ptr->pvData = "sistemasOperativos";
-		// se envia a la cola para ser transmitido
-		xQueueSend(xQueue, (void *)&ptr, 0);
+			pcText = "sistemasOperativos";
+		// se copia el texto al buffer para ser transmitido
+		prvSendInfo(UserType_t, pcText, strlen(pcText));
 		}
 
 	}
@@ -158,6 +188,12 @@ static void prvQueueSendTask(void *pvParameters)
 	static unsigned short usValueToSend;
 	portTickType xNextWakeTime = xTaskGetTickCount();
 
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+	//Cada dato debe quedar en el buffer antes de que se genere el siguiente,
+	//por lo que el plazo de cada trabajo es igual al período.
+	vTaskSetDeadline(NULL, mainQUEUE_SEND_FREQUENCY_MS);
+	#endif
+
 	srand(time(NULL));
 
 	for( ;; )
@@ -168,13 +204,41 @@ static void prvQueueSendTask(void *pvParameters)
 		//Genera la temperatura
 		usValueToSend = (rand() % 20) + 20;
 
-		//Creo la estructura
-		static xTaskInfo Data;
-		static xTaskInfo* ptr = &Data;
-		//Asigno los valores a la estructura.
-		ptr->eInfoType = TempType_t;
-		ptr->pvData = &usValueToSend;
-		//envio el dato a la cola.
-		xQueueSend(xQueue, (void *)&ptr, 0);
+		//envio el dato al buffer.
+		prvSendInfo(TempType_t, &usValueToSend, sizeof(usValueToSend));
 	}
 }
+//--------------------------------------------------------------------------------
+
+//Toma un registro libre del pool, lo completa con el tipo y los datos y
+//envía su dirección por el canal. A partir de ahí el registro pertenece a la
+//tarea receptora, que es la que lo devuelve al pool.
+static void prvSendInfo(eInfoType_t eInfoType, const void *pvData, size_t xDataLength)
+{
+	xTaskInfo *pxData;
+
+	pxData = (xTaskInfo *) pvBufferPoolAcquire(xPool, portMAX_DELAY);
+	if(pxData == NULL)
+		return;
+
+	if(xDataLength > sizeof(pxData->cData))
+		xDataLength = sizeof(pxData->cData);
+
+	pxData->eInfoType = eInfoType;
+	pxData->xLength = xDataLength;
+	memcpy(pxData->cData, pvData, xDataLength);
+
+	xBufferChannelSend(xChannel, pxData, portMAX_DELAY);
+}
+
+/*
+ * Memoria de la tarea IDLE, pedida por el kernel al lanzar el scheduler
+ * cuando configSUPPORT_STATIC_ALLOCATION vale 1.
+ */
+void vApplicationGetIdleTaskMemory(xStaticTask **ppxIdleTaskTCBBuffer, portSTACK_TYPE **ppxIdleTaskStackBuffer, unsigned short *pusIdleTaskStackSize)
+{
+	*ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+	*ppxIdleTaskStackBuffer = uxIdleTaskStack;
+	*pusIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+//--------------------------------------------------------------------------------
@@ -67,6 +67,8 @@ extern unsigned int SystemCoreClock;
 #define configIDLE_SHOULD_YIELD		0
 #define configUSE_CO_ROUTINES 		0
 #define configUSE_MUTEXES			1
+#define configUSE_PRIORITY_CEILING_MUTEXES	1
+#define configUSE_READ_WRITE_LOCKS		1
 
 #define configMAX_CO_ROUTINE_PRIORITIES ( 3 )
 
@@ -75,8 +77,39 @@ extern unsigned int SystemCoreClock;
 #define configCHECK_FOR_STACK_OVERFLOW	0
 #define configUSE_RECURSIVE_MUTEXES		0
 #define configQUEUE_REGISTRY_SIZE		0
-#define configGENERATE_RUN_TIME_STATS	0
+
+/* Run time is counted in core clock cycles by the DWT cycle counter, which
+portmacro.h sets up.  The TIMER0 tick and the UART3 interrupt are accounted for
+separately from the tasks they interrupt. */
+#define configGENERATE_RUN_TIME_STATS	1
+
+/* Set to 1 to time every critical section and scheduler lock against the
+same clock, see vTaskGetSectionLatencyStats(). */
+#define configRECORD_SECTION_LATENCY	0
+
+/* Times each task readied by the tick or UART3 from the interrupt's entry to
+the task being switched in, see uxTaskGetWakeLatencyStats(). */
+#define configRECORD_WAKE_LATENCY		1
+
 #define configUSE_MALLOC_FAILED_HOOK	0
+#define configSUPPORT_STATIC_ALLOCATION	1
+
+/* 2 selects the TIMER0 tick and tickless idle in inc/tickless.c instead of the
+SysTick implementation in port.c. */
+#define configUSE_TICKLESS_IDLE			2
+
+/* TIMER0 is also the clock for vTaskDelayHighRes(), with match register 1 as
+the alarm that wakes tasks in between ticks.  Needs configUSE_TICKLESS_IDLE 2. */
+#define configUSE_HIGH_RES_DELAYS		1
+
+/* Tasks given a deadline with vTaskSetDeadline() are scheduled earliest
+deadline first among the ready tasks of their priority. */
+#define configUSE_EDF_SCHEDULING		1
+
+/* Tasks of equal priority take turns every configDEFAULT_TIME_SLICE_TICKS
+ticks, unless given a slice of their own with vTaskSetTimeSlice(). */
+#define configUSE_TASK_TIME_SLICES		1
+#define configDEFAULT_TIME_SLICE_TICKS	1
 
 /* Set the following definitions to 1 to include the API function, or zero
 to exclude the API function. */
@@ -24,9 +24,14 @@
 
 volatile uint32_t UART0Status, UART1Status, UART3Status;
 volatile uint8_t UART0TxEmpty = 1, UART1TxEmpty = 1, UART3TxEmpty=1;
-volatile uint8_t UART0Buffer[UARTRXQUEUESIZE], UART1Buffer[UARTRXQUEUESIZE], UART3Buffer[UARTRXQUEUESIZE];
-volatile uint32_t UART0RxQueueWritePos = 0, UART1RxQueueWritePos = 0, UART3RxQueueWritePos = 0;
-volatile uint32_t UART0RxQueueReadPos = 0, UART1RxQueueReadPos = 0, UART3RxQueueReadPos = 0;
+xStreamBufferHandle UART0RxStream = NULL, UART1RxStream = NULL, UART3RxStream = NULL;
+
+static xStreamBufferHandle Serial_rxStream (uint32_t portNum);
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+/* Run time of the UART3 handler, registered by Serial_begin(3, ...). */
+static xISRRunTimeStats UART3RunTime;
+#endif
 
 /*****************************************************************************
 ** Function name:		UART0_IRQHandler
@@ -41,6 +46,9 @@ void UART0_IRQHandler (void)
 {
   uint8_t IIRValue, LSRValue;
   uint8_t Dummy = Dummy;
+  uint8_t RxBytes[UARTRXFIFOSIZE];
+  uint32_t RxCount;
+  portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 
   IIRValue = LPC_UART0->IIR;
 
@@ -63,26 +71,25 @@ void UART0_IRQHandler (void)
 	{
 	  /* If no error on RLS, normal ready, save into the data buffer. */
 	  /* Note: read RBR will clear the interrupt */
-		  if ((UART0RxQueueWritePos+1) % UARTRXQUEUESIZE != UART0RxQueueReadPos)
-		  {
-			  UART0Buffer[UART0RxQueueWritePos] = LPC_UART0->RBR;
-			  UART0RxQueueWritePos = (UART0RxQueueWritePos+1) % UARTRXQUEUESIZE;
-		  }
-	}
-  }
-  else if ( IIRValue == IIR_RDA )	/* Receive Data Available */
-  {
-	/* Receive Data Available */
-	  if ((UART0RxQueueWritePos+1) % UARTRXQUEUESIZE != UART0RxQueueReadPos)
+	  RxCount = 0;
+	  while ( ( RxCount < sizeof(RxBytes) ) && ( LPC_UART0->LSR & LSR_RDR ) )
 	  {
-		  UART0Buffer[UART0RxQueueWritePos] = LPC_UART0->RBR;
-		  UART0RxQueueWritePos = (UART0RxQueueWritePos+1) % UARTRXQUEUESIZE;
+		RxBytes[RxCount++] = LPC_UART0->RBR;
 	  }
+	  ( void ) xStreamBufferSendFromISR(UART0RxStream, RxBytes, RxCount, &xHigherPriorityTaskWoken);
+	}
   }
-  else if ( IIRValue == IIR_CTI )	/* Character timeout indicator */
+  else if ( ( IIRValue == IIR_RDA ) || ( IIRValue == IIR_CTI ) )	/* Receive Data Available or Character timeout */
   {
-	/* Character Time-out indicator */
-	UART0Status |= 0x100;		/* Bit 9 as the CTI error */
+	/* The RX FIFO trigger level is 8 bytes and a character timeout flags
+	any bytes left below it, so drain the FIFO and pass everything to the
+	stream buffer in one copy.  Bytes that do not fit are dropped. */
+	RxCount = 0;
+	while ( ( RxCount < sizeof(RxBytes) ) && ( LPC_UART0->LSR & LSR_RDR ) )
+	{
+	  RxBytes[RxCount++] = LPC_UART0->RBR;
+	}
+	( void ) xStreamBufferSendFromISR(UART0RxStream, RxBytes, RxCount, &xHigherPriorityTaskWoken);
   }
   else if ( IIRValue == IIR_THRE )	/* THRE, transmit holding register empty */
   {
@@ -98,6 +105,7 @@ void UART0_IRQHandler (void)
 	  UART0TxEmpty = 0;
 	}
   }
+  portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 }
 
 /*****************************************************************************
@@ -113,6 +121,9 @@ void UART1_IRQHandler (void)
 {
   uint8_t IIRValue, LSRValue;
   uint8_t Dummy = Dummy;
+  uint8_t RxBytes[UARTRXFIFOSIZE];
+  uint32_t RxCount;
+  portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 
   IIRValue = LPC_UART1->IIR;
 
@@ -135,26 +146,22 @@ void UART1_IRQHandler (void)
 	{
 	  /* If no error on RLS, normal ready, save into the data buffer. */
 	  /* Note: read RBR will clear the interrupt */
-	  if ((UART1RxQueueWritePos+1) % UARTRXQUEUESIZE != UART1RxQueueReadPos)
+	  RxCount = 0;
+	  while ( ( RxCount < sizeof(RxBytes) ) && ( LPC_UART1->LSR & LSR_RDR ) )
 	  {
-		  UART1Buffer[UART1RxQueueWritePos] = LPC_UART1->RBR;
-		  UART1RxQueueWritePos =(UART1RxQueueWritePos+1) % UARTRXQUEUESIZE;
+		RxBytes[RxCount++] = LPC_UART1->RBR;
 	  }
+	  ( void ) xStreamBufferSendFromISR(UART1RxStream, RxBytes, RxCount, &xHigherPriorityTaskWoken);
 	}
   }
-  else if ( IIRValue == IIR_RDA )	/* Receive Data Available */
-  {
-	/* Receive Data Available */
-	  if ((UART1RxQueueWritePos+1) % UARTRXQUEUESIZE != UART1RxQueueReadPos)
-	  {
-		  UART1Buffer[UART1RxQueueWritePos] = LPC_UART1->RBR;
-		  UART1RxQueueWritePos = (UART1RxQueueWritePos+1) % UARTRXQUEUESIZE;
-	  }
-  }
-  else if ( IIRValue == IIR_CTI )	/* Character timeout indicator */
+  else if ( ( IIRValue == IIR_RDA ) || ( IIRValue == IIR_CTI ) )	/* Receive Data Available or Character timeout */
   {
-	/* Character Time-out indicator */
-	UART1Status |= 0x100;		/* Bit 9 as the CTI error */
+	RxCount = 0;
+	while ( ( RxCount < sizeof(RxBytes) ) && ( LPC_UART1->LSR & LSR_RDR ) )
+	{
+	  RxBytes[RxCount++] = LPC_UART1->RBR;
+	}
+	( void ) xStreamBufferSendFromISR(UART1RxStream, RxBytes, RxCount, &xHigherPriorityTaskWoken);
   }
   else if ( IIRValue == IIR_THRE )	/* THRE, transmit holding register empty */
   {
@@ -170,8 +177,7 @@ void UART1_IRQHandler (void)
 	  UART1TxEmpty = 0;
 	}
   }
-  //vTaskResume(xHandle);
-  //xTaskResumeFromISR(xHandle);
+  portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 }
 /*****************************************************************************
 ** Function name:		UART3_IRQHandler
@@ -186,6 +192,10 @@ void UART3_IRQHandler (void)
 {
   uint8_t IIRValue, LSRValue;
   uint8_t Dummy = Dummy;
+  uint8_t RxBytes[UARTRXFIFOSIZE];
+  uint32_t RxCount;
+  portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+  taskENTER_ISR_RUN_TIME(UART3RunTime);
 
   IIRValue = LPC_UART3->IIR;
 
@@ -202,34 +212,27 @@ void UART3_IRQHandler (void)
 	  UART3Status = LSRValue;
 	  Dummy = LPC_UART3->RBR;		/* Dummy read on RX to clear
 							interrupt, then bail out */
-	  return;
 	}
-	if ( LSRValue & LSR_RDR )	/* Receive Data Ready */
+	else if ( LSRValue & LSR_RDR )	/* Receive Data Ready */
 	{
-		xTaskResumeFromISR(xHandle);
 	  /* If no error on RLS, normal ready, save into the data buffer. */
 	  /* Note: read RBR will clear the interrupt */
-		 if ((UART3RxQueueWritePos+1) % UARTRXQUEUESIZE != UART3RxQueueReadPos)
-		  {
-			  UART3Buffer[UART3RxQueueWritePos] = LPC_UART3->RBR;
-			  UART3RxQueueWritePos = (UART3RxQueueWritePos+1) % UARTRXQUEUESIZE;
-		  }
-	}
-  }
-  else if ( IIRValue == IIR_RDA )	/* Receive Data Available */
-  {
-	  xTaskResumeFromISR(xHandle);
-	/* Receive Data Available */
-	  if ((UART3RxQueueWritePos+1) % UARTRXQUEUESIZE != UART3RxQueueReadPos)
+	  RxCount = 0;
+	  while ( ( RxCount < sizeof(RxBytes) ) && ( LPC_UART3->LSR & LSR_RDR ) )
 	  {
-		  UART3Buffer[UART3RxQueueWritePos] = LPC_UART3->RBR;
-		  UART3RxQueueWritePos = (UART3RxQueueWritePos+1) % UARTRXQUEUESIZE;
+		RxBytes[RxCount++] = LPC_UART3->RBR;
 	  }
+	  ( void ) xStreamBufferSendFromISR(UART3RxStream, RxBytes, RxCount, &xHigherPriorityTaskWoken);
+	}
   }
-  else if ( IIRValue == IIR_CTI )	/* Character timeout indicator */
+  else if ( ( IIRValue == IIR_RDA ) || ( IIRValue == IIR_CTI ) )	/* Receive Data Available or Character timeout */
   {
-	/* Character Time-out indicator */
-	UART3Status |= 0x100;		/* Bit 9 as the CTI error */
+	RxCount = 0;
+	while ( ( RxCount < sizeof(RxBytes) ) && ( LPC_UART3->LSR & LSR_RDR ) )
+	{
+	  RxBytes[RxCount++] = LPC_UART3->RBR;
+	}
+	( void ) xStreamBufferSendFromISR(UART3RxStream, RxBytes, RxCount, &xHigherPriorityTaskWoken);
   }
   else if ( IIRValue == IIR_THRE )	/* THRE, transmit holding register empty */
   {
@@ -246,8 +249,8 @@ void UART3_IRQHandler (void)
 	}
   }
 
-  //vTaskResume(xHandle);
-  //xTaskResumeFromISR( xHandle );
+  taskEXIT_ISR_RUN_TIME();
+  portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 }
 
 
@@ -298,7 +301,12 @@ void Serial_begin( uint8_t PortNum, uint32_t baudrate )
     LPC_UART0->DLM = Fdiv / 256;
     LPC_UART0->DLL = Fdiv % 256;
 	LPC_UART0->LCR = 0x03;		/* DLAB = 0 */
-    LPC_UART0->FCR = 0x07;		/* Enable and reset TX and RX FIFO. */
+    LPC_UART0->FCR = 0x87;		/* Enable and reset TX and RX FIFO, RX trigger at 8 bytes. */
+
+	if ( UART0RxStream == NULL )
+	{
+	  UART0RxStream = xStreamBufferCreate(UARTRXQUEUESIZE, 1);
+	}
 
    	NVIC_EnableIRQ(UART0_IRQn);
 
@@ -335,7 +343,12 @@ void Serial_begin( uint8_t PortNum, uint32_t baudrate )
     LPC_UART1->DLM = Fdiv / 256;
     LPC_UART1->DLL = Fdiv % 256;
 	LPC_UART1->LCR = 0x03;		/* DLAB = 0 */
-    LPC_UART1->FCR = 0x07;		/* Enable and reset TX and RX FIFO. */
+    LPC_UART1->FCR = 0x87;		/* Enable and reset TX and RX FIFO, RX trigger at 8 bytes. */
+
+	if ( UART1RxStream == NULL )
+	{
+	  UART1RxStream = xStreamBufferCreate(UARTRXQUEUESIZE, 1);
+	}
 
    	NVIC_EnableIRQ(UART1_IRQn);
 
@@ -371,7 +384,15 @@ void Serial_begin( uint8_t PortNum, uint32_t baudrate )
 	  LPC_UART3->DLM = Fdiv / 256;
 	  LPC_UART3->DLL = Fdiv % 256;
 	  LPC_UART3->LCR = 0x03;		/* DLAB = 0 */
-	  LPC_UART3->FCR = 0x07;		/* Enable and reset TX and RX FIFO. */
+	  LPC_UART3->FCR = 0x87;		/* Enable and reset TX and RX FIFO, RX trigger at 8 bytes. */
+
+	  if ( UART3RxStream == NULL )
+	  {
+	    UART3RxStream = xStreamBufferCreate(UARTRXQUEUESIZE, 1);
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	    vTaskRegisterISRRunTimeStats(&UART3RunTime, (const signed char *) "UART3");
+#endif
+	  }
 
 	  NVIC_EnableIRQ(UART3_IRQn);
 
@@ -486,29 +507,49 @@ void Serial_printcr ( uint32_t portNum )
 }
 
 /*****************************************************************************
-** Function name:		Serial_available
+** Function name:		Serial_rxStream
 **
-** Descriptions:		Returns the bytes inside the RX FIFO ringbuffer
+** Descriptions:		Maps a port number to its RX stream buffer
 **
 ** parameters:			portNum(0,1 or 3)
-** Returned value:		number of bytes in the RX FIFO ringbuffer
+** Returned value:		stream buffer handle, NULL if the port has not
+**						been initialised with Serial_begin
 **
 *****************************************************************************/
-uint8_t Serial_available (uint32_t portNum)
+static xStreamBufferHandle Serial_rxStream (uint32_t portNum)
 {
 	  if ( portNum == 0 )
 	  {
-		  return (UART0RxQueueWritePos + UARTRXQUEUESIZE - UART0RxQueueReadPos) % UARTRXQUEUESIZE;
+		  return UART0RxStream;
 	  }
 	  if ( portNum == 1 )
 	  {
-		  return (UART1RxQueueWritePos + UARTRXQUEUESIZE - UART1RxQueueReadPos) % UARTRXQUEUESIZE;
+		  return UART1RxStream;
 	  }
 	  if ( portNum == 3 )
 	  {
-		  return (UART3RxQueueWritePos + UARTRXQUEUESIZE - UART3RxQueueReadPos) % UARTRXQUEUESIZE;
+		  return UART3RxStream;
 	  }
+	  return NULL;
+}
+
+/*****************************************************************************
+** Function name:		Serial_available
+**
+** Descriptions:		Returns the bytes inside the RX stream buffer
+**
+** parameters:			portNum(0,1 or 3)
+** Returned value:		number of bytes in the RX stream buffer
+**
+*****************************************************************************/
+uint8_t Serial_available (uint32_t portNum)
+{
+	xStreamBufferHandle xStream = Serial_rxStream(portNum);
+
+	if ( xStream == NULL )
 	  return 0;
+
+	return (uint8_t) xStreamBufferBytesAvailable(xStream);
 }
 
 /*****************************************************************************
@@ -522,44 +563,44 @@ uint8_t Serial_available (uint32_t portNum)
 *****************************************************************************/
 int16_t Serial_read (uint32_t portNum)
 {
+	xStreamBufferHandle xStream = Serial_rxStream(portNum);
 	uint8_t rx;
-	if ( portNum == 0 )
-	  {
-		  if (UART0RxQueueReadPos == UART0RxQueueWritePos)
-		    return -1;
 
-		  // Read from "head"
-		  rx = UART0Buffer[UART0RxQueueReadPos]; // grab next byte
-		  UART0RxQueueReadPos = (UART0RxQueueReadPos + 1) % UARTRXQUEUESIZE;
-		  return rx;
-	  }
-	  if ( portNum == 1 )
-	  {
-		  if (UART1RxQueueReadPos == UART1RxQueueWritePos)
-		    return -1;
+	if ( xStream == NULL )
+	  return 0;
 
-		  // Read from "head"
-		  rx = UART1Buffer[UART1RxQueueReadPos]; // grab next byte
-		  UART1RxQueueReadPos = (UART1RxQueueReadPos + 1) % UARTRXQUEUESIZE;
-		  return rx;
-	  }
-	  if ( portNum == 3 )
-	  {
-		  if (UART3RxQueueReadPos == UART3RxQueueWritePos)
-		    return -1;
+	if ( xStreamBufferReceive(xStream, &rx, 1, 0) == 0 )
+	  return -1;
 
-		  // Read from "head"
-		  rx = UART3Buffer[UART3RxQueueReadPos]; // grab next byte
-		  UART3RxQueueReadPos = (UART3RxQueueReadPos + 1) % UARTRXQUEUESIZE;
-		  return rx;
-	  }
+	return rx;
+}
+
+/*****************************************************************************
+** Function name:		Serial_readBytes
+**
+** Descriptions:		Copies up to length bytes out of the RX stream
+**						buffer, blocking the calling task while it is
+**						empty.  Only one task may read from each port.
+**
+** parameters:			portNum(0,1 or 3), destination buffer, its size
+**						and the maximum ticks to wait for the first byte
+** Returned value:		number of bytes copied (0 on timeout)
+**
+*****************************************************************************/
+uint32_t Serial_readBytes (uint32_t portNum, uint8_t *BufferPtr, uint32_t length, portTickType xTicksToWait)
+{
+	xStreamBufferHandle xStream = Serial_rxStream(portNum);
+
+	if ( xStream == NULL )
 	  return 0;
+
+	return (uint32_t) xStreamBufferReceive(xStream, BufferPtr, length, xTicksToWait);
 }
 
 /*****************************************************************************
 ** Function name:		Serial_flush
 **
-** Descriptions:		Clears the RX FIFO ringbuffer
+** Descriptions:		Clears the RX stream buffer
 **
 ** parameters:			portNum(0,1 or 3)
 ** Returned value:		none
@@ -567,23 +608,14 @@ int16_t Serial_read (uint32_t portNum)
 *****************************************************************************/
 uint8_t Serial_flush (uint32_t portNum)
 {
-	  if ( portNum == 0 )
-	  {
-		  UART0RxQueueWritePos = 0;
-		  UART0RxQueueReadPos = 0;
+	xStreamBufferHandle xStream = Serial_rxStream(portNum);
 
-	  }
-	  if ( portNum == 1 )
-	  {
-		  UART1RxQueueWritePos = 0;
-		  UART1RxQueueReadPos = 0;
-	  }
-	  if ( portNum == 3 )
-	  {
-		  UART3RxQueueWritePos = 0;
-		  UART3RxQueueReadPos = 0;
-	  }
-	  return 0;
+	if ( xStream != NULL )
+	{
+	  /* Fails, leaving the data in place, if a task is blocked reading. */
+	  ( void ) xStreamBufferReset(xStream);
+	}
+	return 0;
 }
 
 /******************************************************************************
@@ -61,7 +61,8 @@ typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
 #define LSR_TEMT	0x40
 #define LSR_RXFE	0x80
 
-#define UARTRXQUEUESIZE		0x10
+#define UARTRXFIFOSIZE		16		/* Depth of the hardware RX FIFO */
+#define UARTRXQUEUESIZE		0x40	/* Size of the RX stream buffer */
 
 void Serial_begin( uint8_t PortNum, uint32_t baudrate );
 void Serial_write( uint8_t portNum, uint8_t send);
@@ -76,6 +77,8 @@ uint8_t Serial_flush (uint32_t portNum);
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
-xTaskHandle xHandle;
+#include "stream_buffer.h"
+
+uint32_t Serial_readBytes (uint32_t portNum, uint8_t *BufferPtr, uint32_t length, portTickType xTicksToWait);
 
 #endif /* end __SERIAL_H */
@@ -0,0 +1,254 @@
+/*
+ * @file tickless.c
+ * @brief RTOS tick and tickless idle driven by LPC17xx TIMER0.
+ *
+ * Selected by setting configUSE_TICKLESS_IDLE to 2 in FreeRTOSConfig.h, which
+ * replaces the SysTick based code in port.c.
+ *
+ * TIMER0 is a 32-bit counter that is started once and never stopped or
+ * reset.  Match register 0 holds the count at which the next tick is due, so
+ * the kernel tick is a pure function of the counter: a tick is processed each
+ * time the counter passes another multiple of ulCountsPerTick from the point
+ * the scheduler started.  Suppressing ticks just moves the match further out,
+ * and on wake up the number of whole tick periods that passed is read back
+ * from the counter, so no time is lost while the timer is being reprogrammed
+ * and the tick does not drift however often the processor sleeps.
+ *
+ * At the default PCLK of CCLK/4 (25MHz) one match can be up to 171 seconds
+ * away, against 167ms for the 24-bit SysTick at 100MHz.
+ *
+ * With configUSE_HIGH_RES_DELAYS set to 1 the counter is also the kernel's
+ * high resolution clock, and match register 1 the alarm that wakes tasks
+ * delayed by vTaskDelayHighRes() in between ticks.  Both matches share the
+ * TIMER0 interrupt.
+ *
+ * The processor uses plain sleep mode (wfi with SLEEPDEEP clear) so TIMER0
+ * keeps counting.  Deep sleep stops the peripheral clocks and would need the
+ * RTC instead.
+ */
+
+#include "LPC17xx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if ( configUSE_TICKLESS_IDLE == 2 )
+
+/* Counts of TIMER0 that make up one tick period. */
+static uint32_t ulCountsPerTick = 0;
+
+/* The most tick periods that fit in a single match, leaving one period of
+headroom so the match can never wrap onto the current count. */
+static portTickType xMaximumPossibleSuppressedTicks = 0;
+
+/* Counter value at the start of the tick period the kernel is currently in.
+Only advanced in whole periods, so it stays aligned with the first tick. */
+static uint32_t ulLastTickCount = 0;
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	/* Time spent processing ticks, kept apart from the task that was
+	interrupted. */
+	static xISRRunTimeStats xTickRunTime;
+#endif
+
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+	/* Counts of TIMER0 in a microsecond, used through
+	portHIGH_RES_COUNTS_PER_US. */
+	unsigned long ulPortHighResCountsPerUs = 0;
+
+	/* Set when an alarm is requested for a time the counter has already
+	reached, so the interrupt was pended by hand and MR1 has not matched. */
+	static volatile portBASE_TYPE xHighResAlarmPended = pdFALSE;
+#endif
+
+/*
+ * Program the match for the next tick period after ulLastTickCount.  MR0 is
+ * an equality compare, so if the counter has already passed the new match the
+ * interrupt is pended by hand rather than waiting for the counter to wrap.
+ */
+static void prvSetNextTickMatch( uint32_t ulMatch );
+
+/*-----------------------------------------------------------*/
+
+void vPortSetupTimerInterrupt( void )
+{
+uint32_t ulPclkDiv, ulPclk;
+
+	/* Power TIMER0 and find its clock.  By default PCLKSEL0 selects CCLK/4. */
+	LPC_SC->PCONP |= 1 << 1;
+	ulPclkDiv = ( LPC_SC->PCLKSEL0 >> 2 ) & 0x03;
+	switch( ulPclkDiv )
+	{
+		case 0x01: ulPclk = SystemCoreClock; break;
+		case 0x02: ulPclk = SystemCoreClock / 2; break;
+		case 0x03: ulPclk = SystemCoreClock / 8; break;
+		default:   ulPclk = SystemCoreClock / 4; break;
+	}
+
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		vTaskRegisterISRRunTimeStats( &xTickRunTime, ( const signed char * ) "Tick" );
+	#endif
+
+	ulCountsPerTick = ulPclk / configTICK_RATE_HZ;
+	xMaximumPossibleSuppressedTicks = ( portTickType ) ( 0xffffffffUL / ulCountsPerTick ) - 1;
+
+	#if ( configUSE_HIGH_RES_DELAYS == 1 )
+		ulPortHighResCountsPerUs = ulPclk / 1000000UL;
+	#endif
+
+	LPC_TIM0->TCR = 0x02;				/* Hold the counter in reset. */
+	LPC_TIM0->PR = 0;
+	LPC_TIM0->CTCR = 0;					/* Timer mode, count every PCLK. */
+	LPC_TIM0->MCR = 0x01;				/* Interrupt on MR0, no reset or stop.  MR1 is enabled while an alarm is set. */
+	LPC_TIM0->IR = 0x3f;
+	ulLastTickCount = 0;
+	LPC_TIM0->MR0 = ulCountsPerTick;
+
+	/* The tick must have the same, lowest, priority that SysTick would have. */
+	NVIC_SetPriority( TIMER0_IRQn, configKERNEL_INTERRUPT_PRIORITY >> ( 8 - __NVIC_PRIO_BITS ) );
+	NVIC_EnableIRQ( TIMER0_IRQn );
+
+	LPC_TIM0->TCR = 0x01;
+}
+/*-----------------------------------------------------------*/
+
+void TIMER0_IRQHandler( void )
+{
+portBASE_TYPE xSwitchRequired = pdFALSE;
+uint32_t ulInterrupts;
+taskENTER_ISR_RUN_TIME( xTickRunTime );
+
+	ulInterrupts = LPC_TIM0->IR;
+	LPC_TIM0->IR = ulInterrupts & 0x03;
+
+	( void ) portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Normally exactly one period has passed.  After a sleep, or if this
+		interrupt was held off for longer than a tick, every whole period is
+		processed so the tick count catches up with the counter. */
+		while( ( LPC_TIM0->TC - ulLastTickCount ) >= ulCountsPerTick )
+		{
+			ulLastTickCount += ulCountsPerTick;
+			if( xTaskIncrementTick() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+		}
+
+		prvSetNextTickMatch( ulLastTickCount + ulCountsPerTick );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( 0 );
+
+	#if ( configUSE_HIGH_RES_DELAYS == 1 )
+	{
+		if( ( ( ( ulInterrupts & 0x02 ) != 0 ) && ( ( LPC_TIM0->MCR & 0x08 ) != 0 ) ) || ( xHighResAlarmPended != pdFALSE ) )
+		{
+			/* The alarm is one shot.  The kernel sets it again if other
+			tasks are still waiting. */
+			LPC_TIM0->MCR &= ~0x08UL;
+			xHighResAlarmPended = pdFALSE;
+
+			if( xTaskHighResAlarm() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+		}
+	}
+	#endif /* configUSE_HIGH_RES_DELAYS */
+
+	taskEXIT_ISR_RUN_TIME();
+	portEND_SWITCHING_ISR( xSwitchRequired );
+}
+/*-----------------------------------------------------------*/
+
+void vPortSuppressTicksAndSleep( portTickType xExpectedIdleTime )
+{
+uint32_t ulElapsedTicks;
+portTickType xModifiableIdleTime;
+
+	if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
+	{
+		xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+	}
+
+	/* Mask interrupts with PRIMASK rather than BASEPRI so that an interrupt
+	still wakes the processor from wfi, but is not serviced until the tick
+	count has been corrected. */
+	__asm volatile( "cpsid i" );
+
+	if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+	{
+		__asm volatile( "cpsie i" );
+		return;
+	}
+
+	/* The task that is due to unblock does so at the start of tick period
+	xExpectedIdleTime, counting the current period as zero. */
+	prvSetNextTickMatch( ulLastTickCount + ( ulCountsPerTick * xExpectedIdleTime ) );
+
+	/* configPRE_SLEEP_PROCESSING() can set its parameter to 0 to indicate
+	that it has already slept, in which case wfi is skipped. */
+	xModifiableIdleTime = xExpectedIdleTime;
+	configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+	if( xModifiableIdleTime > 0 )
+	{
+		__asm volatile( "dsb" );
+		__asm volatile( "wfi" );
+		__asm volatile( "isb" );
+	}
+	configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+	/* Whole tick periods that passed while asleep.  The counter kept
+	running, so this is exact whatever woke the processor. */
+	ulElapsedTicks = ( LPC_TIM0->TC - ulLastTickCount ) / ulCountsPerTick;
+
+	/* Leave the period in which the task unblocks to the tick interrupt, as
+	only xTaskIncrementTick() moves the task to the ready list. */
+	if( ulElapsedTicks >= ( uint32_t ) xExpectedIdleTime )
+	{
+		ulElapsedTicks = ( uint32_t ) xExpectedIdleTime - 1UL;
+	}
+
+	ulLastTickCount += ulCountsPerTick * ulElapsedTicks;
+	vTaskStepTick( ( portTickType ) ulElapsedTicks );
+
+	/* Either restores the normal one period match or, if the wake up match
+	has already passed, pends the tick interrupt to process it. */
+	prvSetNextTickMatch( ulLastTickCount + ulCountsPerTick );
+
+	__asm volatile( "cpsie i" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetNextTickMatch( uint32_t ulMatch )
+{
+	LPC_TIM0->MR0 = ulMatch;
+
+	if( ( LPC_TIM0->TC - ulLastTickCount ) >= ( ulMatch - ulLastTickCount ) )
+	{
+		NVIC_SetPendingIRQ( TIMER0_IRQn );
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HIGH_RES_DELAYS == 1 )
+
+void vPortSetHighResAlarm( unsigned long ulAlarmTime )
+{
+	/* Called by the kernel with interrupts masked. */
+	LPC_TIM0->MR1 = ulAlarmTime;
+	LPC_TIM0->MCR |= 0x08;				/* Interrupt on MR1. */
+
+	/* As in prvSetNextTickMatch(), MR1 is an equality compare, so if the
+	counter has already reached the alarm time the interrupt is pended by
+	hand. */
+	if( ( LPC_TIM0->TC - ulAlarmTime ) <= ( 0xffffffffUL >> 1 ) )
+	{
+		xHighResAlarmPended = pdTRUE;
+		NVIC_SetPendingIRQ( TIMER0_IRQn );
+	}
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_HIGH_RES_DELAYS */
+
+#endif /* configUSE_TICKLESS_IDLE */